@@ -0,0 +1,77 @@
+//
+// Created by Brian Jackson on 10/18/26.
+// Copyright (c) 2026 Robotic Exploration Lab. All rights reserved.
+//
+
+#include "arena.h"
+
+#include <stdint.h>
+#include <string.h>
+
+static size_t AlignUp(size_t size) {
+  return (size + SLAP_ARENA_ALIGNMENT - 1) & ~(size_t)(SLAP_ARENA_ALIGNMENT - 1);
+}
+
+slap_Arena slap_NewArena(void* buffer, size_t size) {
+  slap_Arena arena = {NULL, 0, 0};
+  if (!buffer) {
+    return arena;
+  }
+  uintptr_t start = (uintptr_t)buffer;
+  size_t offset = AlignUp(start) - start;
+  if (offset < size) {
+    arena.data = (char*)buffer + offset;
+    arena.size = size - offset;
+  }
+  return arena;
+}
+
+void* slap_ArenaPush(slap_Arena* arena, size_t size) {
+  SLAP_ASSERT(arena != NULL, SLAP_BAD_POINTER, NULL, "ArenaPush: arena is NULL");
+  size_t bytes = AlignUp(size);
+  if (bytes < size || bytes > arena->size - arena->top) {
+    return NULL;
+  }
+  void* ptr = arena->data + arena->top;
+  arena->top += bytes;
+  return ptr;
+}
+
+size_t slap_ArenaMark(const slap_Arena* arena) { return arena->top; }
+
+enum slap_ErrorCode slap_ArenaPop(slap_Arena* arena, size_t mark) {
+  SLAP_ASSERT(mark <= arena->top, SLAP_INDEX_OUT_OF_BOUNDS, SLAP_INDEX_OUT_OF_BOUNDS,
+              "ArenaPop: mark %zu is past the top of the arena (%zu)", mark, arena->top);
+  arena->top = mark;
+  return SLAP_NO_ERROR;
+}
+
+void slap_ArenaReset(slap_Arena* arena) { arena->top = 0; }
+
+size_t slap_ArenaBytesRemaining(const slap_Arena* arena) {
+  return arena->size - arena->top;
+}
+
+size_t slap_ArenaMatrixSize(int rows, int cols) {
+  return AlignUp((size_t)rows * (size_t)cols * sizeof(sfloat));
+}
+
+Matrix slap_ArenaNewMatrix(slap_Arena* arena, int rows, int cols) {
+  sfloat* data = (sfloat*)slap_ArenaPush(arena, (size_t)rows * (size_t)cols * sizeof(sfloat));
+  return slap_MatrixFromArray(rows, cols, data);
+}
+
+Matrix slap_ArenaNewMatrixAligned(slap_Arena* arena, int rows, int cols) {
+  int sy = slap_AlignedStride(rows);
+  Matrix mat = slap_ArenaNewMatrix(arena, sy, cols);
+  mat.rows = rows;
+  return mat;
+}
+
+Matrix slap_ArenaNewMatrixZeros(slap_Arena* arena, int rows, int cols) {
+  Matrix mat = slap_ArenaNewMatrix(arena, rows, cols);
+  if (mat.data) {
+    memset(mat.data, 0, (size_t)rows * (size_t)cols * sizeof(sfloat));
+  }
+  return mat;
+}
@@ -0,0 +1,148 @@
+//
+// Created by Brian Jackson on 10/18/26.
+// Copyright (c) 2026 Robotic Exploration Lab. All rights reserved.
+//
+
+#pragma once
+
+#include <stddef.h>
+
+#include "matrix.h"
+
+// Every allocation from an arena starts on a multiple of this many bytes
+#define SLAP_ARENA_ALIGNMENT 64
+
+/**
+ * @brief A linear allocator over a buffer owned by the user
+ *
+ * Allocations are pushed onto the end of the buffer and released in the reverse order,
+ * either all at once with slap_ArenaReset() or back to a point saved with
+ * slap_ArenaMark(). No memory is ever allocated or freed by the arena itself, so it can
+ * be used to create all of the matrices for a real-time loop up front from a static
+ * buffer.
+ *
+ * Routines that need scratch memory provide a `slap_<Routine>WorkspaceSize()` query
+ * returning the number of arena bytes needed for their temporary matrices, e.g.
+ * slap_QRWorkspaceSize().
+ *
+ * # Example
+ * ```c
+ * static char buffer[4096];
+ * slap_Arena arena = slap_NewArena(buffer, sizeof(buffer));
+ * Matrix A = slap_ArenaNewMatrix(&arena, 10, 5);
+ * size_t mark = slap_ArenaMark(&arena);
+ * Matrix temp = slap_ArenaNewMatrix(&arena, 10, 1);
+ * slap_ArenaPop(&arena, mark);  // releases temp, but not A
+ * ```
+ */
+typedef struct slap_Arena {
+  char* data;   //!< start of the aligned buffer
+  size_t size;  //!< usable bytes after alignment
+  size_t top;   //!< bytes currently allocated
+} slap_Arena;
+
+/**
+ * @brief Create an arena over a buffer
+ *
+ * The start of the buffer is rounded up to a multiple of `SLAP_ARENA_ALIGNMENT`, so up to
+ * `SLAP_ARENA_ALIGNMENT - 1` bytes may go unused.
+ *
+ * **Header File:** `slap/arena.h`
+ * @param buffer Memory for the arena to allocate from. Must outlive the arena.
+ * @param size Size of @p buffer in bytes
+ * @return A new, empty arena
+ */
+slap_Arena slap_NewArena(void* buffer, size_t size);
+
+/**
+ * @brief Allocate memory from an arena
+ *
+ * **Header File:** `slap/arena.h`
+ * @param arena Arena to allocate from
+ * @param size Number of bytes
+ * @return A pointer aligned to `SLAP_ARENA_ALIGNMENT`, or NULL if the arena doesn't have
+ *         enough space left.
+ */
+void* slap_ArenaPush(slap_Arena* arena, size_t size);
+
+/**
+ * @brief Current position of an arena, to be restored with slap_ArenaPop()
+ *
+ * **Header File:** `slap/arena.h`
+ */
+size_t slap_ArenaMark(const slap_Arena* arena);
+
+/**
+ * @brief Release everything allocated since slap_ArenaMark() returned @p mark
+ *
+ * **Header File:** `slap/arena.h`
+ * @param arena Arena to release memory from
+ * @param mark Value previously returned by slap_ArenaMark()
+ * @return slap error code
+ */
+enum slap_ErrorCode slap_ArenaPop(slap_Arena* arena, size_t mark);
+
+/**
+ * @brief Release all of the memory allocated from an arena
+ *
+ * **Header File:** `slap/arena.h`
+ */
+void slap_ArenaReset(slap_Arena* arena);
+
+/**
+ * @brief Number of bytes left in an arena
+ *
+ * **Header File:** `slap/arena.h`
+ */
+size_t slap_ArenaBytesRemaining(const slap_Arena* arena);
+
+/**
+ * @brief Number of arena bytes taken by a matrix allocated with slap_ArenaNewMatrix()
+ *
+ * Includes the padding needed to keep the next allocation aligned. Use it to size an
+ * arena, or to add up the workspace needed by a routine.
+ *
+ * **Header File:** `slap/arena.h`
+ * @param rows number of rows in the matrix
+ * @param cols number of columns in the matrix
+ */
+size_t slap_ArenaMatrixSize(int rows, int cols);
+
+/**
+ * @brief Allocate a new matrix from an arena
+ *
+ * Same as slap_NewMatrix(), but the data is taken from @p arena and must not be passed to
+ * slap_FreeMatrix(). Data will not be initialized.
+ *
+ * **Header File:** `slap/arena.h`
+ * @param arena Arena to allocate from
+ * @param rows number of rows in the matrix
+ * @param cols number of columns in the matrix
+ * @return A new matrix, with a NULL data pointer if the arena is full
+ */
+Matrix slap_ArenaNewMatrix(slap_Arena* arena, int rows, int cols);
+
+/**
+ * @brief Allocate a new matrix with a padded column stride from an arena
+ *
+ * Same as slap_NewMatrixAligned(), but the data is taken from @p arena. Takes
+ * `slap_ArenaMatrixSize(slap_AlignedStride(rows), cols)` bytes.
+ *
+ * **Header File:** `slap/arena.h`
+ * @param arena Arena to allocate from
+ * @param rows number of rows in the matrix
+ * @param cols number of columns in the matrix
+ * @return A new matrix, with a NULL data pointer if the arena is full
+ */
+Matrix slap_ArenaNewMatrixAligned(slap_Arena* arena, int rows, int cols);
+
+/**
+ * @brief Allocate a new matrix from an arena, initialized with zeros
+ *
+ * **Header File:** `slap/arena.h`
+ * @param arena Arena to allocate from
+ * @param rows number of rows in the matrix
+ * @param cols number of columns in the matrix
+ * @return A new matrix, with a NULL data pointer if the arena is full
+ */
+Matrix slap_ArenaNewMatrixZeros(slap_Arena* arena, int rows, int cols);
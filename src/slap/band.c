@@ -0,0 +1,293 @@
+//
+// Created by Brian Jackson on 10/18/26.
+// Copyright (c) 2026 Robotic Exploration Lab. All rights reserved.
+//
+
+#include "band.h"
+
+#include <math.h>
+
+#include "kernels.h"
+#include "unary_ops.h"
+
+// Pointer to element (i,j) of the stored (untransposed) matrix, which must be in the band
+static inline sfloat* Stored(Matrix A, int i, int j) {
+  return A.data + A.ku + i - j + j * A.sy;
+}
+
+static inline int Min(int a, int b) { return a < b ? a : b; }
+static inline int Max(int a, int b) { return a > b ? a : b; }
+
+static void Swap(sfloat* a, sfloat* b) {
+  sfloat tmp = *a;
+  *a = *b;
+  *b = tmp;
+}
+
+sfloat* slap_BandElement(Matrix A, int i, int j) {
+  if (slap_IsTransposed(A)) {
+    int tmp = i;
+    i = j;
+    j = tmp;
+  }
+  if (i < 0 || j < 0 || i >= A.rows || j >= A.cols || i - j > A.kl || j - i > A.ku) {
+    return NULL;
+  }
+  return Stored(A, i, j);
+}
+
+enum slap_ErrorCode slap_BandToDense(Matrix dense, const Matrix band) {
+  SLAP_ASSERT_VALID(dense, SLAP_INVALID_MATRIX, "BandToDense: dense matrix invalid");
+  SLAP_ASSERT_VALID(band, SLAP_INVALID_MATRIX, "BandToDense: band matrix invalid");
+  SLAP_ASSERT_SAME_SIZE(dense, band, SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS, "BandToDense");
+  slap_SetConst(dense, 0);
+  for (int j = 0; j < band.cols; ++j) {
+    int i_end = Min(band.rows, j + band.kl + 1);
+    for (int i = Max(0, j - band.ku); i < i_end; ++i) {
+      sfloat val = *Stored(band, i, j);
+      if (slap_IsTransposed(band)) {
+        slap_SetElement(dense, j, i, val);
+      } else {
+        slap_SetElement(dense, i, j, val);
+      }
+    }
+  }
+  return SLAP_NO_ERROR;
+}
+
+enum slap_ErrorCode slap_BandMatMulAdd(Matrix C, Matrix A, Matrix B, sfloat alpha,
+                                       sfloat beta) {
+  SLAP_ASSERT_VALID(C, SLAP_INVALID_MATRIX, "BandMatMulAdd: invalid C matrix");
+  SLAP_ASSERT_VALID(A, SLAP_INVALID_MATRIX, "BandMatMulAdd: invalid A matrix");
+  SLAP_ASSERT_VALID(B, SLAP_INVALID_MATRIX, "BandMatMulAdd: invalid B matrix");
+  SLAP_ASSERT(slap_GetType(B) != slap_BANDED && slap_GetType(C) != slap_BANDED,
+              SLAP_INVALID_MATRIX, SLAP_INVALID_MATRIX,
+              "BandMatMulAdd: B and C must not be band matrices");
+  SLAP_ASSERT(slap_NumRows(C) == slap_NumRows(A), SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              "BandMatMulAdd: Rows of C (%d) not equal to Rows of A (%d).", slap_NumRows(C),
+              slap_NumRows(A));
+  SLAP_ASSERT(slap_NumCols(A) == slap_NumRows(B), SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              "BandMatMulAdd: Columns of A (%d) not equal to Rows of B (%d).",
+              slap_NumCols(A), slap_NumRows(B));
+  SLAP_ASSERT(slap_NumCols(C) == slap_NumCols(B), SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              "BandMatMulAdd: Columns of C (%d) not equal to Columns of B (%d).",
+              slap_NumCols(C), slap_NumCols(B));
+  if (beta == 0) {
+    slap_SetConst(C, 0);
+  } else if (beta != 1) {
+    slap_ScaleByConst(C, beta);
+  }
+
+  // Dimensions of the stored matrix
+  int m = A.rows;
+  int n = A.cols;
+  int p = slap_NumCols(B);
+  int rs_B = slap_RowStride(B);
+  int cs_B = slap_ColStride(B);
+  int rs_C = slap_RowStride(C);
+  int cs_C = slap_ColStride(C);
+  const slap_Kernels* kernels = slap_GetKernels();
+
+  for (int k = 0; k < p; ++k) {
+    const sfloat* b = B.data + k * cs_B;
+    sfloat* c = C.data + k * cs_C;
+    if (!slap_IsTransposed(A)) {
+      // c += alpha * A[:, j] * b[j], over the band of each column
+      for (int j = 0; j < n; ++j) {
+        sfloat bj = alpha * b[j * rs_B];
+        if (bj == 0) {
+          continue;
+        }
+        int start = Max(0, j - A.ku);
+        int len = Min(m, j + A.kl + 1) - start;
+        slap_AxpyStrided(kernels, len, bj, Stored(A, start, j), 1, c + start * rs_C, rs_C);
+      }
+    } else {
+      // c[i] += alpha * A[:, i]' b, since the columns of A are the rows of A'
+      for (int i = 0; i < n; ++i) {
+        int start = Max(0, i - A.ku);
+        int len = Min(m, i + A.kl + 1) - start;
+        c[i * rs_C] += alpha * slap_DotStrided(kernels, len, Stored(A, start, i), 1,
+                                               b + start * rs_B, rs_B);
+      }
+    }
+  }
+  return SLAP_NO_ERROR;
+}
+
+enum slap_ErrorCode slap_BandTriSolve(Matrix L, Matrix b) {
+  SLAP_ASSERT_VALID(L, SLAP_INVALID_MATRIX, "BandTriSolve: L matrix invalid");
+  SLAP_ASSERT_VALID(b, SLAP_INVALID_MATRIX, "BandTriSolve: b matrix invalid");
+  SLAP_ASSERT(slap_IsSquare(L), SLAP_MATRIX_NOT_SQUARE, SLAP_MATRIX_NOT_SQUARE,
+              "BandTriSolve: matrix must be square. Got size (%d,%d)", slap_NumRows(L),
+              slap_NumCols(L));
+  SLAP_ASSERT(slap_NumCols(L) == slap_NumRows(b), SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              "BandTriSolve: L has %d columns but b has %d rows", slap_NumCols(L),
+              slap_NumRows(b));
+  int n = L.rows;
+  int m = slap_NumCols(b);
+  int rs_b = slap_RowStride(b);
+  int cs_b = slap_ColStride(b);
+  const slap_Kernels* kernels = slap_GetKernels();
+
+  for (int k = 0; k < m; ++k) {
+    sfloat* x = b.data + k * cs_b;
+    if (!slap_IsTransposed(L)) {
+      // Forward substitution, eliminating x[j] by walking down column j of L
+      for (int j = 0; j < n; ++j) {
+        x[j * rs_b] /= *Stored(L, j, j);
+        int len = Min(L.kl, n - j - 1);
+        slap_AxpyStrided(kernels, len, -x[j * rs_b], Stored(L, j + 1, j), 1,
+                         x + (j + 1) * rs_b, rs_b);
+      }
+    } else {
+      // Back substitution, where row j of L' is column j of L
+      for (int j = n - 1; j >= 0; --j) {
+        int len = Min(L.kl, n - j - 1);
+        sfloat sum = slap_DotStrided(kernels, len, Stored(L, j + 1, j), 1,
+                                     x + (j + 1) * rs_b, rs_b);
+        x[j * rs_b] = (x[j * rs_b] - sum) / *Stored(L, j, j);
+      }
+    }
+  }
+  return SLAP_NO_ERROR;
+}
+
+enum slap_ErrorCode slap_BandCholesky(Matrix A, int* fail_col) {
+  SLAP_ASSERT_VALID(A, SLAP_INVALID_MATRIX, "BandCholesky: matrix invalid");
+  SLAP_ASSERT(slap_IsSquare(A), SLAP_MATRIX_NOT_SQUARE, SLAP_MATRIX_NOT_SQUARE,
+              "BandCholesky: matrix must be square. Got size (%d,%d)", slap_NumRows(A),
+              slap_NumCols(A));
+  SLAP_ASSERT(!slap_IsTransposed(A), SLAP_INVALID_MATRIX, SLAP_INVALID_MATRIX,
+              "BandCholesky: matrix can't be transposed");
+  int n = A.rows;
+  int fail = -1;
+  const slap_Kernels* kernels = slap_GetKernels();
+
+  // Right-looking, like LAPACK's pbtf2: after computing column j, subtract its outer
+  // product from the trailing kl x kl block
+  for (int j = 0; j < n; ++j) {
+    sfloat* Ajj = Stored(A, j, j);
+    if (*Ajj <= 0) {
+      fail = j;
+      break;
+    }
+    sfloat ajj = sqrt(*Ajj);
+    *Ajj = ajj;
+    int len = Min(A.kl, n - j - 1);
+    sfloat* col = Ajj + 1;
+    for (int i = 0; i < len; ++i) {
+      col[i] /= ajj;
+    }
+    for (int i = 0; i < len; ++i) {
+      slap_AxpyStrided(kernels, len - i, -col[i], col + i, 1,
+                       Stored(A, j + 1 + i, j + 1 + i), 1);
+    }
+  }
+  if (fail_col) {
+    *fail_col = fail;
+  }
+  return fail < 0 ? SLAP_NO_ERROR : SLAP_CHOLESKY_FAIL;
+}
+
+enum slap_ErrorCode slap_BandLU(Matrix A, int* piv) {
+  SLAP_ASSERT_VALID(A, SLAP_INVALID_MATRIX, "BandLU: matrix invalid");
+  SLAP_ASSERT(piv != NULL, SLAP_BAD_POINTER, SLAP_BAD_POINTER,
+              "BandLU: pivot array is NULL");
+  SLAP_ASSERT(slap_IsSquare(A), SLAP_MATRIX_NOT_SQUARE, SLAP_MATRIX_NOT_SQUARE,
+              "BandLU: matrix must be square. Got size (%d,%d)", slap_NumRows(A),
+              slap_NumCols(A));
+  SLAP_ASSERT(!slap_IsTransposed(A), SLAP_INVALID_MATRIX, SLAP_INVALID_MATRIX,
+              "BandLU: matrix can't be transposed");
+  int n = A.rows;
+  int fail = -1;
+  const slap_Kernels* kernels = slap_GetKernels();
+
+  for (int j = 0; j < n; ++j) {
+    // Find the pivot in the kl elements below the diagonal
+    int len = Min(A.kl, n - j - 1);
+    sfloat* col = Stored(A, j, j);
+    int p = 0;
+    for (int i = 1; i <= len; ++i) {
+      if (fabs(col[i]) > fabs(col[p])) {
+        p = i;
+      }
+    }
+    piv[j] = j + p;
+    if (col[p] == 0) {
+      if (fail < 0) {
+        fail = j;
+      }
+      continue;
+    }
+
+    // Row j + p has no elements past column j + kl + ku, which is the width of U
+    int j_end = Min(n, j + A.ku + 1);
+    if (p != 0) {
+      for (int c = j; c < j_end; ++c) {
+        Swap(Stored(A, j, c), Stored(A, j + p, c));
+      }
+    }
+
+    // Compute the multipliers and update the trailing columns in the band
+    sfloat dinv = 1 / col[0];
+    for (int i = 1; i <= len; ++i) {
+      col[i] *= dinv;
+    }
+    for (int c = j + 1; c < j_end; ++c) {
+      sfloat Ajc = *Stored(A, j, c);
+      if (Ajc != 0) {
+        slap_AxpyStrided(kernels, len, -Ajc, col + 1, 1, Stored(A, j + 1, c), 1);
+      }
+    }
+  }
+  return fail < 0 ? SLAP_NO_ERROR : SLAP_SINGULAR_MATRIX;
+}
+
+enum slap_ErrorCode slap_BandLUSolve(Matrix LU, const int* piv, Matrix b) {
+  SLAP_ASSERT_VALID(LU, SLAP_INVALID_MATRIX, "BandLUSolve: LU matrix invalid");
+  SLAP_ASSERT_VALID(b, SLAP_INVALID_MATRIX, "BandLUSolve: b matrix invalid");
+  SLAP_ASSERT(piv != NULL, SLAP_BAD_POINTER, SLAP_BAD_POINTER,
+              "BandLUSolve: pivot array is NULL");
+  SLAP_ASSERT(slap_IsSquare(LU), SLAP_MATRIX_NOT_SQUARE, SLAP_MATRIX_NOT_SQUARE,
+              "BandLUSolve: matrix must be square. Got size (%d,%d)", slap_NumRows(LU),
+              slap_NumCols(LU));
+  SLAP_ASSERT(!slap_IsTransposed(LU), SLAP_INVALID_MATRIX, SLAP_INVALID_MATRIX,
+              "BandLUSolve: matrix can't be transposed");
+  SLAP_ASSERT(slap_NumCols(LU) == slap_NumRows(b), SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              "BandLUSolve: LU has %d columns but b has %d rows", slap_NumCols(LU),
+              slap_NumRows(b));
+  int n = LU.rows;
+  int m = slap_NumCols(b);
+  int rs_b = slap_RowStride(b);
+  int cs_b = slap_ColStride(b);
+  const slap_Kernels* kernels = slap_GetKernels();
+
+  for (int k = 0; k < m; ++k) {
+    sfloat* x = b.data + k * cs_b;
+
+    // Solve L y = P b, applying the swaps in the order they were made
+    for (int j = 0; j < n; ++j) {
+      if (piv[j] != j) {
+        Swap(x + j * rs_b, x + piv[j] * rs_b);
+      }
+      int len = Min(LU.kl, n - j - 1);
+      slap_AxpyStrided(kernels, len, -x[j * rs_b], Stored(LU, j + 1, j), 1,
+                       x + (j + 1) * rs_b, rs_b);
+    }
+
+    // Solve U x = y, walking up the columns of U
+    for (int j = n - 1; j >= 0; --j) {
+      x[j * rs_b] /= *Stored(LU, j, j);
+      int len = Min(LU.ku, j);
+      slap_AxpyStrided(kernels, len, -x[j * rs_b], Stored(LU, j - len, j), 1,
+                       x + (j - len) * rs_b, rs_b);
+    }
+  }
+  return SLAP_NO_ERROR;
+}
@@ -0,0 +1,135 @@
+//
+// Created by Brian Jackson on 10/18/26.
+// Copyright (c) 2026 Robotic Exploration Lab. All rights reserved.
+//
+
+#pragma once
+
+#include "matrix.h"
+
+/**
+ * @brief Get a pointer to an element of a band matrix
+ *
+ * The indices are for the matrix as it is viewed, so transposing the matrix swaps them.
+ *
+ * **Header File:** `slap/linalg.h`
+ * @param A A band matrix, created with slap_NewBandMatrix()
+ * @param i row index
+ * @param j column index
+ * @return Pointer to the element, or NULL if it is outside of the band.
+ */
+sfloat* slap_BandElement(Matrix A, int i, int j);
+
+/**
+ * @brief Copy a band matrix into a dense matrix
+ *
+ * Elements outside of the band are set to zero.
+ *
+ * **Header File:** `slap/linalg.h`
+ * @param[out] dense A dense matrix of the same size as @p band
+ * @param[in] band A band matrix, which can be transposed
+ * @return slap error code
+ */
+enum slap_ErrorCode slap_BandToDense(Matrix dense, const Matrix band);
+
+/**
+ * @brief Matrix multiplication with a band matrix
+ *
+ * Computes \f$ C = \beta C + \alpha A B \f$, where @p A is a band matrix and @p B and
+ * @p C are dense. Only the elements in the band are touched, so the work is
+ * proportional to the number of stored elements of @p A times the number of columns of
+ * @p B.
+ *
+ * Called by slap_MatMulAdd() when @p A has type `slap_BANDED`.
+ *
+ * **Header File:** `slap/linalg.h`
+ * @param[out] C Output matrix
+ * @param[in] A A band matrix, which can be transposed
+ * @param[in] B A dense matrix
+ * @param[in] alpha scaling on the product
+ * @param[in] beta scaling on the original value of @p C
+ * @return slap error code
+ */
+enum slap_ErrorCode slap_BandMatMulAdd(Matrix C, Matrix A, Matrix B, sfloat alpha,
+                                       sfloat beta);
+
+/**
+ * @brief Triangular solve with a band matrix
+ *
+ * Follows the same convention as slap_TriSolve() for dense matrices: if @p L isn't
+ * transposed, solves \f$ L x = b \f$ using the diagonal and the `kl` sub-diagonals of
+ * @p L. If it is transposed, solves \f$ L^T x = b \f$, using the same elements. The
+ * super-diagonals are never read, so the result of slap_BandCholesky() can be passed
+ * directly.
+ *
+ * Called by slap_TriSolve() when @p L has type `slap_BANDED`.
+ *
+ * **Header File:** `slap/linalg.h`
+ * @param[in] L A square band matrix
+ * @param[inout] b The right-hand side, with any number of columns. Stores the solution
+ *                 upon completion of the function.
+ * @return slap error code
+ */
+enum slap_ErrorCode slap_BandTriSolve(Matrix L, Matrix b);
+
+/**
+ * @brief Cholesky decomposition of a symmetric positive-definite band matrix
+ *
+ * Like slap_Cholesky(), only the lower triangle is read, and it is replaced by the
+ * Cholesky factor, which has the same bandwidth. The work is \f$ O(n k^2) \f$ for
+ * `k = kl` sub-diagonals, instead of \f$ O(n^3) \f$. The super-diagonals don't need to
+ * be stored, so the matrix can be allocated with `ku = 0`.
+ *
+ * Called by slap_Cholesky() when @p A has type `slap_BANDED`, and the factor can be
+ * passed to slap_CholeskySolve().
+ *
+ * **Header File:** `slap/linalg.h`
+ * @param[inout] A A square band matrix. Can't be transposed.
+ * @param[out] fail_col Column where the factorization failed, or -1 if it succeeded.
+ *                      Can be NULL.
+ * @return SLAP_NO_ERROR, or SLAP_CHOLESKY_FAIL if the matrix isn't positive definite
+ */
+enum slap_ErrorCode slap_BandCholesky(Matrix A, int* fail_col);
+
+/**
+ * @brief LU decomposition of a band matrix, with partial pivoting
+ *
+ * Computes \f$ P A = L U \f$ in place, using the same algorithm and storage as LAPACK's
+ * `gbtf2`. Row swaps make \f$ U \f$ wider than @p A: for a matrix with `kl`
+ * sub-diagonals and `ku` super-diagonals, allocate it with `kl + ku` super-diagonals,
+ * leaving the top `kl` of them zero. \f$ U \f$ is then stored in the super-diagonals, and
+ * the multipliers of \f$ L \f$ in the sub-diagonals. Unlike slap_LU(), the multipliers are
+ * stored in the order they were computed, so the factors are only usable with
+ * slap_BandLUSolve().
+ *
+ * Called by slap_LU() when @p A has type `slap_BANDED`.
+ *
+ * # Example
+ * ```c
+ * Matrix A = slap_NewBandMatrix(n, n, kl, kl + ku);
+ * // ... set the elements of A
+ * int piv[n];
+ * slap_LU(A, piv);
+ * slap_LUSolve(A, piv, x);
+ * ```
+ *
+ * **Header File:** `slap/linalg.h`
+ * @param[inout] A A square band matrix. Can't be transposed.
+ * @param[out] piv Array of `n` pivot indices, using the same convention as slap_LU()
+ * @return SLAP_NO_ERROR, or SLAP_SINGULAR_MATRIX if a pivot is exactly zero
+ */
+enum slap_ErrorCode slap_BandLU(Matrix A, int* piv);
+
+/**
+ * @brief Solve a linear system with a precomputed band LU decomposition
+ *
+ * Called by slap_LUSolve() when @p LU has type `slap_BANDED`.
+ *
+ * **Header File:** `slap/linalg.h`
+ * @param[in] LU LU decomposition from slap_BandLU()
+ * @param[in] piv Pivot indices from slap_BandLU()
+ * @param[inout] b The right-hand side, with any number of columns. Stores the solution
+ *               upon completion of the function.
+ * @return slap error code
+ */
+enum slap_ErrorCode slap_BandLUSolve(Matrix LU, const int* piv, Matrix b);
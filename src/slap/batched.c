@@ -0,0 +1,318 @@
+//
+// Created by Brian Jackson on 10/18/26.
+// Copyright (c) 2026 Robotic Exploration Lab. All rights reserved.
+//
+
+#include "batched.h"
+
+#include <math.h>
+
+#include "cholesky.h"
+#include "matmul.h"
+#include "tri.h"
+
+#define W SLAP_BATCH_WIDTH
+#define MAX_DIM SLAP_BATCH_MAX_DIM
+
+// Offset of element (i,j) of the first problem in an interleaved buffer with ld rows.
+// The same element of problem l is at offset + l.
+#define IDX(i, j, ld) (((i) + (j) * (ld)) * W)
+
+/*
+ * Interleaved storage
+ */
+
+// Copy the first `lanes` matrices into an interleaved buffer. Unused lanes get a copy of
+// the first problem, so they stay well-conditioned and don't generate NaNs.
+static void Pack(int lanes, const Matrix* mats, int m, int n, sfloat* buf) {
+  const sfloat* data[W];
+  int rs[W];
+  int cs[W];
+  for (int l = 0; l < W; ++l) {
+    Matrix M = mats[l < lanes ? l : 0];
+    data[l] = M.data;
+    rs[l] = slap_RowStride(M);
+    cs[l] = slap_ColStride(M);
+  }
+  for (int j = 0; j < n; ++j) {
+    for (int i = 0; i < m; ++i) {
+      sfloat* bij = buf + IDX(i, j, m);
+      for (int l = 0; l < W; ++l) {
+        bij[l] = data[l][i * rs[l] + j * cs[l]];
+      }
+    }
+  }
+}
+
+// Copy lane l of an interleaved buffer back into M, optionally only the lower triangle
+static void UnpackLane(Matrix M, int l, int m, int n, bool lower, const sfloat* buf) {
+  int rs = slap_RowStride(M);
+  int cs = slap_ColStride(M);
+  for (int j = 0; j < n; ++j) {
+    for (int i = lower ? j : 0; i < m; ++i) {
+      M.data[i * rs + j * cs] = buf[IDX(i, j, m) + l];
+    }
+  }
+}
+
+// Record the result of problem k, returning the first error in the batch
+static enum slap_ErrorCode Record(enum slap_ErrorCode* status, int k,
+                                  enum slap_ErrorCode err, enum slap_ErrorCode result) {
+  if (status) {
+    status[k] = err;
+  }
+  return result == SLAP_NO_ERROR ? err : result;
+}
+
+/*
+ * Interleaved kernels. The innermost loop always runs over the W lanes.
+ */
+
+// C = beta C + alpha A B, with interleaved A (m x k) and B (k x n). The output is written
+// straight into the original matrices.
+static void MatMulInterleaved(int lanes, const Matrix* C, int m, int n, int k,
+                              const sfloat* A, const sfloat* B, sfloat alpha, sfloat beta) {
+  for (int j = 0; j < n; ++j) {
+    for (int i = 0; i < m; ++i) {
+      sfloat ABij[W] = {0};
+      for (int p = 0; p < k; ++p) {
+        const sfloat* Aip = A + IDX(i, p, m);
+        const sfloat* Bpj = B + IDX(p, j, k);
+        for (int l = 0; l < W; ++l) {
+          ABij[l] += Aip[l] * Bpj[l];
+        }
+      }
+      for (int l = 0; l < lanes; ++l) {
+        sfloat* Cij = C[l].data + i * slap_RowStride(C[l]) + j * slap_ColStride(C[l]);
+        *Cij = beta == 0 ? alpha * ABij[l] : beta * *Cij + alpha * ABij[l];
+      }
+    }
+  }
+}
+
+// Cholesky decomposition, computing each element of L with a running sum in registers.
+// Sets failed[l] if problem l isn't positive definite, and keeps going with a unit pivot
+// so the other lanes are unaffected.
+static void CholeskyInterleaved(int n, sfloat* A, bool* failed) {
+  for (int j = 0; j < n; ++j) {
+    sfloat pivot[W] = {0};  // set when i == j
+    for (int i = j; i < n; ++i) {
+      sfloat Lij[W];
+      sfloat* Aij = A + IDX(i, j, n);
+      for (int l = 0; l < W; ++l) {
+        Lij[l] = Aij[l];
+      }
+      for (int p = 0; p < j; ++p) {
+        const sfloat* Lip = A + IDX(i, p, n);
+        const sfloat* Ljp = A + IDX(j, p, n);
+        for (int l = 0; l < W; ++l) {
+          Lij[l] -= Lip[l] * Ljp[l];
+        }
+      }
+      if (i == j) {
+        for (int l = 0; l < W; ++l) {
+          failed[l] = failed[l] || Lij[l] <= 0;
+          pivot[l] = Lij[l] > 0 ? sqrt(Lij[l]) : 1;
+        }
+      }
+      for (int l = 0; l < W; ++l) {
+        Aij[l] = Lij[l] / pivot[l];
+      }
+    }
+  }
+}
+
+// Solve L x = b (or L' x = b if transpose is set) for each of the nrhs columns of x,
+// computing each x[j] with a running sum over the entries already solved
+static void TriSolveInterleaved(int n, int nrhs, const sfloat* L, bool upper,
+                                bool transpose, sfloat* x) {
+  for (int c = 0; c < nrhs; ++c) {
+    sfloat* xc = x + IDX(0, c, n);
+    for (int j_ = 0; j_ < n; ++j_) {
+      int j = upper ? n - j_ - 1 : j_;
+      sfloat xj[W];
+      for (int l = 0; l < W; ++l) {
+        xj[l] = xc[j * W + l];
+      }
+      int start = upper ? j + 1 : 0;
+      int stop = upper ? n : j;
+      for (int p = start; p < stop; ++p) {
+        const sfloat* Ljp = L + (transpose ? IDX(p, j, n) : IDX(j, p, n));
+        const sfloat* xp = xc + p * W;
+        for (int l = 0; l < W; ++l) {
+          xj[l] -= Ljp[l] * xp[l];
+        }
+      }
+      const sfloat* Ljj = L + IDX(j, j, n);
+      for (int l = 0; l < W; ++l) {
+        xc[j * W + l] = xj[l] / Ljj[l];
+      }
+    }
+  }
+}
+
+/*
+ * Batched methods
+ */
+
+// Only dense matrices are packed into the interleaved buffers. Triangular, diagonal, band
+// and packed matrices take the serial fallback, which handles their storage.
+static bool IsDense(Matrix A) { return slap_IsValid(A) && slap_GetType(A) == slap_DENSE; }
+
+static bool CanBatchMatMul(Matrix C, Matrix A, Matrix B) {
+  int m = slap_NumRows(A);
+  int k = slap_NumCols(A);
+  int n = slap_NumCols(B);
+  return IsDense(C) && IsDense(A) && IsDense(B) && slap_NumRows(B) == k &&
+         slap_NumRows(C) == m && slap_NumCols(C) == n && m <= MAX_DIM && k <= MAX_DIM &&
+         n <= MAX_DIM;
+}
+
+enum slap_ErrorCode slap_BatchedMatMulAdd(int batch_size, const Matrix* C, const Matrix* A,
+                                          const Matrix* B, sfloat alpha, sfloat beta) {
+  SLAP_ASSERT(batch_size == 0 || (C && A && B), SLAP_BAD_POINTER, SLAP_BAD_POINTER,
+              "BatchedMatMulAdd: got a NULL array");
+  enum slap_ErrorCode result = SLAP_NO_ERROR;
+  sfloat Abuf[MAX_DIM * MAX_DIM * W];
+  sfloat Bbuf[MAX_DIM * MAX_DIM * W];
+  int k = 0;
+  while (k < batch_size) {
+    int lanes = 0;
+    if (CanBatchMatMul(C[k], A[k], B[k])) {
+      lanes = 1;
+      while (lanes < W && k + lanes < batch_size &&
+             CanBatchMatMul(C[k + lanes], A[k + lanes], B[k + lanes]) &&
+             slap_NumRows(A[k + lanes]) == slap_NumRows(A[k]) &&
+             slap_NumCols(A[k + lanes]) == slap_NumCols(A[k]) &&
+             slap_NumCols(B[k + lanes]) == slap_NumCols(B[k])) {
+        ++lanes;
+      }
+    }
+    if (lanes < 2) {
+      enum slap_ErrorCode err = slap_MatMulAdd(C[k], A[k], B[k], alpha, beta);
+      if (result == SLAP_NO_ERROR) {
+        result = err;
+      }
+      ++k;
+      continue;
+    }
+    int m = slap_NumRows(A[k]);
+    int p = slap_NumCols(A[k]);
+    int n = slap_NumCols(B[k]);
+    Pack(lanes, A + k, m, p, Abuf);
+    Pack(lanes, B + k, p, n, Bbuf);
+    MatMulInterleaved(lanes, C + k, m, n, p, Abuf, Bbuf, alpha, beta);
+    k += lanes;
+  }
+  return result;
+}
+
+static bool CanBatchCholesky(Matrix A) {
+  return IsDense(A) && slap_NumRows(A) == slap_NumCols(A) && slap_NumRows(A) <= MAX_DIM;
+}
+
+enum slap_ErrorCode slap_BatchedCholesky(int batch_size, const Matrix* A,
+                                         enum slap_ErrorCode* status) {
+  SLAP_ASSERT(batch_size == 0 || A, SLAP_BAD_POINTER, SLAP_BAD_POINTER,
+              "BatchedCholesky: got a NULL array");
+  enum slap_ErrorCode result = SLAP_NO_ERROR;
+  sfloat Abuf[MAX_DIM * MAX_DIM * W];
+  int k = 0;
+  while (k < batch_size) {
+    int lanes = 0;
+    if (CanBatchCholesky(A[k])) {
+      lanes = 1;
+      while (lanes < W && k + lanes < batch_size && CanBatchCholesky(A[k + lanes]) &&
+             slap_NumRows(A[k + lanes]) == slap_NumRows(A[k])) {
+        ++lanes;
+      }
+    }
+    if (lanes < 2) {
+      result = Record(status, k, slap_Cholesky(A[k]), result);
+      ++k;
+      continue;
+    }
+    int n = slap_NumRows(A[k]);
+    bool failed[W] = {false};
+    Pack(lanes, A + k, n, n, Abuf);
+    CholeskyInterleaved(n, Abuf, failed);
+    for (int l = 0; l < lanes; ++l) {
+      if (failed[l]) {
+        result = Record(status, k + l, SLAP_CHOLESKY_FAIL, result);
+      } else {
+        UnpackLane(A[k + l], l, n, n, true, Abuf);
+        result = Record(status, k + l, SLAP_NO_ERROR, result);
+      }
+    }
+    k += lanes;
+  }
+  return result;
+}
+
+static bool CanBatchSolve(Matrix L, Matrix b) {
+  return IsDense(L) && IsDense(b) && slap_NumRows(L) == slap_NumCols(L) &&
+         slap_NumRows(b) == slap_NumRows(L) && slap_NumRows(L) <= MAX_DIM &&
+         slap_NumCols(b) <= MAX_DIM;
+}
+
+// Batched factors are dense, so they're upper triangular if they're transposed
+static bool IsUpper(Matrix L) { return slap_IsTransposed(L); }
+
+// Shared driver for the triangular and Cholesky solves
+static enum slap_ErrorCode BatchedSolve(int batch_size, const Matrix* L, const Matrix* b,
+                                        enum slap_ErrorCode* status, bool cholesky) {
+  enum slap_ErrorCode result = SLAP_NO_ERROR;
+  sfloat Lbuf[MAX_DIM * MAX_DIM * W];
+  sfloat xbuf[MAX_DIM * MAX_DIM * W];
+  int k = 0;
+  while (k < batch_size) {
+    // slap_CholeskySolve() expects the factor in the lower triangle
+    bool upper = IsUpper(L[k]);
+    int lanes = 0;
+    if (CanBatchSolve(L[k], b[k]) && !(cholesky && upper)) {
+      lanes = 1;
+      while (lanes < W && k + lanes < batch_size &&
+             CanBatchSolve(L[k + lanes], b[k + lanes]) && IsUpper(L[k + lanes]) == upper &&
+             slap_NumRows(L[k + lanes]) == slap_NumRows(L[k]) &&
+             slap_NumCols(b[k + lanes]) == slap_NumCols(b[k])) {
+        ++lanes;
+      }
+    }
+    if (lanes < 2) {
+      enum slap_ErrorCode err =
+          cholesky ? slap_CholeskySolve(L[k], b[k]) : slap_TriSolve(L[k], b[k]);
+      result = Record(status, k, err, result);
+      ++k;
+      continue;
+    }
+    int n = slap_NumRows(L[k]);
+    int nrhs = slap_NumCols(b[k]);
+    Pack(lanes, L + k, n, n, Lbuf);
+    Pack(lanes, b + k, n, nrhs, xbuf);
+    TriSolveInterleaved(n, nrhs, Lbuf, upper, false, xbuf);
+    if (cholesky) {
+      TriSolveInterleaved(n, nrhs, Lbuf, true, true, xbuf);
+    }
+    for (int l = 0; l < lanes; ++l) {
+      UnpackLane(b[k + l], l, n, nrhs, false, xbuf);
+      result = Record(status, k + l, SLAP_NO_ERROR, result);
+    }
+    k += lanes;
+  }
+  return result;
+}
+
+enum slap_ErrorCode slap_BatchedCholeskySolve(int batch_size, const Matrix* L,
+                                              const Matrix* b,
+                                              enum slap_ErrorCode* status) {
+  SLAP_ASSERT(batch_size == 0 || (L && b), SLAP_BAD_POINTER, SLAP_BAD_POINTER,
+              "BatchedCholeskySolve: got a NULL array");
+  return BatchedSolve(batch_size, L, b, status, true);
+}
+
+enum slap_ErrorCode slap_BatchedTriSolve(int batch_size, const Matrix* L, const Matrix* b,
+                                         enum slap_ErrorCode* status) {
+  SLAP_ASSERT(batch_size == 0 || (L && b), SLAP_BAD_POINTER, SLAP_BAD_POINTER,
+              "BatchedTriSolve: got a NULL array");
+  return BatchedSolve(batch_size, L, b, status, false);
+}
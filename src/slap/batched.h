@@ -0,0 +1,100 @@
+//
+// Created by Brian Jackson on 10/18/26.
+// Copyright (c) 2026 Robotic Exploration Lab. All rights reserved.
+//
+
+#pragma once
+
+#include "matrix.h"
+
+// Number of problems processed together. Groups of problems are copied into an
+// interleaved layout, with element (i,j) of every problem stored contiguously, so the
+// innermost loops run across problems and map directly onto SIMD lanes.
+// Problems larger than SLAP_BATCH_MAX_DIM in any dimension, or with a matrix that isn't of
+// type slap_DENSE, are solved one at a time.
+// The interleaved buffers live on the stack and take 2 * MAX_DIM^2 * WIDTH elements.
+#if defined(__AVR__)
+#ifndef SLAP_BATCH_WIDTH
+#define SLAP_BATCH_WIDTH 2
+#endif
+#ifndef SLAP_BATCH_MAX_DIM
+#define SLAP_BATCH_MAX_DIM 4
+#endif
+#else
+#ifndef SLAP_BATCH_WIDTH
+#define SLAP_BATCH_WIDTH 8
+#endif
+#ifndef SLAP_BATCH_MAX_DIM
+#define SLAP_BATCH_MAX_DIM 24
+#endif
+#endif
+
+/**
+ * @brief Compute \f$ C_i = \beta C_i + \alpha A_i B_i \f$ for a batch of independent
+ *        problems
+ *
+ * Consecutive problems with the same dimensions are processed `SLAP_BATCH_WIDTH` at a
+ * time. Each matrix can be transposed or strided independently. Problems that can't be
+ * batched (e.g. a triangular or diagonal matrix, or dimensions above
+ * `SLAP_BATCH_MAX_DIM`) are passed to slap_MatMulAdd().
+ *
+ * **Header File:** `slap/batched.h`
+ * @param[in] batch_size Number of problems
+ * @param[out] C Array of @p batch_size output matrices
+ * @param[in] A Array of @p batch_size left input matrices
+ * @param[in] B Array of @p batch_size right input matrices
+ * @param[in] alpha Scaling on the products
+ * @param[in] beta Scaling on the existing data in each C
+ * @return SLAP_NO_ERROR, or the first error encountered
+ */
+enum slap_ErrorCode slap_BatchedMatMulAdd(int batch_size, const Matrix* C, const Matrix* A,
+                                          const Matrix* B, sfloat alpha, sfloat beta);
+
+/**
+ * @brief Cholesky decomposition of a batch of independent matrices
+ *
+ * Same as calling slap_Cholesky() on each matrix. A matrix that isn't positive definite
+ * doesn't affect the rest of the batch; its status is set to SLAP_CHOLESKY_FAIL and its
+ * contents are unspecified.
+ *
+ * **Header File:** `slap/batched.h`
+ * @param[in] batch_size Number of problems
+ * @param[inout] A Array of @p batch_size square matrices
+ * @param[out] status Optional array of @p batch_size error codes, one for each problem.
+ *                    Can be NULL.
+ * @return SLAP_NO_ERROR if every factorization succeeded, or the first error encountered
+ */
+enum slap_ErrorCode slap_BatchedCholesky(int batch_size, const Matrix* A,
+                                         enum slap_ErrorCode* status);
+
+/**
+ * @brief Solve a batch of systems with precomputed Cholesky factors
+ *
+ * Same as calling slap_CholeskySolve() on each problem.
+ *
+ * **Header File:** `slap/batched.h`
+ * @param[in] batch_size Number of problems
+ * @param[in] L Array of @p batch_size Cholesky factors, e.g. from slap_BatchedCholesky()
+ * @param[inout] b Array of @p batch_size right-hand sides, overwritten with the solutions
+ * @param[out] status Optional array of @p batch_size error codes. Can be NULL.
+ * @return SLAP_NO_ERROR, or the first error encountered
+ */
+enum slap_ErrorCode slap_BatchedCholeskySolve(int batch_size, const Matrix* L,
+                                              const Matrix* b,
+                                              enum slap_ErrorCode* status);
+
+/**
+ * @brief Solve a batch of triangular systems
+ *
+ * Same as calling slap_TriSolve() on each problem, using the same convention for whether
+ * each @p L is treated as upper or lower triangular.
+ *
+ * **Header File:** `slap/batched.h`
+ * @param[in] batch_size Number of problems
+ * @param[in] L Array of @p batch_size triangular matrices
+ * @param[inout] b Array of @p batch_size right-hand sides, overwritten with the solutions
+ * @param[out] status Optional array of @p batch_size error codes. Can be NULL.
+ * @return SLAP_NO_ERROR, or the first error encountered
+ */
+enum slap_ErrorCode slap_BatchedTriSolve(int batch_size, const Matrix* L, const Matrix* b,
+                                         enum slap_ErrorCode* status);
@@ -7,14 +7,41 @@
 
 #include <math.h>
 
+#include "diagonal.h"
+#include "kernels.h"
+
 sfloat slap_NormedDifference(Matrix A, Matrix B) {
   SLAP_ASSERT_VALID(A, NAN, "MatrixNormedDifference: invalid A matrix");
   SLAP_ASSERT_VALID(B, NAN, "MatrixNormedDifference: invalid B matrix");
   SLAP_ASSERT_SAME_SIZE(A, B, NAN, "MatrixNormedDifference");
   sfloat diff = 0;
-  for (int i = 0; i < slap_NumElements(A); ++i) {
-    sfloat d = A.data[i] - B.data[i];
-    diff += d * d;
+  if (slap_GetType(A) == slap_DIAGONAL && slap_GetType(B) == slap_DIAGONAL) {
+    for (int k = 0; k < slap_NumRows(A); ++k) {
+      sfloat d = A.data[k] - B.data[k];
+      diff += d * d;
+    }
+    return sqrt(diff);
+  }
+  SLAP_ASSERT(!slap_IsStructured(A) && !slap_IsStructured(B), SLAP_INVALID_MATRIX, NAN,
+              "MatrixNormedDifference: band and packed matrices aren't supported, and "
+              "diagonal matrices can only be compared to each other");
+  if (A.is_transposed == B.is_transposed) {
+    // Same memory layout: compare contiguous columns of the underlying data
+    for (int j = 0; j < A.cols; ++j) {
+      const sfloat* Aj = A.data + j * A.sy;
+      const sfloat* Bj = B.data + j * B.sy;
+      for (int i = 0; i < A.rows; ++i) {
+        sfloat d = Aj[i] - Bj[i];
+        diff += d * d;
+      }
+    }
+  } else {
+    for (int j = 0; j < slap_NumCols(A); ++j) {
+      for (int i = 0; i < slap_NumRows(A); ++i) {
+        sfloat d = *slap_GetElementConst(A, i, j) - *slap_GetElementConst(B, i, j);
+        diff += d * d;
+      }
+    }
   }
   return sqrt(diff);
 }
@@ -24,8 +51,49 @@ enum slap_ErrorCode slap_MatrixAddition(Matrix C, Matrix A, Matrix B, sfloat alp
   SLAP_ASSERT_VALID(B, SLAP_INVALID_MATRIX, "MatAdd: B matrix invalid");
   SLAP_ASSERT_SAME_SIZE(A, B, SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS, "MatAdd");
   SLAP_ASSERT_SAME_SIZE(C, A, SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS, "MatAdd");
+  if (slap_GetType(A) == slap_DIAGONAL || slap_GetType(B) == slap_DIAGONAL ||
+      slap_GetType(C) == slap_DIAGONAL) {
+    return slap_DiagonalAddition(C, A, B, alpha);
+  }
+
+  // Band and packed matrices with the same structure add their stored elements
+  if (slap_IsStructured(A) || slap_IsStructured(B) || slap_IsStructured(C)) {
+    SLAP_ASSERT(slap_GetType(A) == slap_GetType(C) && slap_GetType(B) == slap_GetType(C) &&
+                    A.kl == C.kl && A.ku == C.ku && B.kl == C.kl && B.ku == C.ku &&
+                    A.is_transposed == C.is_transposed &&
+                    B.is_transposed == C.is_transposed,
+                SLAP_INVALID_MATRIX, SLAP_INVALID_MATRIX,
+                "MatAdd: band and packed matrices can only be added to matrices with the "
+                "same structure");
+  }
   int n = slap_NumRows(C);
   int m = slap_NumCols(C);
+
+  // Same memory layout: operate on contiguous columns of the underlying data
+  if (A.is_transposed == C.is_transposed && B.is_transposed == C.is_transposed) {
+    const slap_Kernels* kernels = slap_GetKernels();
+    int len = slap_StoredRows(C);
+    for (int j = 0; j < slap_StoredCols(C); ++j) {
+      sfloat* Cj = C.data + j * C.sy;
+      const sfloat* Aj = A.data + j * A.sy;
+      const sfloat* Bj = B.data + j * B.sy;
+      if (Cj == Aj) {
+        kernels->axpy(len, alpha, Bj, Cj);
+      } else if (Cj == Bj) {
+        for (int i = 0; i < len; ++i) {
+          Cj[i] *= alpha;
+        }
+        kernels->axpy(len, 1, Aj, Cj);
+      } else {
+        for (int i = 0; i < len; ++i) {
+          Cj[i] = Aj[i];
+        }
+        kernels->axpy(len, alpha, Bj, Cj);
+      }
+    }
+    return SLAP_NO_ERROR;
+  }
+
   for (int j = 0; j < m; ++j) {
     for (int i = 0; i < n; ++i) {
       sfloat Aij = *slap_GetElementConst(A, i, j);
@@ -0,0 +1,86 @@
+//
+// Created by Brian Jackson on 10/18/26.
+// Copyright (c) 2026 Robotic Exploration Lab. All rights reserved.
+//
+
+#include "blocktri.h"
+
+#include "cholesky.h"
+#include "matmul.h"
+#include "tri.h"
+
+enum slap_ErrorCode slap_BlockTriCholesky(int N, const Matrix* D, const Matrix* C,
+                                          int* fail_block) {
+  SLAP_ASSERT(D != NULL && (N <= 1 || C != NULL), SLAP_BAD_POINTER, SLAP_BAD_POINTER,
+              "BlockTriCholesky: block array is NULL");
+  if (fail_block) {
+    *fail_block = -1;
+  }
+  for (int k = 0; k < N; ++k) {
+    if (k > 0) {
+      // L[k,k-1] = C[k-1] L[k-1,k-1]^{-T}
+      Matrix Lprev = D[k - 1];
+      Matrix Lsub = C[k - 1];
+      SLAP_ASSERT(slap_NumRows(Lsub) == slap_NumRows(D[k]) &&
+                      slap_NumCols(Lsub) == slap_NumCols(Lprev),
+                  SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS, SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+                  "BlockTriCholesky: block %d of C has size (%d,%d), expected (%d,%d)",
+                  k - 1, slap_NumRows(Lsub), slap_NumCols(Lsub), slap_NumRows(D[k]),
+                  slap_NumCols(Lprev));
+      enum slap_ErrorCode err = slap_TriSolve(Lprev, slap_Transpose(Lsub));
+      if (err != SLAP_NO_ERROR) {
+        return err;
+      }
+
+      // D[k] -= L[k,k-1] L[k,k-1]'
+      err = slap_MatMulAdd(D[k], Lsub, slap_Transpose(Lsub), -1, 1);
+      if (err != SLAP_NO_ERROR) {
+        return err;
+      }
+    }
+    enum slap_ErrorCode err = slap_Cholesky(D[k]);
+    if (err != SLAP_NO_ERROR) {
+      if (fail_block && err == SLAP_CHOLESKY_FAIL) {
+        *fail_block = k;
+      }
+      return err;
+    }
+  }
+  return SLAP_NO_ERROR;
+}
+
+enum slap_ErrorCode slap_BlockTriCholeskySolve(int N, const Matrix* D, const Matrix* C,
+                                               const Matrix* b) {
+  SLAP_ASSERT(D != NULL && b != NULL && (N <= 1 || C != NULL), SLAP_BAD_POINTER,
+              SLAP_BAD_POINTER, "BlockTriCholeskySolve: block array is NULL");
+  enum slap_ErrorCode err;
+
+  // Solve L y = b
+  for (int k = 0; k < N; ++k) {
+    if (k > 0) {
+      err = slap_MatMulAdd(b[k], C[k - 1], b[k - 1], -1, 1);
+      if (err != SLAP_NO_ERROR) {
+        return err;
+      }
+    }
+    err = slap_TriSolve(D[k], b[k]);
+    if (err != SLAP_NO_ERROR) {
+      return err;
+    }
+  }
+
+  // Solve L' x = y
+  for (int k = N - 1; k >= 0; --k) {
+    if (k < N - 1) {
+      err = slap_MatMulAdd(b[k], slap_Transpose(C[k]), b[k + 1], -1, 1);
+      if (err != SLAP_NO_ERROR) {
+        return err;
+      }
+    }
+    err = slap_TriSolve(slap_Transpose(D[k]), b[k]);
+    if (err != SLAP_NO_ERROR) {
+      return err;
+    }
+  }
+  return SLAP_NO_ERROR;
+}
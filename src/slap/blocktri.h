@@ -0,0 +1,60 @@
+//
+// Created by Brian Jackson on 10/18/26.
+// Copyright (c) 2026 Robotic Exploration Lab. All rights reserved.
+//
+
+#pragma once
+
+#include "matrix.h"
+
+/**
+ * @brief Cholesky decomposition of a symmetric block-tridiagonal matrix
+ *
+ * Factors the positive-definite matrix
+ * \f[
+ * A = \begin{bmatrix}
+ *   D_0 & C_0^T \\
+ *   C_0 & D_1 & C_1^T \\
+ *       & C_1 & \ddots & \ddots \\
+ *       &     & \ddots & D_{N-1}
+ * \end{bmatrix}
+ * \f]
+ * as \f$ L L^T \f$, where \f$ L \f$ is block lower-bidiagonal, in time linear in the
+ * number of blocks. This is the structure of the KKT systems of model-predictive control
+ * problems, where the blocks are the stages of the horizon.
+ *
+ * Each step calls slap_Cholesky() and slap_TriSolve() on single blocks, so the blocks can
+ * have different sizes, be strided, or be views into a larger matrix. The factors are
+ * stored in place: the lower triangle of each @p D block is replaced by the diagonal
+ * block of \f$ L \f$, and each @p C block by the block of \f$ L \f$ below it. Once
+ * factored, the blocks can be passed to slap_BlockTriCholeskySolve() any number of times.
+ *
+ * The strictly upper triangles of the @p D blocks are overwritten.
+ *
+ * **Header File:** `slap/linalg.h`
+ * @param[in] N Number of diagonal blocks
+ * @param[inout] D Array of @p N square diagonal blocks. Block `k` has size
+ *                 \f$ n_k \times n_k \f$.
+ * @param[inout] C Array of `N - 1` sub-diagonal blocks. Block `k` has size
+ *                 \f$ n_{k+1} \times n_k \f$, and sits below @p D block `k`.
+ * @param[out] fail_block Index of the diagonal block where the factorization failed, or -1
+ *                        if it succeeded. Can be NULL.
+ * @return SLAP_NO_ERROR, or SLAP_CHOLESKY_FAIL if the matrix isn't positive definite
+ */
+enum slap_ErrorCode slap_BlockTriCholesky(int N, const Matrix* D, const Matrix* C,
+                                          int* fail_block);
+
+/**
+ * @brief Solve a block-tridiagonal system with a precomputed Cholesky decomposition
+ *
+ * **Header File:** `slap/linalg.h`
+ * @param[in] N Number of diagonal blocks
+ * @param[in] D Diagonal blocks factored by slap_BlockTriCholesky()
+ * @param[in] C Sub-diagonal blocks factored by slap_BlockTriCholesky()
+ * @param[inout] b Array of @p N blocks of the right-hand side, with any number of columns.
+ *                 Block `k` has \f$ n_k \f$ rows. Stores the solution upon completion of
+ *                 the function.
+ * @return slap error code
+ */
+enum slap_ErrorCode slap_BlockTriCholeskySolve(int N, const Matrix* D, const Matrix* C,
+                                               const Matrix* b);
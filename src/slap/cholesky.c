@@ -6,36 +6,268 @@
 #include "cholesky.h"
 
 #include <math.h>
+
+#include "band.h"
+#include "diagonal.h"
+#include "fixed_size.h"
+#include "kernels.h"
+#include "matmul.h"
+#include "packed.h"
 #include "tri.h"
 
-enum slap_ErrorCode slap_Cholesky(Matrix A) {
-  SLAP_ASSERT_VALID(A, SLAP_INVALID_MATRIX, "Cholesky: matrix invalid");
-  int n = slap_MinDim(A);
+// A dense view of an r x c block of A, starting at (i,j). A must not be transposed.
+static Matrix Block(Matrix A, int i, int j, int r, int c) {
+  Matrix block = A;
+  block.rows = r;
+  block.cols = c;
+  block.data = A.data + i + j * A.sy;
+  block.mattype = slap_DENSE;
+  return block;
+}
+
+// Left-looking factorization of the leading n x n block of A.
+// Returns the column with a non-positive pivot, or -1 if the factorization succeeded.
+static int CholeskyUnblocked(Matrix A, int n, const slap_Kernels* kernels) {
+  int rs = slap_RowStride(A);
+  int cs = slap_ColStride(A);
   for (int j = 0; j < n; ++j) {
+    sfloat* Ajj_ptr = A.data + j * rs + j * cs;
+    // A[j:n, j] -= A[j:n, k] * A[j, k]
     for (int k = 0; k < j; ++k) {
-      for (int i = j; i < n; ++i) {
-        sfloat* Aij = slap_GetElement(A, i, j);
-        sfloat Aik = *slap_GetElement(A, i, k);
-        sfloat Ajk = *slap_GetElement(A, j, k);
-        *Aij -= Aik * Ajk;
+      const sfloat* Ajk_ptr = A.data + j * rs + k * cs;
+      sfloat Ajk = *Ajk_ptr;
+      if (rs == 1) {
+        kernels->axpy(n - j, -Ajk, Ajk_ptr, Ajj_ptr);
+      } else {
+        for (int i = 0; i < n - j; ++i) {
+          Ajj_ptr[i * rs] -= Ajk_ptr[i * rs] * Ajk;
+        }
       }
     }
-    sfloat Ajj = *slap_GetElement(A, j, j);
+    sfloat Ajj = *Ajj_ptr;
     if (Ajj <= 0) {
-      return SLAP_CHOLESKY_FAIL;
+      return j;
     }
     sfloat ajj = sqrt(Ajj);
 
-    for (int i = j; i < n; ++i) {
-      sfloat* Aij = slap_GetElement(A, i, j);
-      *Aij /= ajj;
+    for (int i = 0; i < n - j; ++i) {
+      Ajj_ptr[i * rs] /= ajj;
     }
   }
-  return SLAP_NO_ERROR;
+  return -1;
+}
+
+void slap_LowerTransposeSolveRight(Matrix L, Matrix B, const slap_Kernels* kernels) {
+  int m = B.rows;
+  int n = B.cols;
+  for (int j = 0; j < n; ++j) {
+    sfloat* Bj = B.data + j * B.sy;
+    for (int p = 0; p < j; ++p) {
+      kernels->axpy(m, -L.data[j + p * L.sy], B.data + p * B.sy, Bj);
+    }
+    sfloat Ljj = L.data[j + j * L.sy];
+    for (int i = 0; i < m; ++i) {
+      Bj[i] /= Ljj;
+    }
+  }
+}
+
+// A[:, jb:jb+nb] -= B B[jb:jb+nb, :]', only touching the lower triangle of A.
+// The part of the block column below the diagonal block is a rectangular GEMM, leaving
+// only the small diagonal block to be done by hand.
+static void LowerRankKUpdate(Matrix A, Matrix B, int jb, int nb,
+                             const slap_Kernels* kernels) {
+  int n = A.rows;
+  int k = B.cols;
+  int b = n - jb < nb ? n - jb : nb;
+  for (int j = jb; j < jb + b; ++j) {
+    sfloat* Ajj = A.data + j + j * A.sy;
+    for (int p = 0; p < k; ++p) {
+      const sfloat* Bjp = B.data + j + p * B.sy;
+      kernels->axpy(jb + b - j, -*Bjp, Bjp, Ajj);
+    }
+  }
+  int below = n - jb - b;
+  if (below > 0) {
+    slap_MatMulAdd(Block(A, jb + b, jb, below, b), Block(B, jb + b, 0, below, k),
+                   slap_Transpose(Block(B, jb, 0, b, k)), -1, 1);
+  }
+}
+
+// Update of the trailing matrix after factoring a panel, split into independent tasks
+typedef struct {
+  Matrix L11;
+  Matrix L21;
+  Matrix A22;
+  int nb;
+  int rows_per_task;
+  const slap_Kernels* kernels;
+} TrailingUpdate;
+
+// L21 = A21 L11^{-T}, for a block of rows
+static void SolveTask(void* context, int task) {
+  const TrailingUpdate* update = (const TrailingUpdate*)context;
+  int m = update->L21.rows;
+  int i = task * update->rows_per_task;
+  int rows = m - i < update->rows_per_task ? m - i : update->rows_per_task;
+  slap_LowerTransposeSolveRight(update->L11,
+                                Block(update->L21, i, 0, rows, update->L21.cols),
+                                update->kernels);
+}
+
+// A22 -= L21 L21', for a block column
+static void UpdateTask(void* context, int task) {
+  const TrailingUpdate* update = (const TrailingUpdate*)context;
+  LowerRankKUpdate(update->A22, update->L21, task * update->nb, update->nb,
+                   update->kernels);
+}
+
+// Right-looking: factor a panel of nb columns, then update the trailing matrix.
+// Returns the column with a non-positive pivot, or -1 if the factorization succeeded.
+static int CholeskyBlocked(Matrix A, int n, slap_ThreadPool* pool,
+                           const slap_Kernels* kernels) {
+  const int nb = SLAP_CHOLESKY_BLOCK_SIZE;
+  int num_threads = slap_ThreadPoolNumThreads(pool);
+  for (int k = 0; k < n; k += nb) {
+    int kb = n - k < nb ? n - k : nb;
+    int fail = CholeskyUnblocked(Block(A, k, k, kb, kb), kb, kernels);
+    if (fail >= 0) {
+      return fail + k;
+    }
+    int m = n - k - kb;
+    if (m > 0) {
+      TrailingUpdate update = {Block(A, k, k, kb, kb),
+                               Block(A, k + kb, k, m, kb),
+                               Block(A, k + kb, k + kb, m, m),
+                               nb,
+                               (m + num_threads - 1) / num_threads,
+                               kernels};
+      bool parallel = (double)m * m * kb / 2 >= SLAP_PARALLEL_THRESHOLD;
+      slap_ThreadPool* step_pool = parallel ? pool : NULL;
+      int num_row_blocks = (m + update.rows_per_task - 1) / update.rows_per_task;
+      slap_ThreadPoolRun(step_pool, num_row_blocks, SolveTask, &update);
+      slap_ThreadPoolRun(step_pool, (m + nb - 1) / nb, UpdateTask, &update);
+    }
+  }
+  return -1;
+}
+
+static enum slap_ErrorCode Cholesky(Matrix A, slap_ThreadPool* pool, int* fail_col) {
+  SLAP_ASSERT_VALID(A, SLAP_INVALID_MATRIX, "Cholesky: matrix invalid");
+  if (slap_GetType(A) == slap_BANDED) {
+    return slap_BandCholesky(A, fail_col);
+  }
+  if (slap_GetType(A) == slap_DIAGONAL) {
+    return slap_DiagonalCholesky(A, fail_col);
+  }
+  if (slap_IsPacked(A)) {
+    return slap_PackedCholesky(A, fail_col);
+  }
+  int fail = -1;
+  if (!slap_CholeskyFixedSize(A, &fail)) {
+    int n = slap_MinDim(A);
+    const slap_Kernels* kernels = slap_GetKernels();
+    if (n <= SLAP_CHOLESKY_THRESHOLD || slap_IsTransposed(A)) {
+      fail = CholeskyUnblocked(A, n, kernels);
+    } else {
+      fail = CholeskyBlocked(A, n, pool, kernels);
+    }
+  }
+  if (fail_col) {
+    *fail_col = fail;
+  }
+  return fail < 0 ? SLAP_NO_ERROR : SLAP_CHOLESKY_FAIL;
+}
+
+size_t slap_CholeskyWorkspaceSize(int n) {
+  (void)n;
+  return 0;
+}
+
+enum slap_ErrorCode slap_Cholesky(Matrix A) { return Cholesky(A, NULL, NULL); }
+
+enum slap_ErrorCode slap_CholeskyInfo(Matrix A, int* fail_col) {
+  return Cholesky(A, NULL, fail_col);
+}
+
+enum slap_ErrorCode slap_CholeskyParallel(slap_ThreadPool* pool, Matrix A, int* fail_col) {
+  return Cholesky(A, pool, fail_col);
+}
+
+// Update (sign = 1) or downdate (sign = -1) L L' by X X', one column of L at a time,
+// applying the rotations for every column of X while the column of L is in cache.
+// Returns the column where a downdate lost positive-definiteness, or -1.
+static int CholeskyRankK(Matrix L, Matrix X, sfloat sign) {
+  int n = slap_NumRows(L);
+  int k = slap_NumCols(X);
+  int rs_L = slap_RowStride(L);
+  int cs_L = slap_ColStride(L);
+  int rs_X = slap_RowStride(X);
+  int cs_X = slap_ColStride(X);
+  for (int j = 0; j < n; ++j) {
+    sfloat* Ljj_ptr = L.data + j * rs_L + j * cs_L;
+    for (int p = 0; p < k; ++p) {
+      sfloat* xj_ptr = X.data + j * rs_X + p * cs_X;
+      sfloat xj = *xj_ptr;
+      if (xj == 0) {
+        continue;
+      }
+      sfloat Ljj = *Ljj_ptr;
+      sfloat r2 = Ljj * Ljj + sign * xj * xj;
+      if (r2 <= 0) {
+        return j;
+      }
+      sfloat r = sqrt(r2);
+      sfloat c = r / Ljj;
+      sfloat s = xj / Ljj;
+      sfloat c_inv = 1 / c;
+      *Ljj_ptr = r;
+
+      // L[j+1:n, j] = (L[j+1:n, j] + sign * s * x[j+1:n]) / c
+      // x[j+1:n] = c * x[j+1:n] - s * L[j+1:n, j]
+      sfloat* Lcol = Ljj_ptr + rs_L;
+      sfloat* x = xj_ptr + rs_X;
+      for (int i = 0; i < n - j - 1; ++i) {
+        sfloat Lij = (Lcol[i * rs_L] + sign * s * x[i * rs_X]) * c_inv;
+        Lcol[i * rs_L] = Lij;
+        x[i * rs_X] = c * x[i * rs_X] - s * Lij;
+      }
+    }
+  }
+  return -1;
+}
+
+static enum slap_ErrorCode CholeskyRankKChecked(Matrix L, Matrix X, sfloat sign,
+                                                int* fail_col) {
+  SLAP_ASSERT_VALID(L, SLAP_INVALID_MATRIX, "CholeskyUpdate: L matrix invalid");
+  SLAP_ASSERT_VALID(X, SLAP_INVALID_MATRIX, "CholeskyUpdate: X matrix invalid");
+  SLAP_ASSERT(slap_IsSquare(L), SLAP_MATRIX_NOT_SQUARE, SLAP_MATRIX_NOT_SQUARE,
+              "CholeskyUpdate: L must be square. Got size (%d,%d)", slap_NumRows(L),
+              slap_NumCols(L));
+  SLAP_ASSERT(slap_NumRows(L) == slap_NumRows(X), SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              "CholeskyUpdate: L has %d rows but X has %d rows", slap_NumRows(L),
+              slap_NumRows(X));
+  int fail = CholeskyRankK(L, X, sign);
+  if (fail_col) {
+    *fail_col = fail;
+  }
+  return fail < 0 ? SLAP_NO_ERROR : SLAP_CHOLESKY_FAIL;
+}
+
+enum slap_ErrorCode slap_CholeskyUpdate(Matrix L, Matrix X) {
+  return CholeskyRankKChecked(L, X, 1, NULL);
+}
+
+enum slap_ErrorCode slap_CholeskyDowndate(Matrix L, Matrix X, int* fail_col) {
+  return CholeskyRankKChecked(L, X, -1, fail_col);
 }
 
 enum slap_ErrorCode slap_CholeskySolve(const Matrix A, Matrix b) {
   // NOTE: Validity checks are done by the sub-methods
+  if (slap_CholeskySolveFixedSize(A, b)) {
+    return SLAP_NO_ERROR;
+  }
   enum slap_ErrorCode err;
   err = slap_TriSolve(A, b);
   if (err != SLAP_NO_ERROR) {
@@ -12,13 +12,30 @@
 
 #pragma once
 
+#include <stddef.h>
+
+#include "kernels.h"
 #include "matrix.h"
+#include "threads.h"
+
+// Matrices larger than SLAP_CHOLESKY_THRESHOLD are factored in panels of
+// SLAP_CHOLESKY_BLOCK_SIZE columns, so that most of the work is done by the blocked matrix
+// multiply
+#ifndef SLAP_CHOLESKY_BLOCK_SIZE
+#define SLAP_CHOLESKY_BLOCK_SIZE 32
+#endif
+#ifndef SLAP_CHOLESKY_THRESHOLD
+#define SLAP_CHOLESKY_THRESHOLD 128
+#endif
 
 /**
  * @brief Perform a Cholesky decomposition
  *
  * Performs a Cholesky decomposition on the square matrix @p A, storing the result in the
- * lower triangular portion of @p A.
+ * lower triangular portion of @p A. The strictly upper triangular portion is not modified.
+ *
+ * Matrices larger than `SLAP_CHOLESKY_THRESHOLD` are factored with a blocked,
+ * right-looking algorithm that does most of its work in slap_MatMulAdd().
  *
  * **Header File:** `slap/linalg.h`
  * @param  A a square symmetric matrix
@@ -28,6 +45,80 @@
  */
 enum slap_ErrorCode slap_Cholesky(Matrix A);
 
+/**
+ * @brief Arena bytes needed for the workspace of slap_Cholesky()
+ *
+ * Always 0, since the factorization is done in place.
+ *
+ * **Header File:** `slap/linalg.h`
+ * @param n Size of the matrix being factored
+ */
+size_t slap_CholeskyWorkspaceSize(int n);
+
+/**
+ * @brief Perform a Cholesky decomposition, reporting where it failed
+ *
+ * Same as slap_Cholesky(), but also reports the column of the first non-positive pivot.
+ * On failure, the columns before @p fail_col contain a valid partial factorization.
+ *
+ * **Header File:** `slap/linalg.h`
+ * @param  A a square symmetric matrix
+ * @param[out] fail_col Column where the factorization failed, or -1 if it succeeded.
+ *                      Can be NULL.
+ * @return SLAP_NO_ERROR, or SLAP_CHOLESKY_FAIL if the matrix isn't positive definite
+ */
+enum slap_ErrorCode slap_CholeskyInfo(Matrix A, int* fail_col);
+
+/**
+ * @brief Multithreaded Cholesky decomposition
+ *
+ * Same as slap_CholeskyInfo(), but for matrices larger than `SLAP_CHOLESKY_THRESHOLD` the
+ * update of the trailing matrix after each panel is split across the threads in @p pool.
+ * The panels themselves are factored on the calling thread.
+ *
+ * **Header File:** `slap/linalg.h`
+ * @param pool Thread pool from slap_ThreadPoolCreate(). Can be NULL.
+ * @param  A a square symmetric matrix
+ * @param[out] fail_col Column where the factorization failed, or -1 if it succeeded.
+ *                      Can be NULL.
+ * @return SLAP_NO_ERROR, or SLAP_CHOLESKY_FAIL if the matrix isn't positive definite
+ */
+enum slap_ErrorCode slap_CholeskyParallel(slap_ThreadPool* pool, Matrix A, int* fail_col);
+
+/**
+ * @brief Rank-k update of a Cholesky factorization
+ *
+ * Given the factor \f$ L \f$ of \f$ A = L L^T \f$, computes the factor of
+ * \f$ A + X X^T \f$ in \f$ O(n^2 k) \f$ time using Givens rotations, instead of
+ * refactoring the matrix in \f$ O(n^3) \f$.
+ *
+ * The rotations for all of the columns of @p X are applied in a single pass over the
+ * columns of @p L. Only the lower triangle of @p L is used.
+ *
+ * **Header File:** `slap/linalg.h`
+ * @param[inout] L Cholesky factor, e.g. from slap_Cholesky()
+ * @param[inout] X An n x k matrix. Overwritten (used as workspace).
+ * @return slap error code
+ */
+enum slap_ErrorCode slap_CholeskyUpdate(Matrix L, Matrix X);
+
+/**
+ * @brief Rank-k downdate of a Cholesky factorization
+ *
+ * Given the factor \f$ L \f$ of \f$ A = L L^T \f$, computes the factor of
+ * \f$ A - X X^T \f$ in \f$ O(n^2 k) \f$ time using hyperbolic rotations.
+ *
+ * If \f$ A - X X^T \f$ isn't positive definite the downdate stops, leaving @p L and @p X
+ * in an unspecified state, so the matrix needs to be refactored.
+ *
+ * **Header File:** `slap/linalg.h`
+ * @param[inout] L Cholesky factor, e.g. from slap_Cholesky()
+ * @param[inout] X An n x k matrix. Overwritten (used as workspace).
+ * @param[out] fail_col Column of @p L where the downdate failed, or -1 if it succeeded.
+ *                      Can be NULL.
+ * @return SLAP_NO_ERROR, or SLAP_CHOLESKY_FAIL if the result isn't positive definite
+ */
+enum slap_ErrorCode slap_CholeskyDowndate(Matrix L, Matrix X, int* fail_col);
 
 /**
  * @brief Solve a linear system of equation with a precomputed Cholesky decomposition.
@@ -59,3 +150,18 @@ enum slap_ErrorCode slap_Cholesky(Matrix A);
  * @return slap error code
  */
 enum slap_ErrorCode slap_CholeskySolve(Matrix A, Matrix b);
+
+/**
+ * @brief Solve \f$ X L^T = B \f$ for a lower triangular matrix \f$ L \f$
+ *
+ * Overwrites @p B with \f$ X \f$, a column at a time with the `axpy` kernel. This is the
+ * panel solve shared by the blocked dense and the supernodal sparse Cholesky
+ * factorizations, so it doesn't check its arguments.
+ *
+ * **Header File:** `slap/cholesky.h`
+ * @param[in]    L A dense, non-transposed square matrix with as many columns as @p B.
+ *                 Only its lower triangle is read.
+ * @param[inout] B A dense, non-transposed matrix. Stores the solution upon completion.
+ * @param[in]    kernels Kernels from slap_GetKernels()
+ */
+void slap_LowerTransposeSolveRight(Matrix L, Matrix B, const slap_Kernels* kernels);
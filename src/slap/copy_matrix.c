@@ -5,6 +5,8 @@
 
 #include "copy_matrix.h"
 
+#include <string.h>
+
 #include "iterator.h"
 #include "matrix_checks.h"
 
@@ -14,6 +16,34 @@ enum slap_ErrorCode slap_Copy(Matrix dest, Matrix src) {
   SLAP_ASSERT_VALID(src, SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
                     "MatrixCopy: invalid source matrix");
   SLAP_ASSERT_SAME_SIZE(dest, src, SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS, "MatrixCopy");
+
+  // Structured matrices can only be copied to matrices with the same structure
+  if (slap_IsStructured(src) || slap_IsStructured(dest)) {
+    SLAP_ASSERT(dest.mattype == src.mattype && dest.kl == src.kl && dest.ku == src.ku &&
+                    (dest.is_transposed == src.is_transposed ||
+                     src.mattype == slap_DIAGONAL),
+                SLAP_INVALID_MATRIX, SLAP_INVALID_MATRIX,
+                "MatrixCopy: band, diagonal and packed matrices must be copied to a "
+                "matrix with the same structure");
+    int rows = slap_StoredRows(src);
+    int cols = slap_StoredCols(src);
+    for (int j = 0; j < cols; ++j) {
+      memmove(dest.data + j * dest.sy, src.data + j * src.sy, rows * sizeof(sfloat));
+    }
+    return SLAP_NO_ERROR;
+  }
+
+  // Same memory layout: copy contiguous columns of the underlying data
+  if (dest.is_transposed == src.is_transposed) {
+    if (dest.data == src.data && dest.sy == src.sy) {
+      return SLAP_NO_ERROR;
+    }
+    for (int j = 0; j < src.cols; ++j) {
+      memmove(dest.data + j * dest.sy, src.data + j * src.sy, src.rows * sizeof(sfloat));
+    }
+    return SLAP_NO_ERROR;
+  }
+
   int n = slap_NumRows(src);
   int m = slap_NumCols(src);
   for (int j = 0; j < m; ++j) {
@@ -21,7 +51,6 @@ enum slap_ErrorCode slap_Copy(Matrix dest, Matrix src) {
       slap_SetElement(dest, i, j, *slap_GetElement(src, i, j));
     }
   }
-  //  memcpy(dest.data, src.data, slap_NumElements(dest) * sizeof(sfloat));
   return SLAP_NO_ERROR;
 }
 
@@ -49,6 +78,8 @@ enum slap_ErrorCode slap_CopyFromArray(Matrix mat, const sfloat* data) {
   SLAP_ASSERT_VALID(mat, SLAP_INVALID_MATRIX, "CopyFromArray: invalid matrix");
   SLAP_ASSERT(data != NULL, SLAP_BAD_POINTER, SLAP_BAD_POINTER,
               "CopyFromArray: Can't copy from raw array, pointer is NULL");
+  SLAP_ASSERT(!slap_IsStructured(mat), SLAP_INVALID_MATRIX, SLAP_INVALID_MATRIX,
+              "CopyFromArray: band, diagonal and packed matrices aren't supported");
   for (MatrixIterator it = slap_Iterator(mat); !slap_IsFinished(&it); slap_Step(&it)) {
     mat.data[it.index] = data[it.k];
   }
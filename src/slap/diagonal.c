@@ -0,0 +1,206 @@
+//
+// Created by Brian Jackson on 10/18/26.
+// Copyright (c) 2026 Robotic Exploration Lab. All rights reserved.
+//
+
+#include "diagonal.h"
+
+#include <math.h>
+
+#include "copy_matrix.h"
+#include "kernels.h"
+#include "unary_ops.h"
+
+static inline bool IsDiagonal(Matrix A) { return slap_GetType(A) == slap_DIAGONAL; }
+
+// Matrices other than the diagonal ones must be stored densely (possibly strided)
+static inline bool IsSupported(Matrix A) {
+  return IsDiagonal(A) || slap_GetType(A) == slap_DENSE;
+}
+
+// Same data with the same layout, so copying from one to the other can be skipped
+static bool IsSame(Matrix A, Matrix B) {
+  return A.data == B.data && A.sy == B.sy && A.is_transposed == B.is_transposed;
+}
+
+enum slap_ErrorCode slap_DiagonalMatMulAdd(Matrix C, Matrix A, Matrix B, sfloat alpha,
+                                           sfloat beta) {
+  SLAP_ASSERT_VALID(C, SLAP_INVALID_MATRIX, "DiagonalMatMulAdd: invalid C matrix");
+  SLAP_ASSERT_VALID(A, SLAP_INVALID_MATRIX, "DiagonalMatMulAdd: invalid A matrix");
+  SLAP_ASSERT_VALID(B, SLAP_INVALID_MATRIX, "DiagonalMatMulAdd: invalid B matrix");
+  SLAP_ASSERT(slap_NumRows(C) == slap_NumRows(A), SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              "DiagonalMatMulAdd: Rows of C (%d) not equal to Rows of A (%d).",
+              slap_NumRows(C), slap_NumRows(A));
+  SLAP_ASSERT(slap_NumCols(A) == slap_NumRows(B), SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              "DiagonalMatMulAdd: Columns of A (%d) not equal to Rows of B (%d).",
+              slap_NumCols(A), slap_NumRows(B));
+  SLAP_ASSERT(slap_NumCols(C) == slap_NumCols(B), SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              "DiagonalMatMulAdd: Columns of C (%d) not equal to Columns of B (%d).",
+              slap_NumCols(C), slap_NumCols(B));
+  SLAP_ASSERT(IsSupported(A) && IsSupported(B) && IsSupported(C), SLAP_INVALID_MATRIX,
+              SLAP_INVALID_MATRIX,
+              "DiagonalMatMulAdd: other matrices must be dense or diagonal");
+  SLAP_ASSERT(!IsDiagonal(C) || (IsDiagonal(A) && IsDiagonal(B)), SLAP_INVALID_MATRIX,
+              SLAP_INVALID_MATRIX,
+              "DiagonalMatMulAdd: C can only be diagonal if A and B are diagonal");
+  int n = slap_NumRows(C);
+  int m = slap_NumCols(C);
+
+  if (IsDiagonal(C)) {
+    for (int k = 0; k < n; ++k) {
+      sfloat Ck = beta == 0 ? 0 : beta * C.data[k];
+      C.data[k] = Ck + alpha * A.data[k] * B.data[k];
+    }
+    return SLAP_NO_ERROR;
+  }
+
+  if (beta == 0) {
+    slap_SetConst(C, 0);
+  } else if (beta != 1) {
+    slap_ScaleByConst(C, beta);
+  }
+  int rs_C = slap_RowStride(C);
+  int cs_C = slap_ColStride(C);
+
+  if (IsDiagonal(A) && IsDiagonal(B)) {
+    for (int k = 0; k < n; ++k) {
+      C.data[k * (rs_C + cs_C)] += alpha * A.data[k] * B.data[k];
+    }
+  } else if (IsDiagonal(A)) {
+    // Scale the rows of B
+    int rs_B = slap_RowStride(B);
+    int cs_B = slap_ColStride(B);
+    for (int j = 0; j < m; ++j) {
+      sfloat* Cj = C.data + j * cs_C;
+      const sfloat* Bj = B.data + j * cs_B;
+      for (int i = 0; i < n; ++i) {
+        Cj[i * rs_C] += alpha * A.data[i] * Bj[i * rs_B];
+      }
+    }
+  } else {
+    // Scale the columns of A
+    int rs_A = slap_RowStride(A);
+    int cs_A = slap_ColStride(A);
+    const slap_Kernels* kernels = slap_GetKernels();
+    for (int j = 0; j < m; ++j) {
+      sfloat* Cj = C.data + j * cs_C;
+      const sfloat* Aj = A.data + j * cs_A;
+      sfloat Bjj = alpha * B.data[j];
+      if (rs_A == 1 && rs_C == 1) {
+        kernels->axpy(n, Bjj, Aj, Cj);
+      } else {
+        for (int i = 0; i < n; ++i) {
+          Cj[i * rs_C] += Bjj * Aj[i * rs_A];
+        }
+      }
+    }
+  }
+  return SLAP_NO_ERROR;
+}
+
+enum slap_ErrorCode slap_DiagonalAddition(Matrix C, Matrix A, Matrix B, sfloat alpha) {
+  SLAP_ASSERT_VALID(C, SLAP_INVALID_MATRIX, "DiagonalAddition: C matrix invalid");
+  SLAP_ASSERT_VALID(A, SLAP_INVALID_MATRIX, "DiagonalAddition: A matrix invalid");
+  SLAP_ASSERT_VALID(B, SLAP_INVALID_MATRIX, "DiagonalAddition: B matrix invalid");
+  SLAP_ASSERT_SAME_SIZE(A, B, SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS, "DiagonalAddition");
+  SLAP_ASSERT_SAME_SIZE(C, A, SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS, "DiagonalAddition");
+  SLAP_ASSERT(IsSupported(A) && IsSupported(B) && IsSupported(C), SLAP_INVALID_MATRIX,
+              SLAP_INVALID_MATRIX,
+              "DiagonalAddition: other matrices must be dense or diagonal");
+  SLAP_ASSERT(!IsDiagonal(C) || (IsDiagonal(A) && IsDiagonal(B)), SLAP_INVALID_MATRIX,
+              SLAP_INVALID_MATRIX,
+              "DiagonalAddition: C can only be diagonal if A and B are diagonal");
+  int n = slap_NumRows(C);
+
+  if (IsDiagonal(C)) {
+    for (int k = 0; k < n; ++k) {
+      C.data[k] = A.data[k] + alpha * B.data[k];
+    }
+    return SLAP_NO_ERROR;
+  }
+
+  // Start with the dense part, then add the diagonal of the other one
+  sfloat scale = 1;
+  Matrix D;
+  if (IsDiagonal(A) && IsDiagonal(B)) {
+    slap_SetConst(C, 0);
+    for (int k = 0; k < n; ++k) {
+      *slap_GetElement(C, k, k) = A.data[k];
+    }
+    D = B;
+    scale = alpha;
+  } else if (IsDiagonal(A)) {
+    if (!IsSame(C, B)) {
+      slap_Copy(C, B);
+    }
+    slap_ScaleByConst(C, alpha);
+    D = A;
+  } else {
+    if (!IsSame(C, A)) {
+      slap_Copy(C, A);
+    }
+    D = B;
+    scale = alpha;
+  }
+  for (int k = 0; k < n; ++k) {
+    *slap_GetElement(C, k, k) += scale * D.data[k];
+  }
+  return SLAP_NO_ERROR;
+}
+
+sfloat slap_DiagonalQuadraticForm(Matrix y, Matrix D, Matrix x) {
+  SLAP_ASSERT_VALID(y, NAN, "DiagonalQuadraticForm: y vector not valid");
+  SLAP_ASSERT_VALID(D, NAN, "DiagonalQuadraticForm: D matrix not valid");
+  SLAP_ASSERT_VALID(x, NAN, "DiagonalQuadraticForm: x vector not valid");
+  SLAP_ASSERT_DENSE(y, NAN, "DiagonalQuadraticForm: y matrix must be dense");
+  SLAP_ASSERT_DENSE(x, NAN, "DiagonalQuadraticForm: x matrix must be dense");
+  int n = slap_NumRows(D);
+  SLAP_ASSERT(slap_NumElements(y) == n && slap_NumElements(x) == n,
+              SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS, NAN,
+              "DiagonalQuadraticForm: vectors must have length %d", n);
+  sfloat out = 0;
+  for (int k = 0; k < n; ++k) {
+    out += y.data[k] * D.data[k] * x.data[k];
+  }
+  return out;
+}
+
+enum slap_ErrorCode slap_DiagonalTriSolve(Matrix D, Matrix b) {
+  SLAP_ASSERT_VALID(D, SLAP_INVALID_MATRIX, "DiagonalTriSolve: D matrix invalid");
+  SLAP_ASSERT_VALID(b, SLAP_INVALID_MATRIX, "DiagonalTriSolve: b matrix invalid");
+  SLAP_ASSERT(slap_NumCols(D) == slap_NumRows(b), SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              "DiagonalTriSolve: D has %d columns but b has %d rows", slap_NumCols(D),
+              slap_NumRows(b));
+  int n = slap_NumRows(b);
+  int m = slap_NumCols(b);
+  int rs_b = slap_RowStride(b);
+  int cs_b = slap_ColStride(b);
+  for (int j = 0; j < m; ++j) {
+    sfloat* bj = b.data + j * cs_b;
+    for (int i = 0; i < n; ++i) {
+      bj[i * rs_b] /= D.data[i];
+    }
+  }
+  return SLAP_NO_ERROR;
+}
+
+enum slap_ErrorCode slap_DiagonalCholesky(Matrix D, int* fail_col) {
+  SLAP_ASSERT_VALID(D, SLAP_INVALID_MATRIX, "DiagonalCholesky: matrix invalid");
+  int n = slap_NumRows(D);
+  int fail = -1;
+  for (int k = 0; k < n; ++k) {
+    if (D.data[k] <= 0) {
+      fail = k;
+      break;
+    }
+    D.data[k] = sqrt(D.data[k]);
+  }
+  if (fail_col) {
+    *fail_col = fail;
+  }
+  return fail < 0 ? SLAP_NO_ERROR : SLAP_CHOLESKY_FAIL;
+}
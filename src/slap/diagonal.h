@@ -0,0 +1,90 @@
+//
+// Created by Brian Jackson on 10/18/26.
+// Copyright (c) 2026 Robotic Exploration Lab. All rights reserved.
+//
+
+#pragma once
+
+#include "matrix.h"
+
+/**
+ * @brief Matrix multiplication with a diagonal matrix
+ *
+ * Computes \f$ C = \beta C + \alpha A B \f$ when @p A and/or @p B has type
+ * `slap_DIAGONAL`, by scaling the rows of @p B or the columns of @p A. This takes
+ * \f$ O(n m) \f$ instead of the \f$ O(n^2 m) \f$ of a dense multiplication. The other
+ * matrix can be strided or transposed. @p C can only be diagonal if both @p A and @p B
+ * are.
+ *
+ * Called by slap_MatMulAdd() when any of the matrices is diagonal.
+ *
+ * **Header File:** `slap/linalg.h`
+ * @param[out] C Output matrix
+ * @param[in] A Input matrix
+ * @param[in] B Input matrix
+ * @param[in] alpha scaling on the product
+ * @param[in] beta scaling on the original value of @p C
+ * @return slap error code
+ */
+enum slap_ErrorCode slap_DiagonalMatMulAdd(Matrix C, Matrix A, Matrix B, sfloat alpha,
+                                           sfloat beta);
+
+/**
+ * @brief Add two matrices when at least one of them is diagonal
+ *
+ * Calculates \f$ C = A + \alpha B \f$, touching only the diagonal of the dense
+ * operand. @p C can only be diagonal if both @p A and @p B are. Like
+ * slap_MatrixAddition(), @p C can be aliased with @p A or @p B.
+ *
+ * Called by slap_MatrixAddition() when any of the matrices is diagonal.
+ *
+ * **Header File:** `slap/linalg.h`
+ * @param[out] C Destination matrix
+ * @param[in] A Input matrix
+ * @param[in] B Input matrix
+ * @param alpha Scaling on B
+ * @return slap error code
+ */
+enum slap_ErrorCode slap_DiagonalAddition(Matrix C, Matrix A, Matrix B, sfloat alpha);
+
+/**
+ * @brief Calculate \f$ y^T D x \f$ for a diagonal matrix \f$ D \f$
+ *
+ * Called by slap_QuadraticForm() when @p D is diagonal.
+ *
+ * **Header File:** `slap/linalg.h`
+ * @param y A dense vector of length n
+ * @param D A diagonal matrix of size (n,n)
+ * @param x A dense vector of length n
+ * @return The scaled inner product, or NAN if invalid.
+ */
+sfloat slap_DiagonalQuadraticForm(Matrix y, Matrix D, Matrix x);
+
+/**
+ * @brief Solve \f$ D x = b \f$ for a diagonal matrix \f$ D \f$
+ *
+ * Called by slap_TriSolve() when @p D is diagonal, so a diagonal Cholesky factor can be
+ * passed to slap_CholeskySolve().
+ *
+ * **Header File:** `slap/linalg.h`
+ * @param[in] D A diagonal matrix
+ * @param[inout] b The right-hand side, with any number of columns. Stores the solution
+ *                 upon completion of the function.
+ * @return slap error code
+ */
+enum slap_ErrorCode slap_DiagonalTriSolve(Matrix D, Matrix b);
+
+/**
+ * @brief Cholesky decomposition of a diagonal matrix
+ *
+ * Replaces each diagonal element by its square root.
+ *
+ * Called by slap_Cholesky() when @p D is diagonal.
+ *
+ * **Header File:** `slap/linalg.h`
+ * @param[inout] D A diagonal matrix
+ * @param[out] fail_col Index of the first element that isn't positive, or -1 if the
+ *                      factorization succeeded. Can be NULL.
+ * @return SLAP_NO_ERROR, or SLAP_CHOLESKY_FAIL if the matrix isn't positive definite
+ */
+enum slap_ErrorCode slap_DiagonalCholesky(Matrix D, int* fail_col);
@@ -0,0 +1,330 @@
+//
+// Created by Brian Jackson on 10/18/26.
+// Copyright (c) 2026 Robotic Exploration Lab. All rights reserved.
+//
+
+#include "eigen.h"
+
+#include <float.h>
+#include <math.h>
+
+#include "arena.h"
+#include "kernels.h"
+#include "qr.h"
+#include "strided_matrix.h"
+#include "unary_ops.h"
+
+#define EPS (sizeof(sfloat) == sizeof(float) ? FLT_EPSILON : DBL_EPSILON)
+
+static inline bool IsNull(Matrix A) { return A.data == NULL; }
+
+// sqrt(a^2 + b^2) without overflow. Much faster than hypot() from libm, which also
+// guarantees the last bit.
+static inline sfloat Hypot(sfloat a, sfloat b) {
+  a = fabs(a);
+  b = fabs(b);
+  sfloat big = a > b ? a : b;
+  sfloat small = a > b ? b : a;
+  if (big == 0) {
+    return 0;
+  }
+  sfloat ratio = small / big;
+  return big * sqrt(1 + ratio * ratio);
+}
+
+// Copy the lower triangle of A to the upper triangle
+static void Symmetrize(Matrix A) {
+  int n = slap_NumRows(A);
+  for (int j = 0; j < n; ++j) {
+    for (int i = j + 1; i < n; ++i) {
+      *slap_GetElement(A, j, i) = *slap_GetElement(A, i, j);
+    }
+  }
+}
+
+// Sort the eigenvalues in ascending order, along with the columns of V
+static void SortEigenvalues(int n, sfloat* d, Matrix V) {
+  for (int i = 0; i < n - 1; ++i) {
+    int k = i;
+    for (int j = i + 1; j < n; ++j) {
+      if (d[j] < d[k]) {
+        k = j;
+      }
+    }
+    if (k == i) {
+      continue;
+    }
+    sfloat tmp = d[i];
+    d[i] = d[k];
+    d[k] = tmp;
+    if (!IsNull(V)) {
+      for (int r = 0; r < n; ++r) {
+        sfloat* Vri = slap_GetElement(V, r, i);
+        sfloat* Vrk = slap_GetElement(V, r, k);
+        tmp = *Vri;
+        *Vri = *Vrk;
+        *Vrk = tmp;
+      }
+    }
+  }
+}
+
+// Cyclic Jacobi rotations for small matrices, on a copy kept in registers
+static enum slap_ErrorCode JacobiSmall(Matrix A, sfloat* d, Matrix V) {
+  enum { N = SLAP_EIGEN_JACOBI_SIZE };
+  int n = slap_NumRows(A);
+  sfloat a[N][N];
+  sfloat v[N][N];
+  sfloat norm = 0;
+  for (int j = 0; j < n; ++j) {
+    for (int i = j; i < n; ++i) {
+      a[i][j] = *slap_GetElement(A, i, j);
+      a[j][i] = a[i][j];
+      norm += a[i][j] * a[i][j];
+    }
+    for (int i = 0; i < n; ++i) {
+      v[i][j] = i == j;
+    }
+  }
+
+  bool converged = false;
+  for (int sweep = 0; sweep < SLAP_EIGEN_MAX_ITER; ++sweep) {
+    sfloat off = 0;
+    for (int q = 1; q < n; ++q) {
+      for (int p = 0; p < q; ++p) {
+        off += a[p][q] * a[p][q];
+      }
+    }
+    if (off <= EPS * EPS * norm) {
+      converged = true;
+      break;
+    }
+
+    // Zero a[p][q] with the rotation J = [c s; -s c], A = J' A J
+    for (int q = 1; q < n; ++q) {
+      for (int p = 0; p < q; ++p) {
+        if (a[p][q] == 0) {
+          continue;
+        }
+        sfloat theta = (a[q][q] - a[p][p]) / (2 * a[p][q]);
+        sfloat t = (theta >= 0 ? 1 : -1) / (fabs(theta) + sqrt(theta * theta + 1));
+        sfloat c = 1 / sqrt(t * t + 1);
+        sfloat s = t * c;
+        for (int k = 0; k < n; ++k) {
+          sfloat akp = a[k][p];
+          sfloat akq = a[k][q];
+          a[k][p] = c * akp - s * akq;
+          a[k][q] = s * akp + c * akq;
+        }
+        for (int k = 0; k < n; ++k) {
+          sfloat apk = a[p][k];
+          sfloat aqk = a[q][k];
+          a[p][k] = c * apk - s * aqk;
+          a[q][k] = s * apk + c * aqk;
+        }
+        for (int k = 0; k < n; ++k) {
+          sfloat vkp = v[k][p];
+          sfloat vkq = v[k][q];
+          v[k][p] = c * vkp - s * vkq;
+          v[k][q] = s * vkp + c * vkq;
+        }
+      }
+    }
+  }
+
+  for (int k = 0; k < n; ++k) {
+    d[k] = a[k][k];
+  }
+  if (!IsNull(V)) {
+    for (int j = 0; j < n; ++j) {
+      for (int i = 0; i < n; ++i) {
+        slap_SetElement(V, i, j, v[i][j]);
+      }
+    }
+  }
+  SortEigenvalues(n, d, V);
+  if (!converged) {
+    return SLAP_ERROR(SLAP_NOT_CONVERGED, "SymmetricEigen: Jacobi didn't converge");
+  }
+  return SLAP_NO_ERROR;
+}
+
+// Householder reduction to tridiagonal form, T = Q' A Q. A must be symmetric, with
+// contiguous columns. The reflection for column k zeros A[k+2:n, k] and is stored there,
+// normalized so its first element (in row k+1) is 1, as in slap_QR().
+static void Tridiagonalize(Matrix A, sfloat* d, sfloat* e, sfloat* betas, sfloat* p) {
+  int n = A.rows;
+  int sy = A.sy;
+  const slap_Kernels* kernels = slap_GetKernels();
+  for (int k = 0; k < n - 2; ++k) {
+    int m = n - k - 1;
+    sfloat* y = A.data + (k + 1) + k * sy;
+    sfloat sigma = kernels->dot(m - 1, y + 1, y + 1);
+    sfloat x0 = y[0];
+    if (sigma == 0) {
+      e[k] = x0;
+      betas[k] = 0;
+      continue;
+    }
+
+    // Reflect x to mu * e_1, avoiding cancellation in v0 = x0 - mu
+    sfloat mu = sqrt(x0 * x0 + sigma);
+    sfloat v0 = x0 <= 0 ? x0 - mu : -sigma / (x0 + mu);
+    sfloat beta = 2 * v0 * v0 / (sigma + v0 * v0);
+    for (int i = 1; i < m; ++i) {
+      y[i] /= v0;
+    }
+    y[0] = 1;
+
+    // A22 = H A22 H = A22 - y w' - w y', with w = p - (beta / 2) (p'y) y and p = beta A22 y
+    sfloat* A22 = A.data + (k + 1) + (k + 1) * sy;
+    for (int i = 0; i < m; ++i) {
+      p[i] = 0;
+    }
+    for (int j = 0; j < m; ++j) {
+      kernels->axpy(m, beta * y[j], A22 + j * sy, p);
+    }
+    kernels->axpy(m, -beta / 2 * kernels->dot(m, p, y), y, p);
+    for (int j = 0; j < m; ++j) {
+      sfloat* A22j = A22 + j * sy;
+      kernels->axpy(m, -p[j], y, A22j);
+      kernels->axpy(m, -y[j], p, A22j);
+    }
+    e[k] = mu;
+    betas[k] = beta;
+    y[0] = mu;
+  }
+  if (n > 1) {
+    e[n - 2] = A.data[(n - 1) + (n - 2) * sy];
+    betas[n - 2] = 0;
+  }
+  for (int k = 0; k < n; ++k) {
+    d[k] = A.data[k + k * sy];
+  }
+}
+
+// Implicit QL iterations with Wilkinson shifts on the symmetric tridiagonal matrix with
+// diagonal d and off-diagonal e, applying the rotations to the columns of V
+static enum slap_ErrorCode TridiagonalQL(int n, sfloat* d, sfloat* e, Matrix V) {
+  e[n - 1] = 0;
+  for (int l = 0; l < n; ++l) {
+    int iter = 0;
+    int m;
+    do {
+      // Look for a negligible off-diagonal element to split the matrix
+      for (m = l; m < n - 1; ++m) {
+        sfloat dd = fabs(d[m]) + fabs(d[m + 1]);
+        if (fabs(e[m]) <= EPS * dd) {
+          break;
+        }
+      }
+      if (m == l) {
+        break;
+      }
+      if (iter++ == SLAP_EIGEN_MAX_ITER) {
+        return SLAP_ERROR(SLAP_NOT_CONVERGED,
+                          "SymmetricEigen: eigenvalue %d didn't converge", l);
+      }
+
+      // Shift by the eigenvalue of the leading 2x2 block closest to d[l]
+      sfloat g = (d[l + 1] - d[l]) / (2 * e[l]);
+      sfloat r = Hypot(g, 1);
+      g = d[m] - d[l] + e[l] / (g + copysign(r, g));
+      sfloat s = 1;
+      sfloat c = 1;
+      sfloat p = 0;
+      int i;
+      for (i = m - 1; i >= l; --i) {
+        sfloat f = s * e[i];
+        sfloat b = c * e[i];
+        r = Hypot(f, g);
+        e[i + 1] = r;
+        if (r == 0) {
+          // Underflow: the matrix splits, so start over from the top
+          d[i + 1] -= p;
+          e[m] = 0;
+          break;
+        }
+        s = f / r;
+        c = g / r;
+        g = d[i + 1] - p;
+        r = (d[i] - g) * s + 2 * c * b;
+        p = s * r;
+        d[i + 1] = g + p;
+        g = c * r - b;
+        if (!IsNull(V)) {
+          sfloat* Vi = V.data + i * V.sy;
+          sfloat* Vi1 = Vi + V.sy;
+          for (int k = 0; k < n; ++k) {
+            sfloat vk = Vi1[k];
+            Vi1[k] = s * Vi[k] + c * vk;
+            Vi[k] = c * Vi[k] - s * vk;
+          }
+        }
+      }
+      if (r == 0 && i >= l) {
+        continue;
+      }
+      d[l] -= p;
+      e[l] = g;
+      e[m] = 0;
+    } while (m != l);
+  }
+  return SLAP_NO_ERROR;
+}
+
+enum slap_ErrorCode slap_SymmetricEigen(Matrix A, Matrix eigvals, Matrix eigvecs,
+                                        Matrix work) {
+  SLAP_ASSERT_VALID(A, SLAP_INVALID_MATRIX, "SymmetricEigen: A matrix invalid");
+  SLAP_ASSERT_DENSE(A, SLAP_MATRIX_NOT_DENSE, "SymmetricEigen: A must be dense");
+  SLAP_ASSERT(slap_IsSquare(A), SLAP_MATRIX_NOT_SQUARE, SLAP_MATRIX_NOT_SQUARE,
+              "SymmetricEigen: A must be square");
+  int n = slap_NumRows(A);
+  SLAP_ASSERT_DENSE(eigvals, SLAP_MATRIX_NOT_DENSE,
+                    "SymmetricEigen: eigvals must be a dense vector");
+  SLAP_ASSERT(slap_NumElements(eigvals) == n, SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              "SymmetricEigen: eigvals must have length %d", n);
+  SLAP_ASSERT(IsNull(eigvecs) || (slap_NumRows(eigvecs) == n && slap_NumCols(eigvecs) == n),
+              SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS, SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              "SymmetricEigen: eigvecs must be %d x %d", n, n);
+  SLAP_ASSERT(IsNull(eigvecs) || !slap_IsTransposed(eigvecs), SLAP_INVALID_MATRIX,
+              SLAP_INVALID_MATRIX, "SymmetricEigen: eigvecs can't be transposed");
+  if (n == 0) {
+    return SLAP_NO_ERROR;
+  }
+  sfloat* d = eigvals.data;
+  if (n <= SLAP_EIGEN_JACOBI_SIZE) {
+    return JacobiSmall(A, d, eigvecs);
+  }
+  SLAP_ASSERT_DENSE(work, SLAP_MATRIX_NOT_DENSE, "SymmetricEigen: work must be dense");
+  SLAP_ASSERT(slap_NumElements(work) >= 3 * n, SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              "SymmetricEigen: work must have at least %d elements", 3 * n);
+
+  // The reduction works on contiguous columns, which are the same for the transpose of a
+  // symmetric matrix
+  Symmetrize(A);
+  if (slap_IsTransposed(A)) {
+    A = slap_Transpose(A);
+  }
+  sfloat* e = work.data;
+  sfloat* betas = work.data + n;
+  Tridiagonalize(A, d, e, betas, work.data + 2 * n);
+
+  // V = Q, where Q = diag(1, Q2) and Q2 comes from the reflections stored below the
+  // subdiagonal of A
+  Matrix V = eigvecs;
+  if (!IsNull(V)) {
+    slap_SetIdentity(V, 1);
+    Matrix Q2 = slap_CreateSubMatrix(V, 1, 1, n - 1, n - 1);
+    Matrix R2 = slap_CreateSubMatrix(A, 1, 0, n - 1, n - 1);
+    slap_ComputeQ(Q2, R2, slap_MatrixFromArray(n - 1, 1, betas));
+  }
+
+  enum slap_ErrorCode err = TridiagonalQL(n, d, e, V);
+  SortEigenvalues(n, d, V);
+  return err;
+}
+
+size_t slap_SymmetricEigenWorkspaceSize(int n) { return slap_ArenaMatrixSize(3 * n, 1); }
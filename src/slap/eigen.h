@@ -0,0 +1,62 @@
+//
+// Created by Brian Jackson on 10/18/26.
+// Copyright (c) 2026 Robotic Exploration Lab. All rights reserved.
+//
+
+#pragma once
+
+#include <stddef.h>
+
+#include "matrix.h"
+
+// Matrices up to this size are diagonalized directly with cyclic Jacobi rotations,
+// instead of being reduced to tridiagonal form first
+#ifndef SLAP_EIGEN_JACOBI_SIZE
+#define SLAP_EIGEN_JACOBI_SIZE 3
+#endif
+
+// Maximum number of implicit QL (or Jacobi) iterations per eigenvalue before giving up
+#ifndef SLAP_EIGEN_MAX_ITER
+#define SLAP_EIGEN_MAX_ITER 30
+#endif
+
+/**
+ * @brief Eigendecomposition of a symmetric matrix
+ *
+ * Computes \f$ A = V \Lambda V^T \f$, where \f$ \Lambda \f$ is diagonal and \f$ V \f$ is
+ * orthogonal. Only the lower triangle of @p A is read.
+ *
+ * The matrix is first reduced to a tridiagonal matrix \f$ T = Q^T A Q \f$ with Householder
+ * reflections, which are stored in the same format as slap_QR() so that \f$ Q \f$ is
+ * formed with slap_ComputeQ(). The eigenvalues of \f$ T \f$ are then found with implicit
+ * QL iterations using Wilkinson shifts, applying each rotation to \f$ Q \f$ if the
+ * eigenvectors are requested. Matrices with at most `SLAP_EIGEN_JACOBI_SIZE` rows (e.g.
+ * 3x3 covariances) skip the reduction and use cyclic Jacobi rotations instead, which are
+ * faster at that size and very accurate.
+ *
+ * Nothing is allocated, so this can be called inside a real-time loop with a workspace
+ * created up front, e.g. from an arena with slap_SymmetricEigenWorkspaceSize() bytes.
+ *
+ * **Header File:** `slap/eigen.h`
+ * @param[inout] A A square symmetric matrix. Overwritten.
+ * @param[out] eigvals Dense vector of length n. Stores the eigenvalues in ascending order.
+ * @param[out] eigvecs An n x n matrix, whose columns are the eigenvectors in the same
+ *                     order as @p eigvals. Can't share data with @p A. Pass a null matrix
+ *                     (see slap_NullMatrix()) to only compute the eigenvalues.
+ * @param work A dense workspace with at least `3n` elements. Not used (and can be a null
+ *             matrix) if `n <= SLAP_EIGEN_JACOBI_SIZE`.
+ * @return SLAP_NO_ERROR, or SLAP_NOT_CONVERGED if an eigenvalue didn't converge within
+ *         `SLAP_EIGEN_MAX_ITER` iterations.
+ */
+enum slap_ErrorCode slap_SymmetricEigen(Matrix A, Matrix eigvals, Matrix eigvecs,
+                                        Matrix work);
+
+/**
+ * @brief Arena bytes needed for the workspace of slap_SymmetricEigen()
+ *
+ * Covers the @p work vector, allocated with slap_ArenaNewMatrix().
+ *
+ * **Header File:** `slap/eigen.h`
+ * @param n Size of the matrix
+ */
+size_t slap_SymmetricEigenWorkspaceSize(int n);
@@ -45,6 +45,15 @@ const char* slap_ErrorString(enum slap_ErrorCode error_code) {
     case SLAP_EMPTY_MATRIX:
       msg = "Matrix has size of zero";
       break;
+    case SLAP_UNSUPPORTED_ISA:
+      msg = "Instruction set not supported by this build or CPU";
+      break;
+    case SLAP_SINGULAR_MATRIX:
+      msg = "Matrix is singular: got a zero pivot";
+      break;
+    case SLAP_NOT_CONVERGED:
+      msg = "Iterative algorithm didn't converge";
+      break;
     default:
       msg = "Unknown error type";
   }
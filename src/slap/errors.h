@@ -25,6 +25,9 @@ enum slap_ErrorCode {
   SLAP_INVALID_MATRIX,
   SLAP_INDEX_OUT_OF_BOUNDS,
   SLAP_EMPTY_MATRIX,
+  SLAP_UNSUPPORTED_ISA,
+  SLAP_SINGULAR_MATRIX,
+  SLAP_NOT_CONVERGED,
 };
 
 const char* slap_ErrorString(enum slap_ErrorCode error_code);
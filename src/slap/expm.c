@@ -0,0 +1,231 @@
+//
+// Created by Brian Jackson on 10/18/26.
+// Copyright (c) 2026 Robotic Exploration Lab. All rights reserved.
+//
+
+#include "expm.h"
+
+#include <math.h>
+
+#include "arena.h"
+#include "copy_matrix.h"
+#include "fixed_size.h"
+#include "lu.h"
+#include "matmul.h"
+
+// Number of n x n buffers in the workspace
+#define NUM_BUFFERS 6
+
+// Degrees of the Padé approximants, and the largest 1-norm for which each one is accurate
+// to machine precision, from Higham, "The Scaling and Squaring Method for the Matrix
+// Exponential Revisited" (2005). Matrices with larger norms are scaled to the last one.
+#ifdef SLAP_SINGLE_PRECISION
+#define NUM_DEGREES 3
+static const int kDegrees[NUM_DEGREES] = {3, 5, 7};
+static const double kTheta[NUM_DEGREES] = {4.258730016922831e-1, 1.880152677804762,
+                                           3.925724783138660};
+#else
+#define NUM_DEGREES 5
+static const int kDegrees[NUM_DEGREES] = {3, 5, 7, 9, 13};
+static const double kTheta[NUM_DEGREES] = {1.495585217958292e-2, 2.539398330063230e-1,
+                                           9.504178996162932e-1, 2.097847961257068,
+                                           5.371920351148152};
+#endif
+
+// Coefficients of the numerator of each approximant, from the constant term up
+static const double kPade3[] = {120, 60, 12, 1};
+static const double kPade5[] = {30240, 15120, 3360, 420, 30, 1};
+static const double kPade7[] = {17297280, 8648640, 1995840, 277200, 25200, 1512, 56, 1};
+static const double kPade9[] = {17643225600., 8821612800., 2075673600., 302702400.,
+                                30270240.,    2162160.,    110880.,     3960.,
+                                90.,          1.};
+static const double kPade13[] = {64764752532480000., 32382376266240000., 7771770303897600.,
+                                  1187353796428800.,  129060195264000.,   10559470521600.,
+                                  670442572800.,      33522128640.,       1323241920.,
+                                  40840800.,          960960.,            16380.,
+                                  182.,               1.};
+
+static const double* PadeCoefficients(int m) {
+  switch (m) {
+    case 3:
+      return kPade3;
+    case 5:
+      return kPade5;
+    case 7:
+      return kPade7;
+    case 9:
+      return kPade9;
+    default:
+      return kPade13;
+  }
+}
+
+// Maximum absolute column sum
+static sfloat OneNorm(Matrix A) {
+  sfloat norm = 0;
+  for (int j = 0; j < slap_NumCols(A); ++j) {
+    sfloat sum = 0;
+    for (int i = 0; i < slap_NumRows(A); ++i) {
+      sum += fabs(*slap_GetElement(A, i, j));
+    }
+    norm = sum > norm ? sum : norm;
+  }
+  return norm;
+}
+
+// out = beta * out + c0 * I + sum_k c[k] * P[k], for dense n x n matrices. out can be one
+// of the P[k].
+static void Polynomial(int n, sfloat* out, sfloat beta, double c0, int np, const double* c,
+                       sfloat* const* P) {
+  for (int i = 0; i < n * n; ++i) {
+    sfloat sum = beta == 0 ? 0 : beta * out[i];
+    for (int k = 0; k < np; ++k) {
+      sum += c[k] * P[k][i];
+    }
+    out[i] = sum;
+  }
+  for (int i = 0; i < n; ++i) {
+    out[i + i * n] += c0;
+  }
+}
+
+// Scaling and squaring on NUM_BUFFERS dense n x n buffers
+static enum slap_ErrorCode ExpmDense(Matrix E, Matrix A, sfloat* buf, int* piv) {
+  int n = slap_NumRows(A);
+  int nn = n * n;
+  sfloat* X = buf;
+  sfloat* A2 = buf + 1 * nn;
+  sfloat* A4 = buf + 2 * nn;
+  sfloat* A6 = buf + 3 * nn;
+  sfloat* U = buf + 4 * nn;
+  sfloat* V = buf + 5 * nn;
+
+  // Pick the degree, and the power of 2 to scale by
+  sfloat norm = OneNorm(A);
+  int d = 0;
+  while (d < NUM_DEGREES - 1 && norm > kTheta[d]) {
+    ++d;
+  }
+  int s = 0;
+  if (norm > kTheta[d] && isfinite(norm)) {
+    s = (int)ceil(log2(norm / kTheta[d]));
+  }
+  int m = kDegrees[d];
+  const double* b = PadeCoefficients(m);
+
+  slap_Copy(slap_MatrixFromArray(n, n, X), A);
+  if (s > 0) {
+    sfloat scale = ldexp(1, -s);
+    for (int i = 0; i < nn; ++i) {
+      X[i] *= scale;
+    }
+  }
+
+  // Even powers
+  slap_MatMulAdd(slap_MatrixFromArray(n, n, A2), slap_MatrixFromArray(n, n, X),
+                 slap_MatrixFromArray(n, n, X), 1, 0);
+  if (m >= 5) {
+    slap_MatMulAdd(slap_MatrixFromArray(n, n, A4), slap_MatrixFromArray(n, n, A2),
+                   slap_MatrixFromArray(n, n, A2), 1, 0);
+  }
+  if (m >= 7) {
+    slap_MatMulAdd(slap_MatrixFromArray(n, n, A6), slap_MatrixFromArray(n, n, A4),
+                   slap_MatrixFromArray(n, n, A2), 1, 0);
+  }
+
+  // r(X) = q(X)^{-1} p(X), where p(X) = V + U and q(X) = V - U, with V holding the even
+  // terms and U the odd terms
+  if (m <= 9) {
+    // A^8 is stored in U until the odd terms are formed
+    sfloat* P[4] = {A2, A4, A6, U};
+    if (m == 9) {
+      slap_MatMulAdd(slap_MatrixFromArray(n, n, U), slap_MatrixFromArray(n, n, A4),
+                     slap_MatrixFromArray(n, n, A4), 1, 0);
+    }
+    int np = (m - 1) / 2;
+    double c[4];
+    for (int k = 0; k < np; ++k) {
+      c[k] = b[2 * k + 2];
+    }
+    Polynomial(n, V, 0, b[0], np, c, P);
+    for (int k = 0; k < np; ++k) {
+      c[k] = b[2 * k + 3];
+    }
+    Polynomial(n, A2, 0, b[1], np, c, P);  // U = X A2
+  } else {
+    // V = A6 (b12 A6 + b10 A4 + b8 A2 + b6 I) + b4 A4 + b2 A2 + b0 I
+    sfloat* P[3] = {A2, A4, A6};
+    const double cv_high[3] = {b[8], b[10], b[12]};
+    const double cv_low[2] = {b[2], b[4]};
+    Polynomial(n, U, 0, b[6], 3, cv_high, P);
+    slap_MatMulAdd(slap_MatrixFromArray(n, n, V), slap_MatrixFromArray(n, n, A6),
+                   slap_MatrixFromArray(n, n, U), 1, 0);
+    Polynomial(n, V, 1, b[0], 2, cv_low, P);
+
+    // U = X (A6 (b13 A6 + b11 A4 + b9 A2 + b7 I) + b5 A4 + b3 A2 + b1 I), where the low
+    // terms overwrite A2 and the product overwrites A4
+    const double cu_high[3] = {b[9], b[11], b[13]};
+    const double cu_low[2] = {b[3], b[5]};
+    Polynomial(n, U, 0, b[7], 3, cu_high, P);
+    Polynomial(n, A2, 0, b[1], 2, cu_low, P);
+    slap_MatMulAdd(slap_MatrixFromArray(n, n, A4), slap_MatrixFromArray(n, n, A6),
+                   slap_MatrixFromArray(n, n, U), 1, 0);
+    for (int i = 0; i < nn; ++i) {
+      A2[i] += A4[i];
+    }
+  }
+  slap_MatMulAdd(slap_MatrixFromArray(n, n, U), slap_MatrixFromArray(n, n, X),
+                 slap_MatrixFromArray(n, n, A2), 1, 0);
+  sfloat* Q = A2;
+  sfloat* R = A4;
+  for (int i = 0; i < nn; ++i) {
+    Q[i] = V[i] - U[i];
+    R[i] = V[i] + U[i];
+  }
+  Matrix Qmat = slap_MatrixFromArray(n, n, Q);
+  enum slap_ErrorCode err = slap_LU(Qmat, piv);
+  if (err != SLAP_NO_ERROR) {
+    return err;
+  }
+  slap_LUSolve(Qmat, piv, slap_MatrixFromArray(n, n, R));
+
+  // Undo the scaling, alternating between two buffers
+  sfloat* other = A6;
+  for (int k = 0; k < s; ++k) {
+    slap_MatMulAdd(slap_MatrixFromArray(n, n, other), slap_MatrixFromArray(n, n, R),
+                   slap_MatrixFromArray(n, n, R), 1, 0);
+    sfloat* tmp = R;
+    R = other;
+    other = tmp;
+  }
+  slap_Copy(E, slap_MatrixFromArray(n, n, R));
+  return SLAP_NO_ERROR;
+}
+
+enum slap_ErrorCode slap_Expm(Matrix E, Matrix A, Matrix work, int* piv) {
+  SLAP_ASSERT_VALID(E, SLAP_INVALID_MATRIX, "Expm: E matrix invalid");
+  SLAP_ASSERT_VALID(A, SLAP_INVALID_MATRIX, "Expm: A matrix invalid");
+  SLAP_ASSERT(slap_IsSquare(A), SLAP_MATRIX_NOT_SQUARE, SLAP_MATRIX_NOT_SQUARE,
+              "Expm: A must be square");
+  SLAP_ASSERT_SAME_SIZE(E, A, SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS, "Expm");
+  int n = slap_NumRows(A);
+  if (n == 0) {
+    return SLAP_NO_ERROR;
+  }
+#if SLAP_FIXED_SIZE_KERNELS
+  if (n <= SLAP_FIXED_SIZE_MAX) {
+    sfloat buf[NUM_BUFFERS * SLAP_FIXED_SIZE_MAX * SLAP_FIXED_SIZE_MAX];
+    int piv_small[SLAP_FIXED_SIZE_MAX];
+    return ExpmDense(E, A, buf, piv_small);
+  }
+#endif
+  SLAP_ASSERT_DENSE(work, SLAP_MATRIX_NOT_DENSE, "Expm: work must be dense");
+  SLAP_ASSERT(slap_NumElements(work) >= NUM_BUFFERS * n * n,
+              SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS, SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              "Expm: work must have at least %d elements", NUM_BUFFERS * n * n);
+  SLAP_ASSERT(piv != NULL, SLAP_BAD_POINTER, SLAP_BAD_POINTER,
+              "Expm: pivot array is NULL");
+  return ExpmDense(E, A, work.data, piv);
+}
+
+size_t slap_ExpmWorkspaceSize(int n) { return slap_ArenaMatrixSize(NUM_BUFFERS * n, n); }
@@ -0,0 +1,50 @@
+//
+// Created by Brian Jackson on 10/18/26.
+// Copyright (c) 2026 Robotic Exploration Lab. All rights reserved.
+//
+
+#pragma once
+
+#include <stddef.h>
+
+#include "matrix.h"
+
+/**
+ * @brief Matrix exponential
+ *
+ * Computes \f$ e^A \f$ with the scaling-and-squaring algorithm of Higham (2005): the
+ * smallest Padé approximant that is accurate to machine precision for the 1-norm of
+ * @p A is used, after scaling @p A by a power of 2 if needed, and the result is squared
+ * to undo the scaling. The approximant is found with one slap_LU() and slap_LUSolve(),
+ * and the matrix powers with slap_MatMulAdd().
+ *
+ * A common use is discretizing a linear system with a zero-order hold, where the
+ * exponential of \f$ \begin{bmatrix} A & B \\ 0 & 0 \end{bmatrix} h \f$ contains the
+ * discrete dynamics \f$ A_d \f$ and \f$ B_d \f$ in its top rows.
+ *
+ * Nothing is allocated. Matrices with at most `SLAP_FIXED_SIZE_MAX` rows are handled with
+ * a workspace on the stack, so that every product uses the size-specialized kernels from
+ * slap_MatMulAddFixedSize(), and @p work and @p piv aren't used.
+ *
+ * **Header File:** `slap/expm.h`
+ * @param[out] E The n x n exponential. Can be the same matrix as @p A.
+ * @param[in] A A square matrix
+ * @param work A dense workspace with at least `6 n^2` elements, e.g. from an arena with
+ *             slap_ExpmWorkspaceSize() bytes. Can be a null matrix if
+ *             `n <= SLAP_FIXED_SIZE_MAX`, unless the fixed-size kernels are disabled.
+ * @param piv Array of `n` pivot indices used for the LU decomposition. Can be NULL
+ *            whenever @p work is a null matrix.
+ * @return slap error code
+ */
+enum slap_ErrorCode slap_Expm(Matrix E, Matrix A, Matrix work, int* piv);
+
+/**
+ * @brief Arena bytes needed for the workspace of slap_Expm()
+ *
+ * Covers the @p work matrix, allocated with slap_ArenaNewMatrix(). The pivot array is
+ * supplied by the caller.
+ *
+ * **Header File:** `slap/expm.h`
+ * @param n Size of the matrix
+ */
+size_t slap_ExpmWorkspaceSize(int n);
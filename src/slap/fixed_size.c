@@ -0,0 +1,369 @@
+//
+// Created by Brian Jackson on 10/18/26.
+// Copyright (c) 2026 Robotic Exploration Lab. All rights reserved.
+//
+
+#include "fixed_size.h"
+
+#if SLAP_FIXED_SIZE_KERNELS
+
+#include <math.h>
+
+#if defined(__GNUC__)
+#define SLAP_FORCE_INLINE inline __attribute__((always_inline))
+#elif defined(_MSC_VER)
+#define SLAP_FORCE_INLINE __forceinline
+#else
+#define SLAP_FORCE_INLINE inline
+#endif
+
+#if defined(__clang__)
+#define SLAP_UNROLL _Pragma("unroll")
+#elif defined(__GNUC__)
+#define SLAP_UNROLL _Pragma("GCC unroll 16")
+#else
+#define SLAP_UNROLL
+#endif
+
+/*
+ * Generic kernels
+ *
+ * These are always inlined into the size-specific wrappers below, where n and the
+ * strides are compile-time constants, so the loops can be completely unrolled and the
+ * index arithmetic folded away.
+ */
+
+static SLAP_FORCE_INLINE void MatMulAddN(int n, int ld, sfloat* C, const sfloat* A,
+                                         const sfloat* B, int rs_a, int cs_a, int rs_b,
+                                         int cs_b, sfloat alpha, sfloat beta) {
+  for (int j = 0; j < n; ++j) {
+    sfloat acc[SLAP_FIXED_SIZE_MAX];
+    SLAP_UNROLL
+    for (int i = 0; i < n; ++i) {
+      acc[i] = 0;
+    }
+    SLAP_UNROLL
+    for (int k = 0; k < n; ++k) {
+      sfloat Bkj = B[k * rs_b + j * cs_b];
+      SLAP_UNROLL
+      for (int i = 0; i < n; ++i) {
+        acc[i] += A[i * rs_a + k * cs_a] * Bkj;
+      }
+    }
+    sfloat* Cj = C + j * ld;
+    if (beta == 0) {
+      SLAP_UNROLL
+      for (int i = 0; i < n; ++i) {
+        Cj[i] = alpha * acc[i];
+      }
+    } else {
+      SLAP_UNROLL
+      for (int i = 0; i < n; ++i) {
+        Cj[i] = beta * Cj[i] + alpha * acc[i];
+      }
+    }
+  }
+}
+
+// Returns the column with a non-positive pivot, or -1 if the factorization succeeded
+static SLAP_FORCE_INLINE int CholeskyN(int n, int ld, sfloat* A) {
+  for (int j = 0; j < n; ++j) {
+    sfloat* Aj = A + j * ld;
+    SLAP_UNROLL
+    for (int k = 0; k < j; ++k) {
+      const sfloat* Ak = A + k * ld;
+      sfloat Ajk = Ak[j];
+      SLAP_UNROLL
+      for (int i = j; i < n; ++i) {
+        Aj[i] -= Ak[i] * Ajk;
+      }
+    }
+    if (Aj[j] <= 0) {
+      return j;
+    }
+    sfloat ajj = sqrt(Aj[j]);
+    SLAP_UNROLL
+    for (int i = j; i < n; ++i) {
+      Aj[i] /= ajj;
+    }
+  }
+  return -1;
+}
+
+static SLAP_FORCE_INLINE void TriSolveN(int n, const sfloat* L, int rs, int cs, bool upper,
+                                        sfloat* x) {
+  if (upper) {
+    SLAP_UNROLL
+    for (int j = n - 1; j >= 0; --j) {
+      x[j] /= L[j * rs + j * cs];
+      SLAP_UNROLL
+      for (int i = 0; i < j; ++i) {
+        x[i] -= L[i * rs + j * cs] * x[j];
+      }
+    }
+  } else {
+    SLAP_UNROLL
+    for (int j = 0; j < n; ++j) {
+      x[j] /= L[j * rs + j * cs];
+      SLAP_UNROLL
+      for (int i = j + 1; i < n; ++i) {
+        x[i] -= L[i * rs + j * cs] * x[j];
+      }
+    }
+  }
+}
+
+static SLAP_FORCE_INLINE sfloat QuadraticFormN(int n, int ld, const sfloat* y,
+                                               const sfloat* Q, const sfloat* x) {
+  sfloat Qx[SLAP_FIXED_SIZE_MAX] = {0};
+  SLAP_UNROLL
+  for (int j = 0; j < n; ++j) {
+    SLAP_UNROLL
+    for (int i = 0; i < n; ++i) {
+      Qx[i] += Q[i + j * ld] * x[j];
+    }
+  }
+  sfloat out = 0;
+  SLAP_UNROLL
+  for (int i = 0; i < n; ++i) {
+    out += y[i] * Qx[i];
+  }
+  return out;
+}
+
+/*
+ * Size-specific kernels
+ *
+ * Each size is compiled for two column strides: dense (ld = n), and padded to
+ * slap_AlignedStride(n), as allocated by slap_NewMatrixAligned().
+ */
+typedef void (*MatMulKernel)(sfloat* C, const sfloat* A, const sfloat* B, sfloat alpha,
+                             sfloat beta);
+typedef int (*CholeskyKernel)(sfloat* A);
+typedef void (*TriSolveKernel)(const sfloat* L, sfloat* x);
+typedef sfloat (*QuadraticFormKernel)(const sfloat* y, const sfloat* Q, const sfloat* x);
+
+typedef struct {
+  MatMulKernel matmul[2][2];  // indexed by whether A and B are transposed
+  CholeskyKernel cholesky;
+  TriSolveKernel lower_solve;            // L x = b
+  TriSolveKernel upper_solve;            // U x = b
+  TriSolveKernel lower_transpose_solve;  // L' x = b
+  QuadraticFormKernel quadratic_form;
+} FixedSizeKernels;
+
+// Same as slap_AlignedStride(), as a constant expression
+#define SLAP_LANES (SLAP_MATRIX_ALIGNMENT / (int)sizeof(sfloat))
+#define SLAP_PADDED(N) (SLAP_LANES > 1 ? ((N) + SLAP_LANES - 1) / SLAP_LANES * SLAP_LANES : (N))
+
+// clang-format off
+#define SLAP_DEFINE_FIXED_SIZE_KERNELS_LD(N, LD, S)                                         \
+  static void MatMulAddNN##S##N(sfloat* C, const sfloat* A, const sfloat* B, sfloat alpha,  \
+                                sfloat beta) {                                              \
+    MatMulAddN(N, LD, C, A, B, 1, LD, 1, LD, alpha, beta);                                  \
+  }                                                                                         \
+  static void MatMulAddNT##S##N(sfloat* C, const sfloat* A, const sfloat* B, sfloat alpha,  \
+                                sfloat beta) {                                              \
+    MatMulAddN(N, LD, C, A, B, 1, LD, LD, 1, alpha, beta);                                  \
+  }                                                                                         \
+  static void MatMulAddTN##S##N(sfloat* C, const sfloat* A, const sfloat* B, sfloat alpha,  \
+                                sfloat beta) {                                              \
+    MatMulAddN(N, LD, C, A, B, LD, 1, 1, LD, alpha, beta);                                  \
+  }                                                                                         \
+  static void MatMulAddTT##S##N(sfloat* C, const sfloat* A, const sfloat* B, sfloat alpha,  \
+                                sfloat beta) {                                              \
+    MatMulAddN(N, LD, C, A, B, LD, 1, LD, 1, alpha, beta);                                  \
+  }                                                                                         \
+  static int Cholesky##S##N(sfloat* A) { return CholeskyN(N, LD, A); }                      \
+  static void LowerSolve##S##N(const sfloat* L, sfloat* x) {                                \
+    TriSolveN(N, L, 1, LD, false, x);                                                       \
+  }                                                                                         \
+  static void UpperSolve##S##N(const sfloat* U, sfloat* x) {                                \
+    TriSolveN(N, U, 1, LD, true, x);                                                        \
+  }                                                                                         \
+  static void LowerTransposeSolve##S##N(const sfloat* L, sfloat* x) {                       \
+    TriSolveN(N, L, LD, 1, true, x);                                                        \
+  }                                                                                         \
+  static sfloat QuadraticForm##S##N(const sfloat* y, const sfloat* Q, const sfloat* x) {    \
+    return QuadraticFormN(N, LD, y, Q, x);                                                  \
+  }
+
+#define SLAP_DEFINE_FIXED_SIZE_KERNELS(N)                                                   \
+  SLAP_DEFINE_FIXED_SIZE_KERNELS_LD(N, N, Dense)                                            \
+  SLAP_DEFINE_FIXED_SIZE_KERNELS_LD(N, SLAP_PADDED(N), Padded)
+
+#define SLAP_FIXED_SIZE_TABLE_ENTRY_LD(N, S)                                                \
+  {{{MatMulAddNN##S##N, MatMulAddNT##S##N}, {MatMulAddTN##S##N, MatMulAddTT##S##N}},        \
+   Cholesky##S##N, LowerSolve##S##N, UpperSolve##S##N, LowerTransposeSolve##S##N,           \
+   QuadraticForm##S##N},
+
+#define SLAP_FIXED_SIZE_TABLE_ENTRY_DENSE(N) SLAP_FIXED_SIZE_TABLE_ENTRY_LD(N, Dense)
+#define SLAP_FIXED_SIZE_TABLE_ENTRY_PADDED(N) SLAP_FIXED_SIZE_TABLE_ENTRY_LD(N, Padded)
+
+#define SLAP_FIXED_SIZES(X) X(3) X(4) X(5) X(6) X(7) X(8) X(9) X(10) X(11) X(12)
+// clang-format on
+
+SLAP_FIXED_SIZES(SLAP_DEFINE_FIXED_SIZE_KERNELS)
+
+// Indexed by whether the column stride is padded, then by size
+static const FixedSizeKernels kFixedSizeKernels[2][SLAP_FIXED_SIZE_MAX -
+                                                   SLAP_FIXED_SIZE_MIN + 1] = {
+    {SLAP_FIXED_SIZES(SLAP_FIXED_SIZE_TABLE_ENTRY_DENSE)},
+    {SLAP_FIXED_SIZES(SLAP_FIXED_SIZE_TABLE_ENTRY_PADDED)}};
+
+static const FixedSizeKernels* GetFixedSizeKernels(int n, bool padded) {
+  return &kFixedSizeKernels[padded][n - SLAP_FIXED_SIZE_MIN];
+}
+
+/*
+ * Dispatch
+ */
+bool slap_HasFixedSizeKernels(int n) {
+  return n >= SLAP_FIXED_SIZE_MIN && n <= SLAP_FIXED_SIZE_MAX;
+}
+
+// Square and of a specialized size, with a dense (0) or padded (1) column stride.
+// Returns -1 if there isn't a kernel for the matrix.
+static int StrideVariant(Matrix A, int n) {
+  if (!slap_HasFixedSizeKernels(n) || A.data == NULL || A.rows != n || A.cols != n ||
+      slap_IsStructured(A)) {
+    return -1;
+  }
+  if (A.sy == n) {
+    return 0;
+  }
+  if (A.sy == SLAP_PADDED(n)) {
+    return 1;
+  }
+  return -1;
+}
+
+bool slap_MatMulAddFixedSize(Matrix C, Matrix A, Matrix B, sfloat alpha, sfloat beta) {
+  int n = C.rows;
+  int variant = StrideVariant(C, n);
+  if (variant < 0 || StrideVariant(A, n) != variant || StrideVariant(B, n) != variant ||
+      slap_IsTransposed(C) || slap_GetType(A) != slap_DENSE) {
+    return false;
+  }
+  GetFixedSizeKernels(n, variant)->matmul[A.is_transposed][B.is_transposed](
+      C.data, A.data, B.data, alpha, beta);
+  return true;
+}
+
+bool slap_CholeskyFixedSize(Matrix A, int* fail_col) {
+  int n = A.rows;
+  int variant = StrideVariant(A, n);
+  if (variant < 0 || slap_IsTransposed(A)) {
+    return false;
+  }
+  *fail_col = GetFixedSizeKernels(n, variant)->cholesky(A.data);
+  return true;
+}
+
+static const FixedSizeKernels* GetTriSolveKernels(Matrix L, Matrix b) {
+  int n = L.rows;
+  int variant = StrideVariant(L, n);
+  if (variant < 0 || b.data == NULL || b.rows != n || slap_IsTransposed(b)) {
+    return NULL;
+  }
+  return GetFixedSizeKernels(n, variant);
+}
+
+static TriSolveKernel GetTriSolveKernel(Matrix L, Matrix b) {
+  const FixedSizeKernels* kernels = GetTriSolveKernels(L, b);
+  if (!kernels) {
+    return NULL;
+  }
+  if (slap_IsTransposed(L)) {
+    return kernels->lower_transpose_solve;
+  }
+  if (slap_GetType(L) == slap_TRIANGULAR_UPPER) {
+    return kernels->upper_solve;
+  }
+  return kernels->lower_solve;
+}
+
+bool slap_TriSolveFixedSize(Matrix L, Matrix b) {
+  TriSolveKernel solve = GetTriSolveKernel(L, b);
+  if (!solve) {
+    return false;
+  }
+  for (int j = 0; j < b.cols; ++j) {
+    solve(L.data, b.data + j * b.sy);
+  }
+  return true;
+}
+
+bool slap_CholeskySolveFixedSize(Matrix L, Matrix b) {
+  if (slap_IsTransposed(L) || slap_GetType(L) == slap_TRIANGULAR_UPPER) {
+    return false;
+  }
+  const FixedSizeKernels* kernels = GetTriSolveKernels(L, b);
+  if (!kernels) {
+    return false;
+  }
+  for (int j = 0; j < b.cols; ++j) {
+    sfloat* bj = b.data + j * b.sy;
+    kernels->lower_solve(L.data, bj);
+    kernels->lower_transpose_solve(L.data, bj);
+  }
+  return true;
+}
+
+bool slap_QuadraticFormFixedSize(Matrix y, Matrix Q, Matrix x, sfloat* out) {
+  int n = Q.rows;
+  int variant = StrideVariant(Q, n);
+  if (variant < 0 || slap_NumElements(x) != n || slap_NumElements(y) != n ||
+      !slap_IsDense(x) || !slap_IsDense(y)) {
+    return false;
+  }
+  QuadraticFormKernel kernel = GetFixedSizeKernels(n, variant)->quadratic_form;
+  // y' Q' x = x' Q y
+  *out = slap_IsTransposed(Q) ? kernel(x.data, Q.data, y.data)
+                              : kernel(y.data, Q.data, x.data);
+  return true;
+}
+
+#else
+
+bool slap_HasFixedSizeKernels(int n) {
+  (void)n;
+  return false;
+}
+
+bool slap_MatMulAddFixedSize(Matrix C, Matrix A, Matrix B, sfloat alpha, sfloat beta) {
+  (void)C;
+  (void)A;
+  (void)B;
+  (void)alpha;
+  (void)beta;
+  return false;
+}
+
+bool slap_CholeskyFixedSize(Matrix A, int* fail_col) {
+  (void)A;
+  (void)fail_col;
+  return false;
+}
+
+bool slap_TriSolveFixedSize(Matrix L, Matrix b) {
+  (void)L;
+  (void)b;
+  return false;
+}
+
+bool slap_CholeskySolveFixedSize(Matrix L, Matrix b) {
+  (void)L;
+  (void)b;
+  return false;
+}
+
+bool slap_QuadraticFormFixedSize(Matrix y, Matrix Q, Matrix x, sfloat* out) {
+  (void)y;
+  (void)Q;
+  (void)x;
+  (void)out;
+  return false;
+}
+
+#endif
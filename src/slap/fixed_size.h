@@ -0,0 +1,92 @@
+//
+// Created by Brian Jackson on 10/18/26.
+// Copyright (c) 2026 Robotic Exploration Lab. All rights reserved.
+//
+
+#pragma once
+
+#include "matrix.h"
+
+// Size-specialized kernels are generated for every square size in this range.
+// They're disabled by default on AVR, where flash is more precious than cycles.
+// Define SLAP_FIXED_SIZE_KERNELS to 0 to disable them on other platforms.
+#ifndef SLAP_FIXED_SIZE_KERNELS
+#if defined(__AVR__)
+#define SLAP_FIXED_SIZE_KERNELS 0
+#else
+#define SLAP_FIXED_SIZE_KERNELS 1
+#endif
+#endif
+
+#define SLAP_FIXED_SIZE_MIN 3
+#define SLAP_FIXED_SIZE_MAX 12
+
+/**
+ * @brief Check if there are size-specialized kernels for an n x n matrix
+ *
+ * **Header File:** `slap/fixed_size.h`
+ */
+bool slap_HasFixedSizeKernels(int n);
+
+/**
+ * @brief Try to compute \f$ C = \beta C + \alpha A B \f$ with a size-specialized kernel
+ *
+ * Applies when all three matrices are n x n with n between `SLAP_FIXED_SIZE_MIN` and
+ * `SLAP_FIXED_SIZE_MAX`, and either all dense or all with the padded column stride of
+ * slap_NewMatrixAligned(). Either input can be transposed, but the output can't.
+ *
+ * Called automatically by slap_MatMulAdd().
+ *
+ * **Header File:** `slap/fixed_size.h`
+ * @return true if the product was computed, false if there is no specialized kernel for
+ *         these inputs, in which case nothing is modified.
+ */
+bool slap_MatMulAddFixedSize(Matrix C, Matrix A, Matrix B, sfloat alpha, sfloat beta);
+
+/**
+ * @brief Try to compute a Cholesky decomposition with a size-specialized kernel
+ *
+ * Called automatically by slap_Cholesky().
+ *
+ * **Header File:** `slap/fixed_size.h`
+ * @param A Dense or padded square matrix that isn't transposed
+ * @param[out] fail_col If the factorization was computed, the column where it failed, or
+ *                      -1 if it succeeded
+ * @return true if the factorization was computed
+ */
+bool slap_CholeskyFixedSize(Matrix A, int* fail_col);
+
+/**
+ * @brief Try to solve a triangular system with a size-specialized kernel
+ *
+ * Uses the same conventions as slap_TriSolve(). The right-hand side can have any number
+ * of columns, but must not be transposed.
+ *
+ * Called automatically by slap_TriSolve().
+ *
+ * **Header File:** `slap/fixed_size.h`
+ * @return true if the system was solved
+ */
+bool slap_TriSolveFixedSize(Matrix L, Matrix b);
+
+/**
+ * @brief Try to solve a system with a precomputed Cholesky factor using a
+ *        size-specialized kernel
+ *
+ * Called automatically by slap_CholeskySolve().
+ *
+ * **Header File:** `slap/fixed_size.h`
+ * @return true if the system was solved
+ */
+bool slap_CholeskySolveFixedSize(Matrix L, Matrix b);
+
+/**
+ * @brief Try to compute \f$ y^T Q x \f$ with a size-specialized kernel
+ *
+ * Called automatically by slap_QuadraticForm().
+ *
+ * **Header File:** `slap/fixed_size.h`
+ * @param[out] out Result, if it was computed
+ * @return true if the quadratic form was computed
+ */
+bool slap_QuadraticFormFixedSize(Matrix y, Matrix Q, Matrix x, sfloat* out);
@@ -9,6 +9,8 @@
 
 enum slap_ErrorCode slap_Map(Matrix mat, sfloat (*function)(sfloat)) {
   SLAP_ASSERT_VALID(mat, SLAP_INVALID_MATRIX, "Map: invalid matrix");
+  SLAP_ASSERT(!slap_IsStructured(mat), SLAP_INVALID_MATRIX, SLAP_INVALID_MATRIX,
+              "Map: band, diagonal and packed matrices aren't supported");
   for (MatrixIterator it = slap_Iterator(mat); !slap_IsFinished(&it); slap_Step(&it)) {
     sfloat* value = mat.data + it.index;
     *value = function(*value);
@@ -21,6 +23,9 @@ enum slap_ErrorCode slap_BinaryMap(Matrix C, Matrix A, Matrix B,
   SLAP_ASSERT_VALID(C, SLAP_INVALID_MATRIX, "BinaryMap: invalid output C matrix");
   SLAP_ASSERT_VALID(A, SLAP_INVALID_MATRIX, "BinaryMap: invalid input A matrix");
   SLAP_ASSERT_VALID(B, SLAP_INVALID_MATRIX, "BinaryMap: invalid input B matrix");
+  SLAP_ASSERT(!slap_IsStructured(C) && !slap_IsStructured(A) && !slap_IsStructured(B),
+              SLAP_INVALID_MATRIX, SLAP_INVALID_MATRIX,
+              "BinaryMap: band, diagonal and packed matrices aren't supported");
 
   // Check that matrices have the same size
   SLAP_ASSERT_SAME_SIZE(C,A, SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS, "slap_BinaryMap");
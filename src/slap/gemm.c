@@ -0,0 +1,250 @@
+//
+// Created by Brian Jackson on 10/18/26.
+// Copyright (c) 2026 Robotic Exploration Lab. All rights reserved.
+//
+
+#include "gemm.h"
+
+#include "kernels.h"
+#include "matmul.h"
+
+#define MR SLAP_GEMM_MR
+#define NR SLAP_GEMM_NR
+#define MC SLAP_GEMM_MC
+#define KC SLAP_GEMM_KC
+#define NC SLAP_GEMM_NC
+
+#if (MC % MR) != 0 || (NC % NR) != 0
+#error "SLAP_GEMM_MC and SLAP_GEMM_NC must be multiples of the register tile size"
+#endif
+
+// The packing buffers are too big for the stack of a pool worker or a microcontroller,
+// so they're static. Each thread gets its own copy, so slap_MatMulAdd() can be called from
+// several threads at once, including the workers of slap_MatMulAddParallel().
+static _Thread_local sfloat packed_A[MC * KC];
+static _Thread_local sfloat packed_B[KC * NC];
+
+/**
+ * @brief Scales every element of an m x n strided block by beta
+ *
+ * A zero beta overwrites the block with zeros, so that uninitialized (or NaN) data in the
+ * output doesn't propagate.
+ */
+static void ScaleBlock(int m, int n, sfloat beta, sfloat* c, int rs_c, int cs_c) {
+  if (beta == 1) {
+    return;
+  }
+  for (int j = 0; j < n; ++j) {
+    sfloat* cj = c + j * cs_c;
+    for (int i = 0; i < m; ++i) {
+      cj[i * rs_c] = beta == 0 ? 0 : beta * cj[i * rs_c];
+    }
+  }
+}
+
+/**
+ * @brief Copy an mc x kc block of A into row panels of height MR
+ *
+ * Each panel stores the MR elements of a column contiguously, for kc columns. Rows past
+ * the edge of the matrix are padded with zeros so the micro-kernel never needs to
+ * special-case a partial tile.
+ */
+static void PackA(int mc, int kc, const sfloat* a, int rs_a, int cs_a, sfloat* Ap) {
+  for (int ir = 0; ir < mc; ir += MR) {
+    int mr = mc - ir < MR ? mc - ir : MR;
+    const sfloat* a_panel = a + ir * rs_a;
+    for (int p = 0; p < kc; ++p) {
+      const sfloat* ap = a_panel + p * cs_a;
+      for (int i = 0; i < mr; ++i) {
+        Ap[i] = ap[i * rs_a];
+      }
+      for (int i = mr; i < MR; ++i) {
+        Ap[i] = 0;
+      }
+      Ap += MR;
+    }
+  }
+}
+
+/**
+ * @brief Copy a kc x nc block of B into column panels of width NR
+ *
+ * Each panel stores the NR elements of a row contiguously, for kc rows, padding with
+ * zeros past the edge of the matrix.
+ */
+static void PackB(int kc, int nc, const sfloat* b, int rs_b, int cs_b, sfloat* Bp) {
+  for (int jr = 0; jr < nc; jr += NR) {
+    int nr = nc - jr < NR ? nc - jr : NR;
+    const sfloat* b_panel = b + jr * cs_b;
+    for (int p = 0; p < kc; ++p) {
+      const sfloat* bp = b_panel + p * rs_b;
+      for (int j = 0; j < nr; ++j) {
+        Bp[j] = bp[j * cs_b];
+      }
+      for (int j = nr; j < NR; ++j) {
+        Bp[j] = 0;
+      }
+      Bp += NR;
+    }
+  }
+}
+
+/**
+ * @brief Multiply a packed mc x kc block of A with a packed kc x nc block of B,
+ *        adding the (scaled) result to C
+ */
+static void MacroKernel(const slap_Kernels* kernels, int mc, int nc, int kc, sfloat alpha,
+                        const sfloat* Ap, const sfloat* Bp, sfloat* c, int rs_c,
+                        int cs_c) {
+  sfloat AB[MR * NR];
+  for (int jr = 0; jr < nc; jr += NR) {
+    int nr = nc - jr < NR ? nc - jr : NR;
+    for (int ir = 0; ir < mc; ir += MR) {
+      int mr = mc - ir < MR ? mc - ir : MR;
+      kernels->gemm(kc, Ap + ir * kc, Bp + jr * kc, AB);
+
+      sfloat* c_tile = c + ir * rs_c + jr * cs_c;
+      if (rs_c == 1) {
+        for (int j = 0; j < nr; ++j) {
+          sfloat* cj = c_tile + j * cs_c;
+          const sfloat* abj = AB + j * MR;
+          for (int i = 0; i < mr; ++i) {
+            cj[i] += alpha * abj[i];
+          }
+        }
+      } else {
+        for (int j = 0; j < nr; ++j) {
+          for (int i = 0; i < mr; ++i) {
+            c_tile[i * rs_c + j * cs_c] += alpha * AB[i + j * MR];
+          }
+        }
+      }
+    }
+  }
+}
+
+enum slap_ErrorCode slap_MatMulBlocked(Matrix C, Matrix A, Matrix B, sfloat alpha,
+                                       sfloat beta) {
+  SLAP_ASSERT_VALID(C, SLAP_INVALID_MATRIX, "MatMulBlocked: invalid C matrix");
+  SLAP_ASSERT_VALID(A, SLAP_INVALID_MATRIX, "MatMulBlocked: invalid A matrix");
+  SLAP_ASSERT_VALID(B, SLAP_INVALID_MATRIX, "MatMulBlocked: invalid B matrix");
+  SLAP_ASSERT(!slap_IsStructured(A) && !slap_IsStructured(B) && !slap_IsStructured(C),
+              SLAP_INVALID_MATRIX, SLAP_INVALID_MATRIX,
+              "MatMulBlocked: diagonal, band and packed matrices aren't supported");
+  int m = slap_NumRows(A);
+  int k = slap_NumCols(A);
+  int n = slap_NumCols(B);
+  SLAP_ASSERT(slap_NumRows(B) == k, SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              "MatMulBlocked: dimension mismatch, B has %d rows, expected %d",
+              slap_NumRows(B), k);
+  SLAP_ASSERT(slap_NumRows(C) == m && slap_NumCols(C) == n,
+              SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS, SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              "MatMulBlocked: dimension mismatch, C has size (%d,%d), expected (%d,%d)",
+              slap_NumRows(C), slap_NumCols(C), m, n);
+
+  int rs_a = slap_RowStride(A);
+  int cs_a = slap_ColStride(A);
+  int rs_b = slap_RowStride(B);
+  int cs_b = slap_ColStride(B);
+  int rs_c = slap_RowStride(C);
+  int cs_c = slap_ColStride(C);
+
+  ScaleBlock(m, n, beta, C.data, rs_c, cs_c);
+  if (alpha == 0 || k == 0) {
+    return SLAP_NO_ERROR;
+  }
+
+  const slap_Kernels* kernels = slap_GetKernels();
+  for (int jc = 0; jc < n; jc += NC) {
+    int nc = n - jc < NC ? n - jc : NC;
+    for (int pc = 0; pc < k; pc += KC) {
+      int kc = k - pc < KC ? k - pc : KC;
+      PackB(kc, nc, B.data + pc * rs_b + jc * cs_b, rs_b, cs_b, packed_B);
+      for (int ic = 0; ic < m; ic += MC) {
+        int mc = m - ic < MC ? m - ic : MC;
+        PackA(mc, kc, A.data + ic * rs_a + pc * cs_a, rs_a, cs_a, packed_A);
+        MacroKernel(kernels, mc, nc, kc, alpha, packed_A, packed_B,
+                    C.data + ic * rs_c + jc * cs_c, rs_c, cs_c);
+      }
+    }
+  }
+  return SLAP_NO_ERROR;
+}
+
+// A view of the r x c block of A starting at (i,j), which may be transposed
+static Matrix Tile(Matrix A, int i, int j, int r, int c) {
+  Matrix tile = A;
+  tile.data = A.data + slap_Cart2Index(A, i, j);
+  tile.rows = slap_IsTransposed(A) ? c : r;
+  tile.cols = slap_IsTransposed(A) ? r : c;
+  return tile;
+}
+
+typedef struct {
+  Matrix C;
+  Matrix A;
+  Matrix B;
+  sfloat alpha;
+  sfloat beta;
+  int tile_rows;
+  int tile_cols;
+  int num_row_tiles;
+} MatMulTasks;
+
+// Each task computes one tile of C, using the full inner dimension
+static void MatMulTask(void* context, int task) {
+  const MatMulTasks* tasks = (const MatMulTasks*)context;
+  int m = slap_NumRows(tasks->C);
+  int n = slap_NumCols(tasks->C);
+  int k = slap_NumCols(tasks->A);
+  int i = (task % tasks->num_row_tiles) * tasks->tile_rows;
+  int j = (task / tasks->num_row_tiles) * tasks->tile_cols;
+  int mt = m - i < tasks->tile_rows ? m - i : tasks->tile_rows;
+  int nt = n - j < tasks->tile_cols ? n - j : tasks->tile_cols;
+  slap_MatMulBlocked(Tile(tasks->C, i, j, mt, nt), Tile(tasks->A, i, 0, mt, k),
+                     Tile(tasks->B, 0, j, k, nt), tasks->alpha, tasks->beta);
+}
+
+// Smallest multiple of `multiple` that is at least a / b
+static int CeilDivRound(int a, int b, int multiple) {
+  int q = (a + b - 1) / b;
+  return ((q + multiple - 1) / multiple) * multiple;
+}
+
+enum slap_ErrorCode slap_MatMulAddParallel(slap_ThreadPool* pool, Matrix C, Matrix A,
+                                           Matrix B, sfloat alpha, sfloat beta) {
+  int num_threads = slap_ThreadPoolNumThreads(pool);
+  int m = slap_NumRows(A);
+  int k = slap_NumCols(A);
+  int n = slap_NumCols(B);
+  // Structured and triangular matrices don't store all of their elements
+  bool dense = slap_GetType(A) == slap_DENSE && slap_GetType(B) == slap_DENSE &&
+               slap_GetType(C) == slap_DENSE;
+  if (num_threads == 1 || !dense || (double)m * n * k < SLAP_PARALLEL_THRESHOLD) {
+    return slap_MatMulAdd(C, A, B, alpha, beta);
+  }
+  SLAP_ASSERT_VALID(C, SLAP_INVALID_MATRIX, "MatMulAddParallel: invalid C matrix");
+  SLAP_ASSERT_VALID(A, SLAP_INVALID_MATRIX, "MatMulAddParallel: invalid A matrix");
+  SLAP_ASSERT_VALID(B, SLAP_INVALID_MATRIX, "MatMulAddParallel: invalid B matrix");
+  SLAP_ASSERT(slap_NumRows(B) == k && slap_NumRows(C) == m && slap_NumCols(C) == n,
+              SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS, SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              "MatMulAddParallel: dimension mismatch, got (%d,%d) = (%d,%d) * (%d,%d)",
+              slap_NumRows(C), slap_NumCols(C), m, k, slap_NumRows(B), n);
+
+  // Split C into a grid with at least one tile per thread, as close to square as the
+  // shape of C allows. Tile edges are aligned with the micro-kernel tiles.
+  int grid_rows = 1;
+  while (grid_rows * grid_rows * n < num_threads * m) {
+    ++grid_rows;
+  }
+  if (grid_rows > num_threads) {
+    grid_rows = num_threads;
+  }
+  int grid_cols = (num_threads + grid_rows - 1) / grid_rows;
+  MatMulTasks tasks = {C, A, B, alpha, beta, CeilDivRound(m, grid_rows, SLAP_GEMM_MR),
+                       CeilDivRound(n, grid_cols, SLAP_GEMM_NR), 0};
+  tasks.num_row_tiles = (m + tasks.tile_rows - 1) / tasks.tile_rows;
+  int num_col_tiles = (n + tasks.tile_cols - 1) / tasks.tile_cols;
+  return slap_ThreadPoolRun(pool, tasks.num_row_tiles * num_col_tiles, MatMulTask, &tasks);
+}
@@ -0,0 +1,102 @@
+//
+// Created by Brian Jackson on 10/18/26.
+// Copyright (c) 2026 Robotic Exploration Lab. All rights reserved.
+//
+
+#pragma once
+
+#include "matrix.h"
+#include "threads.h"
+
+// Register tile computed by the micro-kernel. Fixed, since the packing format and every
+// micro-kernel depend on it.
+#define SLAP_GEMM_MR 8
+#define SLAP_GEMM_NR 4
+
+// Cache blocking parameters. Can be overridden at compile time, but SLAP_GEMM_MC must be a
+// multiple of SLAP_GEMM_MR and SLAP_GEMM_NC must be a multiple of SLAP_GEMM_NR.
+// The packing buffers are thread-local and take (MC + NC) * KC elements per thread.
+#if defined(__AVR__)
+#ifndef SLAP_GEMM_MC
+#define SLAP_GEMM_MC 16
+#endif
+#ifndef SLAP_GEMM_KC
+#define SLAP_GEMM_KC 32
+#endif
+#ifndef SLAP_GEMM_NC
+#define SLAP_GEMM_NC 16
+#endif
+#else
+#ifndef SLAP_GEMM_MC
+#define SLAP_GEMM_MC 64  //!< rows of A packed at once (sized for L2)
+#endif
+#ifndef SLAP_GEMM_KC
+#define SLAP_GEMM_KC 128  //!< inner dimension of a packed panel (sized for L1)
+#endif
+#ifndef SLAP_GEMM_NC
+#define SLAP_GEMM_NC 64  //!< columns of B packed at once
+#endif
+#endif
+
+// Number of multiply-adds (m * n * k) above which slap_MatMulAdd() uses the blocked engine
+#ifndef SLAP_GEMM_THRESHOLD
+#define SLAP_GEMM_THRESHOLD 4096
+#endif
+
+/**
+ * @brief Cache-blocked, packed matrix multiplication
+ *
+ * Calculates
+ * \f[
+ * C = \beta C + \alpha A B
+ * \f]
+ * using the same conventions as slap_MatMulAdd(): any of the matrices can be transposed
+ * or strided, the inputs may be aliased, but neither input can be aliased with the output.
+ *
+ * Panels of @p A and @p B are copied into contiguous buffers that fit in cache, and the
+ * product is accumulated in `SLAP_GEMM_MR x SLAP_GEMM_NR` register tiles. This is what
+ * slap_MatMulAdd() calls for large dense matrices, but it can be called directly to skip
+ * the size heuristic.
+ *
+ * If @p beta is zero the output is overwritten, so @p C does not need to be initialized.
+ * All three matrices must store every element, so diagonal, band and packed matrices are
+ * rejected with SLAP_INVALID_MATRIX.
+ *
+ * See also: slap_MatMulAdd()
+ *
+ * **Header File:** `slap/gemm.h`
+ * @param[out] C Destination matrix (m x n)
+ * @param[in] A Left input matrix (m x k)
+ * @param[in] B Right input matrix (k x n)
+ * @param[in] alpha Scaling on the product
+ * @param[in] beta Scaling on the existing data in C
+ * @return slap error code
+ */
+enum slap_ErrorCode slap_MatMulBlocked(Matrix C, Matrix A, Matrix B, sfloat alpha,
+                                       sfloat beta);
+
+/**
+ * @brief Multithreaded matrix multiplication
+ *
+ * Calculates
+ * \f[
+ * C = \beta C + \alpha A B
+ * \f]
+ * by splitting @p C into a grid of tiles, one or more per thread, each computed with
+ * slap_MatMulBlocked(). Every element of @p C is accumulated in the same order as
+ * slap_MatMulBlocked(), so the result doesn't depend on the number of threads.
+ *
+ * Small products, any matrix that isn't of type `slap_DENSE` (e.g. triangular, diagonal,
+ * band or packed), and a NULL or single-threaded pool fall back to slap_MatMulAdd().
+ *
+ * **Header File:** `slap/gemm.h`
+ * @param[in] pool Thread pool from slap_ThreadPoolCreate(). Can be NULL.
+ * @param[out] C Destination matrix (m x n)
+ * @param[in] A Left input matrix (m x k)
+ * @param[in] B Right input matrix (k x n)
+ * @param[in] alpha Scaling on the product
+ * @param[in] beta Scaling on the existing data in C
+ * @return slap error code
+ */
+enum slap_ErrorCode slap_MatMulAddParallel(slap_ThreadPool* pool, Matrix C, Matrix A,
+                                           Matrix B, sfloat alpha, sfloat beta);
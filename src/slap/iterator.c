@@ -7,7 +7,7 @@
 
 MatrixIterator slap_Iterator(Matrix mat) {
   MatrixIterator iterator = {
-      .len = mat.rows * mat.cols,
+      .len = (size_t)mat.rows * (size_t)mat.cols,
       .rows = mat.rows,
       .dx = 1,
       .dy = mat.sy - mat.rows + 1,
@@ -26,6 +26,9 @@
  * Note that if the matrix data is dense (there are no gaps in the memory), it is
  * most efficient to iterate directly over the elements of the underlying array.
  *
+ * The linear and memory indices are `size_t`, so they don't wrap for matrices with more
+ * than 65,535 elements.
+ *
  * # Example
  * for (MatrixIterator it = slap_Iterator(mat); !slap_IsFinished(&it); slap_Step(&it)) {
  *  sfloat value = mat.data[it.index];    // Use `index` to directly index the array
@@ -34,14 +37,14 @@
  * }
  */
 typedef struct MatrixIterator {
-  uint32_t len;    // TODO (brian): safeguard against integer overflow
-  uint16_t rows;
-  uint16_t dx;     // index delta for movement in x
-  uint16_t dy;     // index delta for movement in y
-  uint16_t i;      // row index
-  uint16_t j;      // column index
-  uint16_t k;      // linear index
-  uint16_t index;  // memory index
+  size_t len;
+  slap_dim_t rows;
+  slap_dim_t dx;   // index delta for movement in x
+  slap_dim_t dy;   // index delta for movement in y
+  slap_dim_t i;    // row index
+  slap_dim_t j;    // column index
+  size_t k;        // linear index
+  size_t index;    // memory index
 } MatrixIterator;
 
 /**
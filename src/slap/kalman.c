@@ -0,0 +1,222 @@
+//
+// Created by Brian Jackson on 10/18/26.
+// Copyright (c) 2026 Robotic Exploration Lab. All rights reserved.
+//
+
+#include "kalman.h"
+
+#include "arena.h"
+#include "cholesky.h"
+#include "copy_matrix.h"
+#include "kernels.h"
+#include "matmul.h"
+#include "tri.h"
+#include "unary_ops.h"
+
+// C = D + alpha * X'Y for dense X and Y with k rows, computing each element of the lower
+// triangle with a dot product over contiguous columns and copying it to the upper triangle
+static void SymmetricProduct(Matrix C, Matrix D, sfloat alpha, int k, const sfloat* X,
+                             const sfloat* Y) {
+  const slap_Kernels* kernels = slap_GetKernels();
+  int n = slap_NumRows(C);
+  for (int j = 0; j < n; ++j) {
+    for (int i = j; i < n; ++i) {
+      sfloat XY = kernels->dot(k, X + i * k, Y + j * k);
+      sfloat Cij = slap_SymmetricElement(D, i, j) + alpha * XY;
+      slap_SetElement(C, i, j, Cij);
+      slap_SetElement(C, j, i, Cij);
+    }
+  }
+}
+
+enum slap_ErrorCode slap_KalmanPredict(Matrix x, Matrix P, Matrix F, Matrix Q,
+                                       Matrix work) {
+  SLAP_ASSERT_VALID(P, SLAP_INVALID_MATRIX, "KalmanPredict: P matrix invalid");
+  SLAP_ASSERT_VALID(F, SLAP_INVALID_MATRIX, "KalmanPredict: F matrix invalid");
+  int n = slap_NumRows(P);
+  SLAP_ASSERT(slap_NumCols(P) == n && slap_NumRows(F) == n && slap_NumCols(F) == n &&
+                  slap_NumRows(Q) == n && slap_NumCols(Q) == n,
+              SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS, SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              "KalmanPredict: P, F and Q must be %d x %d", n, n);
+  SLAP_ASSERT(slap_IsNull(x) || (slap_NumRows(x) == n && slap_NumCols(x) == 1),
+              SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS, SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              "KalmanPredict: x must be a vector of length %d", n);
+  SLAP_ASSERT_DENSE(work, SLAP_MATRIX_NOT_DENSE, "KalmanPredict: work must be dense");
+  SLAP_ASSERT(slap_NumElements(work) >= n * (2 * n + 1),
+              SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS, SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              "KalmanPredict: work must have at least %d elements", n * (2 * n + 1));
+
+  // P = Q + (F')' P F', with the columns of F' and P F' contiguous
+  Matrix Ft = slap_MatrixFromArray(n, n, work.data);
+  Matrix PFt = slap_MatrixFromArray(n, n, work.data + n * n);
+  slap_Copy(Ft, slap_Transpose(F));
+  slap_MatMulAdd(PFt, P, Ft, 1, 0);
+  SymmetricProduct(P, Q, 1, n, Ft.data, PFt.data);
+
+  if (!slap_IsNull(x)) {
+    Matrix Fx = slap_MatrixFromArray(n, 1, work.data + 2 * n * n);
+    slap_MatMulAdd(Fx, F, x, 1, 0);
+    slap_Copy(x, Fx);
+  }
+  return SLAP_NO_ERROR;
+}
+
+size_t slap_KalmanPredictWorkspaceSize(int n) { return slap_ArenaMatrixSize(2 * n + 1, n); }
+
+// Elements of the workspace for the measurement update, with the Joseph form needing
+// room for two more n x n matrices
+static int UpdateWorkspaceLength(int n, int p, bool joseph) {
+  return p * (2 * n + p + 1) + (joseph ? 2 * n * n : 0);
+}
+
+static enum slap_ErrorCode KalmanUpdate(Matrix x, Matrix P, Matrix z, Matrix H, Matrix R,
+                                        Matrix work, bool joseph) {
+  SLAP_ASSERT_VALID(P, SLAP_INVALID_MATRIX, "KalmanUpdate: P matrix invalid");
+  SLAP_ASSERT_VALID(H, SLAP_INVALID_MATRIX, "KalmanUpdate: H matrix invalid");
+  int n = slap_NumRows(P);
+  int p = slap_NumRows(H);
+  SLAP_ASSERT(slap_NumCols(P) == n && slap_NumCols(H) == n && slap_NumRows(x) == n &&
+                  slap_NumCols(x) == 1,
+              SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS, SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              "KalmanUpdate: P must be %d x %d, and H and x must have %d columns and rows",
+              n, n, n);
+  SLAP_ASSERT(slap_NumRows(R) == p && slap_NumCols(R) == p && slap_NumRows(z) == p &&
+                  slap_NumCols(z) == 1,
+              SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS, SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              "KalmanUpdate: R must be %d x %d and z must be a vector of length %d", p, p,
+              p);
+  if (p == 1 && !joseph) {
+    return slap_KalmanUpdateSequential(x, P, z, H, R, work);
+  }
+  SLAP_ASSERT_DENSE(work, SLAP_MATRIX_NOT_DENSE, "KalmanUpdate: work must be dense");
+  SLAP_ASSERT(slap_NumElements(work) >= UpdateWorkspaceLength(n, p, joseph),
+              SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS, SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              "KalmanUpdate: work must have at least %d elements",
+              UpdateWorkspaceLength(n, p, joseph));
+
+  // S = R + (H')' P H', with the columns of H' and P H' contiguous
+  Matrix Ht = slap_MatrixFromArray(n, p, work.data);
+  Matrix PHt = slap_MatrixFromArray(n, p, work.data + n * p);
+  Matrix S = slap_MatrixFromArray(p, p, work.data + 2 * n * p);
+  Matrix y = slap_MatrixFromArray(p, 1, work.data + 2 * n * p + p * p);
+  slap_Copy(Ht, slap_Transpose(H));
+  slap_MatMulAdd(PHt, P, Ht, 1, 0);
+  SymmetricProduct(S, R, 1, n, Ht.data, PHt.data);
+
+  // S = L L'
+  enum slap_ErrorCode err = slap_CholeskyInfo(S, NULL);
+  if (err != SLAP_NO_ERROR) {
+    return err;
+  }
+
+  // Innovation y = z - H x
+  slap_Copy(y, z);
+  slap_MatMulAdd(y, slap_Transpose(Ht), x, -1, 1);
+
+  // G = L \ (H P), which overwrites H'. Then x += K y = G' (L \ y) and P -= G'G.
+  Matrix G = slap_MatrixFromArray(p, n, work.data);
+  slap_Copy(G, slap_Transpose(PHt));
+  slap_TriSolve(S, G);
+  slap_TriSolve(S, y);
+  slap_MatMulAdd(x, slap_Transpose(G), y, 1, 1);
+  if (!joseph) {
+    SymmetricProduct(P, P, -1, p, G.data, G.data);
+    return SLAP_NO_ERROR;
+  }
+
+  // K' = L' \ G. With M = I - K H, P = (P M')' M' + K R K', where the columns of P M' and
+  // M' are contiguous and K R K' is computed in P once it's no longer needed.
+  Matrix Kt = G;
+  Matrix RKt = slap_MatrixFromArray(p, n, PHt.data);
+  Matrix Mt = slap_MatrixFromArray(n, n, work.data + p * (2 * n + p + 1));
+  Matrix PMt = slap_MatrixFromArray(n, n, Mt.data + n * n);
+  slap_TriSolve(slap_Transpose(S), Kt);
+  slap_MatMulAdd(Mt, slap_Transpose(H), Kt, -1, 0);
+  slap_AddIdentity(Mt, 1);
+  slap_MatMulAdd(PMt, P, Mt, 1, 0);
+  slap_MatMulAdd(RKt, R, Kt, 1, 0);
+  slap_MatMulAdd(P, slap_Transpose(Kt), RKt, 1, 0);
+  SymmetricProduct(P, P, 1, n, PMt.data, Mt.data);
+  return SLAP_NO_ERROR;
+}
+
+enum slap_ErrorCode slap_KalmanUpdate(Matrix x, Matrix P, Matrix z, Matrix H, Matrix R,
+                                      Matrix work) {
+  return KalmanUpdate(x, P, z, H, R, work, false);
+}
+
+size_t slap_KalmanUpdateWorkspaceSize(int n, int p) {
+  return slap_ArenaMatrixSize(2 * n + p + 1, p);
+}
+
+enum slap_ErrorCode slap_KalmanUpdateJoseph(Matrix x, Matrix P, Matrix z, Matrix H,
+                                            Matrix R, Matrix work) {
+  return KalmanUpdate(x, P, z, H, R, work, true);
+}
+
+size_t slap_KalmanUpdateJosephWorkspaceSize(int n, int p) {
+  return slap_ArenaMatrixSize(UpdateWorkspaceLength(n, p, true), 1);
+}
+
+enum slap_ErrorCode slap_KalmanUpdateSequential(Matrix x, Matrix P, Matrix z, Matrix H,
+                                                Matrix R, Matrix work) {
+  SLAP_ASSERT_VALID(P, SLAP_INVALID_MATRIX, "KalmanUpdateSequential: P matrix invalid");
+  SLAP_ASSERT_VALID(H, SLAP_INVALID_MATRIX, "KalmanUpdateSequential: H matrix invalid");
+  SLAP_ASSERT(slap_GetType(P) == slap_DENSE, SLAP_MATRIX_NOT_DENSE, SLAP_MATRIX_NOT_DENSE,
+              "KalmanUpdateSequential: P must be a dense matrix");
+  int n = slap_NumRows(P);
+  int p = slap_NumRows(H);
+  SLAP_ASSERT(slap_NumCols(P) == n && slap_NumCols(H) == n && slap_NumRows(x) == n &&
+                  slap_NumCols(x) == 1,
+              SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS, SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              "KalmanUpdateSequential: P must be %d x %d, and H and x must have %d columns "
+              "and rows",
+              n, n, n);
+  SLAP_ASSERT(slap_NumRows(R) == p && slap_NumCols(R) == p && slap_NumRows(z) == p &&
+                  slap_NumCols(z) == 1,
+              SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS, SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              "KalmanUpdateSequential: R must be %d x %d and z must be a vector of length "
+              "%d",
+              p, p, p);
+  SLAP_ASSERT_DENSE(work, SLAP_MATRIX_NOT_DENSE,
+                    "KalmanUpdateSequential: work must be dense");
+  SLAP_ASSERT(slap_NumElements(work) >= 2 * n, SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              "KalmanUpdateSequential: work must have at least %d elements", 2 * n);
+
+  const slap_Kernels* kernels = slap_GetKernels();
+  sfloat* h = work.data;
+  sfloat* Ph = work.data + n;
+  for (int k = 0; k < p; ++k) {
+    // P h' and the scalar innovation, with its variance
+    sfloat y = *slap_GetElement(z, k, 0);
+    for (int i = 0; i < n; ++i) {
+      h[i] = *slap_GetElement(H, k, i);
+      y -= h[i] * *slap_GetElement(x, i, 0);
+    }
+    slap_MatMulAdd(slap_MatrixFromArray(n, 1, Ph), P, slap_MatrixFromArray(n, 1, h), 1, 0);
+    sfloat s = slap_SymmetricElement(R, k, k) + kernels->dot(n, h, Ph);
+    if (!(s > 0)) {
+      return SLAP_CHOLESKY_FAIL;
+    }
+
+    for (int i = 0; i < n; ++i) {
+      *slap_GetElement(x, i, 0) += y / s * Ph[i];
+    }
+
+    // Rank-1 update of the lower triangle of the stored data, which is the same matrix
+    // whether or not P is transposed since it's symmetric
+    for (int j = 0; j < n; ++j) {
+      sfloat* Pj = P.data + j * P.sy;
+      kernels->axpy(n - j, -Ph[j] / s, Ph + j, Pj + j);
+      for (int i = j + 1; i < n; ++i) {
+        P.data[j + i * P.sy] = Pj[i];
+      }
+    }
+  }
+  return SLAP_NO_ERROR;
+}
+
+size_t slap_KalmanUpdateSequentialWorkspaceSize(int n) {
+  return slap_ArenaMatrixSize(2 * n, 1);
+}
@@ -0,0 +1,186 @@
+//
+// Created by Brian Jackson on 10/18/26.
+// Copyright (c) 2026 Robotic Exploration Lab. All rights reserved.
+//
+
+#pragma once
+
+#include <stddef.h>
+
+#include "matrix.h"
+
+/**
+ * @brief Kalman filter time update
+ *
+ * Computes
+ * \f[
+ * \begin{aligned}
+ * x &\leftarrow F x \\
+ * P &\leftarrow F P F^T + Q
+ * \end{aligned}
+ * \f]
+ *
+ * \f$ P F^T \f$ is computed with slap_MatMulAdd(), and only the lower triangle of the new
+ * covariance is computed from it, with the `dot` kernel from slap_GetKernels(). It's
+ * copied to the upper triangle, so @p P stays exactly symmetric.
+ *
+ * For an extended Kalman filter, propagate the state with the nonlinear dynamics and pass
+ * a null matrix for @p x, so that only the covariance is updated with the Jacobian @p F.
+ *
+ * **Header File:** `slap/kalman.h`
+ * @param[inout] x State estimate of length n, or a null matrix to skip it
+ * @param[inout] P n x n symmetric state covariance
+ * @param[in] F n x n state transition matrix
+ * @param[in] Q n x n symmetric process noise covariance. Can be a diagonal matrix.
+ * @param work A dense workspace with at least `n (2n + 1)` elements, e.g. from an arena
+ *             with slap_KalmanPredictWorkspaceSize() bytes
+ * @return slap error code
+ */
+enum slap_ErrorCode slap_KalmanPredict(Matrix x, Matrix P, Matrix F, Matrix Q,
+                                       Matrix work);
+
+/**
+ * @brief Arena bytes needed for the workspace of slap_KalmanPredict()
+ *
+ * Covers the @p work vector, allocated with slap_ArenaNewMatrix().
+ *
+ * **Header File:** `slap/kalman.h`
+ * @param n Number of states
+ */
+size_t slap_KalmanPredictWorkspaceSize(int n);
+
+/**
+ * @brief Kalman filter measurement update
+ *
+ * Computes
+ * \f[
+ * \begin{aligned}
+ * S &= H P H^T + R \\
+ * K &= P H^T S^{-1} \\
+ * x &\leftarrow x + K (z - H x) \\
+ * P &\leftarrow P - K S K^T
+ * \end{aligned}
+ * \f]
+ *
+ * The innovation covariance is factored as \f$ S = L L^T \f$ instead of being inverted,
+ * and the covariance update is the downdate \f$ P \leftarrow P - G^T G \f$ with
+ * \f$ G = L^{-1} H P \f$. Only the lower triangles of \f$ S \f$ and @p P are computed,
+ * with the `dot` kernel from slap_GetKernels(), and they're copied to the upper
+ * triangles, so @p P stays exactly symmetric.
+ *
+ * This is the standard form of the update, which costs \f$ O(p n^2) \f$ on top of the
+ * factorization. It subtracts from @p P, so rounding errors can make it indefinite when a
+ * measurement is much more accurate than the prior. slap_KalmanUpdateJoseph() avoids this
+ * for \f$ O(n^3) \f$ more work.
+ *
+ * A single measurement (`p = 1`) is handled by slap_KalmanUpdateSequential(), which
+ * doesn't need a factorization.
+ *
+ * For an extended Kalman filter, pass \f$ z - h(x) + H x \f$ as the measurement.
+ *
+ * **Header File:** `slap/kalman.h`
+ * @param[inout] x State estimate of length n
+ * @param[inout] P n x n symmetric state covariance
+ * @param[in] z Measurement of length p
+ * @param[in] H p x n measurement matrix
+ * @param[in] R p x p symmetric measurement noise covariance. Can be a diagonal matrix.
+ * @param work A dense workspace with at least `p (2n + p + 1)` elements, e.g. from an
+ *             arena with slap_KalmanUpdateWorkspaceSize() bytes
+ * @return SLAP_NO_ERROR, or SLAP_CHOLESKY_FAIL if \f$ S \f$ isn't positive definite, in
+ *         which case @p x and @p P aren't modified.
+ */
+enum slap_ErrorCode slap_KalmanUpdate(Matrix x, Matrix P, Matrix z, Matrix H, Matrix R,
+                                      Matrix work);
+
+/**
+ * @brief Arena bytes needed for the workspace of slap_KalmanUpdate()
+ *
+ * Covers the @p work vector, allocated with slap_ArenaNewMatrix().
+ *
+ * **Header File:** `slap/kalman.h`
+ * @param n Number of states
+ * @param p Number of measurements
+ */
+size_t slap_KalmanUpdateWorkspaceSize(int n, int p);
+
+/**
+ * @brief Kalman filter measurement update in Joseph form
+ *
+ * Computes the same state update as slap_KalmanUpdate(), but updates the covariance with
+ * \f[
+ * P \leftarrow (I - K H) P (I - K H)^T + K R K^T
+ * \f]
+ * which equals \f$ P - K S K^T \f$ for the optimal gain, but is a sum of positive
+ * semi-definite terms, so it stays positive definite despite rounding errors in
+ * \f$ K \f$. The gain is computed from the factorization of \f$ S \f$ as
+ * \f$ K^T = L^{-T} G \f$, and the final product only computes the lower triangle of
+ * @p P, like slap_KalmanUpdate().
+ *
+ * The products with \f$ I - K H \f$ cost \f$ O(n^3) \f$, so prefer slap_KalmanUpdate()
+ * when the measurements aren't much more accurate than the state estimate. Unlike
+ * slap_KalmanUpdate(), a single measurement isn't passed to
+ * slap_KalmanUpdateSequential().
+ *
+ * **Header File:** `slap/kalman.h`
+ * @param[inout] x State estimate of length n
+ * @param[inout] P n x n symmetric state covariance
+ * @param[in] z Measurement of length p
+ * @param[in] H p x n measurement matrix
+ * @param[in] R p x p symmetric measurement noise covariance. Can be a diagonal matrix.
+ * @param work A dense workspace with at least `p (2n + p + 1) + 2n^2` elements, e.g. from
+ *             an arena with slap_KalmanUpdateJosephWorkspaceSize() bytes
+ * @return SLAP_NO_ERROR, or SLAP_CHOLESKY_FAIL if \f$ S \f$ isn't positive definite, in
+ *         which case @p x and @p P aren't modified.
+ */
+enum slap_ErrorCode slap_KalmanUpdateJoseph(Matrix x, Matrix P, Matrix z, Matrix H,
+                                            Matrix R, Matrix work);
+
+/**
+ * @brief Arena bytes needed for the workspace of slap_KalmanUpdateJoseph()
+ *
+ * Covers the @p work vector, allocated with slap_ArenaNewMatrix().
+ *
+ * **Header File:** `slap/kalman.h`
+ * @param n Number of states
+ * @param p Number of measurements
+ */
+size_t slap_KalmanUpdateJosephWorkspaceSize(int n, int p);
+
+/**
+ * @brief Kalman filter update with independent measurements, processed one at a time
+ *
+ * When the measurement noise is uncorrelated, the update of slap_KalmanUpdate() is the
+ * same as applying each measurement in turn. For row \f$ h \f$ of @p H, the innovation
+ * covariance is the scalar \f$ s = h P h^T + r \f$, so the update is
+ * \f[
+ * \begin{aligned}
+ * x &\leftarrow x + \frac{z - h x}{s} P h^T \\
+ * P &\leftarrow P - \frac{1}{s} (P h^T)(P h^T)^T
+ * \end{aligned}
+ * \f]
+ * with one product with @p P and a rank-1 update of its lower triangle with the `axpy`
+ * kernel. This costs \f$ O(p n^2) \f$ with no factorization, which is cheaper than
+ * slap_KalmanUpdate() for a few measurements.
+ *
+ * **Header File:** `slap/kalman.h`
+ * @param[inout] x State estimate of length n
+ * @param[inout] P n x n symmetric state covariance
+ * @param[in] z Measurement of length p
+ * @param[in] H p x n measurement matrix
+ * @param[in] R p x p measurement noise covariance, usually a diagonal matrix. Only the
+ *              diagonal is used.
+ * @param work A dense workspace with at least `2n` elements, e.g. from an arena with
+ *             slap_KalmanUpdateSequentialWorkspaceSize() bytes
+ * @return SLAP_NO_ERROR, or SLAP_CHOLESKY_FAIL if the innovation covariance of a
+ *         measurement isn't positive. The measurements before it have been applied.
+ */
+enum slap_ErrorCode slap_KalmanUpdateSequential(Matrix x, Matrix P, Matrix z, Matrix H,
+                                                Matrix R, Matrix work);
+
+/**
+ * @brief Arena bytes needed for the workspace of slap_KalmanUpdateSequential()
+ *
+ * **Header File:** `slap/kalman.h`
+ * @param n Number of states
+ */
+size_t slap_KalmanUpdateSequentialWorkspaceSize(int n);
@@ -0,0 +1,176 @@
+//
+// Created by Brian Jackson on 10/18/26.
+// Copyright (c) 2026 Robotic Exploration Lab. All rights reserved.
+//
+
+#include "kernels.h"
+
+#include "gemm.h"
+
+#define MR SLAP_GEMM_MR
+#define NR SLAP_GEMM_NR
+
+// Kernel tables defined in the ISA-specific translation units
+#ifdef SLAP_HAS_AVX2
+extern const slap_Kernels slap_kernels_avx2;
+#endif
+#ifdef SLAP_HAS_AVX512
+extern const slap_Kernels slap_kernels_avx512;
+#endif
+
+/*
+ * Scalar kernels
+ *
+ * Written with compile-time loop bounds and local accumulators so that the compiler can
+ * still auto-vectorize them for whatever baseline instruction set it targets.
+ */
+static void GemmScalar(int kc, const sfloat* Ap, const sfloat* Bp, sfloat* AB) {
+  sfloat acc[MR * NR] = {0};
+  for (int p = 0; p < kc; ++p) {
+    for (int j = 0; j < NR; ++j) {
+      sfloat bj = Bp[j];
+      for (int i = 0; i < MR; ++i) {
+        acc[i + j * MR] += Ap[i] * bj;
+      }
+    }
+    Ap += MR;
+    Bp += NR;
+  }
+  for (int k = 0; k < MR * NR; ++k) {
+    AB[k] = acc[k];
+  }
+}
+
+static void AxpyScalar(int n, sfloat alpha, const sfloat* x, sfloat* y) {
+  for (int i = 0; i < n; ++i) {
+    y[i] += alpha * x[i];
+  }
+}
+
+static sfloat DotScalar(int n, const sfloat* x, const sfloat* y) {
+  sfloat dot = 0;
+  for (int i = 0; i < n; ++i) {
+    dot += x[i] * y[i];
+  }
+  return dot;
+}
+
+static void RotScalar(int n, sfloat c, sfloat s, sfloat* x, sfloat* y) {
+  for (int i = 0; i < n; ++i) {
+    sfloat xi = x[i];
+    sfloat yi = y[i];
+    x[i] = c * xi + s * yi;
+    y[i] = c * yi - s * xi;
+  }
+}
+
+static const slap_Kernels slap_kernels_scalar = {
+    SLAP_ISA_SCALAR,
+    GemmScalar,
+    AxpyScalar,
+    DotScalar,
+    RotScalar,
+};
+
+/*
+ * Dispatch
+ */
+static const slap_Kernels* slap_active_kernels = NULL;
+
+static bool CPUSupports(enum slap_ISA isa) {
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+  switch (isa) {
+    case SLAP_ISA_SCALAR:
+      return true;
+    case SLAP_ISA_AVX2:
+      return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+    case SLAP_ISA_AVX512:
+      return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx2") &&
+             __builtin_cpu_supports("fma");
+  }
+  return false;
+#else
+  return isa == SLAP_ISA_SCALAR;
+#endif
+}
+
+static const slap_Kernels* KernelTable(enum slap_ISA isa) {
+  switch (isa) {
+#ifdef SLAP_HAS_AVX2
+    case SLAP_ISA_AVX2:
+      return &slap_kernels_avx2;
+#endif
+#ifdef SLAP_HAS_AVX512
+    case SLAP_ISA_AVX512:
+      return &slap_kernels_avx512;
+#endif
+    case SLAP_ISA_SCALAR:
+      return &slap_kernels_scalar;
+    default:
+      return NULL;
+  }
+}
+
+bool slap_ISASupported(enum slap_ISA isa) {
+  return KernelTable(isa) != NULL && CPUSupports(isa);
+}
+
+const slap_Kernels* slap_GetKernels(void) {
+  if (slap_active_kernels == NULL) {
+    enum slap_ISA best = SLAP_ISA_SCALAR;
+    if (slap_ISASupported(SLAP_ISA_AVX2)) {
+      best = SLAP_ISA_AVX2;
+    }
+    if (slap_ISASupported(SLAP_ISA_AVX512)) {
+      best = SLAP_ISA_AVX512;
+    }
+    slap_active_kernels = KernelTable(best);
+  }
+  return slap_active_kernels;
+}
+
+enum slap_ISA slap_GetISA(void) { return slap_GetKernels()->isa; }
+
+enum slap_ErrorCode slap_SetISA(enum slap_ISA isa) {
+  if (!slap_ISASupported(isa)) {
+    return SLAP_ERROR(SLAP_UNSUPPORTED_ISA, "SetISA: %s kernels are not available",
+                      slap_ISAName(isa));
+  }
+  slap_active_kernels = KernelTable(isa);
+  return SLAP_NO_ERROR;
+}
+
+const char* slap_ISAName(enum slap_ISA isa) {
+  switch (isa) {
+    case SLAP_ISA_SCALAR:
+      return "Scalar";
+    case SLAP_ISA_AVX2:
+      return "AVX2";
+    case SLAP_ISA_AVX512:
+      return "AVX-512";
+  }
+  return "Unknown";
+}
+
+void slap_AxpyStrided(const slap_Kernels* kernels, int n, sfloat alpha, const sfloat* x,
+                      int incx, sfloat* y, int incy) {
+  if (incx == 1 && incy == 1) {
+    kernels->axpy(n, alpha, x, y);
+    return;
+  }
+  for (int i = 0; i < n; ++i) {
+    y[i * incy] += alpha * x[i * incx];
+  }
+}
+
+sfloat slap_DotStrided(const slap_Kernels* kernels, int n, const sfloat* x, int incx,
+                       const sfloat* y, int incy) {
+  if (incx == 1 && incy == 1) {
+    return kernels->dot(n, x, y);
+  }
+  sfloat sum = 0;
+  for (int i = 0; i < n; ++i) {
+    sum += x[i * incx] * y[i * incy];
+  }
+  return sum;
+}
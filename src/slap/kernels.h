@@ -0,0 +1,110 @@
+//
+// Created by Brian Jackson on 10/18/26.
+// Copyright (c) 2026 Robotic Exploration Lab. All rights reserved.
+//
+
+#pragma once
+
+#include "matrix.h"
+
+/**
+ * @brief Instruction sets with hand-vectorized kernels
+ *
+ * Only the scalar kernels are always available. The others are compiled when building
+ * for x86-64 with the `SLAP_SIMD` CMake option, and are only used if the CPU running the
+ * program supports them.
+ */
+enum slap_ISA {
+  SLAP_ISA_SCALAR = 0,
+  SLAP_ISA_AVX2,    //!< AVX2 + FMA
+  SLAP_ISA_AVX512,  //!< AVX-512F
+};
+
+/**
+ * @brief Table of the low-level kernels used by the hot loops in slap
+ *
+ * All kernels operate on contiguous data. The entries are never NULL.
+ */
+typedef struct slap_Kernels {
+  enum slap_ISA isa;  //!< instruction set the kernels were compiled for
+
+  /**
+   * GEMM micro-kernel. Multiplies a packed `SLAP_GEMM_MR x kc` panel of A with a packed
+   * `kc x SLAP_GEMM_NR` panel of B, storing the column-major result in AB.
+   */
+  void (*gemm)(int kc, const sfloat* Ap, const sfloat* Bp, sfloat* AB);
+
+  /** Calculates `y = y + alpha * x` for vectors of length n */
+  void (*axpy)(int n, sfloat alpha, const sfloat* x, sfloat* y);
+
+  /** Returns the inner product of two vectors of length n */
+  sfloat (*dot)(int n, const sfloat* x, const sfloat* y);
+
+  /**
+   * Applies a plane rotation to vectors of length n, setting `x = c * x + s * y` and
+   * `y = c * y - s * x` from the original values of x and y
+   */
+  void (*rot)(int n, sfloat c, sfloat s, sfloat* x, sfloat* y);
+} slap_Kernels;
+
+/**
+ * @brief Get the kernels for the active instruction set
+ *
+ * The first call selects the best instruction set supported by the CPU.
+ *
+ * **Header File:** `slap/kernels.h`
+ */
+const slap_Kernels* slap_GetKernels(void);
+
+/**
+ * @brief Get the instruction set of the active kernels
+ *
+ * **Header File:** `slap/kernels.h`
+ */
+enum slap_ISA slap_GetISA(void);
+
+/**
+ * @brief Check if kernels for an instruction set are compiled in and supported by the CPU
+ *
+ * **Header File:** `slap/kernels.h`
+ */
+bool slap_ISASupported(enum slap_ISA isa);
+
+/**
+ * @brief Override the instruction set selected at startup
+ *
+ * Mostly useful for testing and benchmarking the different kernels against each other.
+ *
+ * **Header File:** `slap/kernels.h`
+ * @param isa Instruction set to use
+ * @return SLAP_UNSUPPORTED_ISA if the kernels aren't available on this machine, in which
+ *         case the active kernels are unchanged.
+ */
+enum slap_ErrorCode slap_SetISA(enum slap_ISA isa);
+
+/**
+ * @brief Human-readable name of an instruction set
+ *
+ * **Header File:** `slap/kernels.h`
+ */
+const char* slap_ISAName(enum slap_ISA isa);
+
+/**
+ * @brief Calculates `y = y + alpha * x` for two strided vectors of length n
+ *
+ * Uses the axpy kernel when both vectors are contiguous.
+ *
+ * **Header File:** `slap/kernels.h`
+ */
+void slap_AxpyStrided(const slap_Kernels* kernels, int n, sfloat alpha, const sfloat* x,
+                      int incx, sfloat* y, int incy);
+
+/**
+ * @brief Returns the inner product of two strided vectors of length n
+ *
+ * Uses the dot kernel when both vectors are contiguous.
+ *
+ * **Header File:** `slap/kernels.h`
+ */
+sfloat slap_DotStrided(const slap_Kernels* kernels, int n, const sfloat* x, int incx,
+                       const sfloat* y, int incy);
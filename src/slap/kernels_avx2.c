@@ -0,0 +1,203 @@
+//
+// Created by Brian Jackson on 10/18/26.
+// Copyright (c) 2026 Robotic Exploration Lab. All rights reserved.
+//
+
+/*
+ * AVX2 + FMA kernels. This file is compiled with `-mavx2 -mfma` by CMake, and the kernels
+ * are only called after checking the CPU supports them (see kernels.c).
+ */
+
+#include "kernels.h"
+
+#if defined(SLAP_HAS_AVX2) && defined(__AVX2__) && defined(__FMA__)
+
+#include <immintrin.h>
+
+#include "gemm.h"
+
+#define MR SLAP_GEMM_MR
+#define NR SLAP_GEMM_NR
+
+#ifdef SLAP_SINGLE_PRECISION
+
+// 8 floats per register: one register per column of the 8x4 tile
+static void GemmAVX2(int kc, const float* Ap, const float* Bp, float* AB) {
+  __m256 c0 = _mm256_setzero_ps();
+  __m256 c1 = _mm256_setzero_ps();
+  __m256 c2 = _mm256_setzero_ps();
+  __m256 c3 = _mm256_setzero_ps();
+  for (int p = 0; p < kc; ++p) {
+    __m256 a = _mm256_loadu_ps(Ap);
+    c0 = _mm256_fmadd_ps(a, _mm256_broadcast_ss(Bp + 0), c0);
+    c1 = _mm256_fmadd_ps(a, _mm256_broadcast_ss(Bp + 1), c1);
+    c2 = _mm256_fmadd_ps(a, _mm256_broadcast_ss(Bp + 2), c2);
+    c3 = _mm256_fmadd_ps(a, _mm256_broadcast_ss(Bp + 3), c3);
+    Ap += MR;
+    Bp += NR;
+  }
+  _mm256_storeu_ps(AB + 0 * MR, c0);
+  _mm256_storeu_ps(AB + 1 * MR, c1);
+  _mm256_storeu_ps(AB + 2 * MR, c2);
+  _mm256_storeu_ps(AB + 3 * MR, c3);
+}
+
+static void AxpyAVX2(int n, float alpha, const float* x, float* y) {
+  __m256 a = _mm256_set1_ps(alpha);
+  int i = 0;
+  for (; i + 8 <= n; i += 8) {
+    __m256 yi = _mm256_fmadd_ps(a, _mm256_loadu_ps(x + i), _mm256_loadu_ps(y + i));
+    _mm256_storeu_ps(y + i, yi);
+  }
+  for (; i < n; ++i) {
+    y[i] += alpha * x[i];
+  }
+}
+
+static float DotAVX2(int n, const float* x, const float* y) {
+  __m256 acc0 = _mm256_setzero_ps();
+  __m256 acc1 = _mm256_setzero_ps();
+  int i = 0;
+  for (; i + 16 <= n; i += 16) {
+    acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(x + i), _mm256_loadu_ps(y + i), acc0);
+    acc1 = _mm256_fmadd_ps(_mm256_loadu_ps(x + i + 8), _mm256_loadu_ps(y + i + 8), acc1);
+  }
+  for (; i + 8 <= n; i += 8) {
+    acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(x + i), _mm256_loadu_ps(y + i), acc0);
+  }
+  acc0 = _mm256_add_ps(acc0, acc1);
+  __m128 sum4 = _mm_add_ps(_mm256_castps256_ps128(acc0), _mm256_extractf128_ps(acc0, 1));
+  sum4 = _mm_add_ps(sum4, _mm_movehl_ps(sum4, sum4));
+  sum4 = _mm_add_ss(sum4, _mm_movehdup_ps(sum4));
+  float dot = _mm_cvtss_f32(sum4);
+  for (; i < n; ++i) {
+    dot += x[i] * y[i];
+  }
+  return dot;
+}
+
+static void RotAVX2(int n, float c, float s, float* x, float* y) {
+  __m256 cv = _mm256_set1_ps(c);
+  __m256 sv = _mm256_set1_ps(s);
+  int i = 0;
+  for (; i + 8 <= n; i += 8) {
+    __m256 xi = _mm256_loadu_ps(x + i);
+    __m256 yi = _mm256_loadu_ps(y + i);
+    _mm256_storeu_ps(x + i, _mm256_fmadd_ps(cv, xi, _mm256_mul_ps(sv, yi)));
+    _mm256_storeu_ps(y + i, _mm256_fmsub_ps(cv, yi, _mm256_mul_ps(sv, xi)));
+  }
+  for (; i < n; ++i) {
+    float xi = x[i];
+    float yi = y[i];
+    x[i] = c * xi + s * yi;
+    y[i] = c * yi - s * xi;
+  }
+}
+
+#else
+
+// 4 doubles per register: two registers per column of the 8x4 tile
+static void GemmAVX2(int kc, const double* Ap, const double* Bp, double* AB) {
+  __m256d c00 = _mm256_setzero_pd();
+  __m256d c10 = _mm256_setzero_pd();
+  __m256d c01 = _mm256_setzero_pd();
+  __m256d c11 = _mm256_setzero_pd();
+  __m256d c02 = _mm256_setzero_pd();
+  __m256d c12 = _mm256_setzero_pd();
+  __m256d c03 = _mm256_setzero_pd();
+  __m256d c13 = _mm256_setzero_pd();
+  for (int p = 0; p < kc; ++p) {
+    __m256d a0 = _mm256_loadu_pd(Ap);
+    __m256d a1 = _mm256_loadu_pd(Ap + 4);
+    __m256d b = _mm256_broadcast_sd(Bp + 0);
+    c00 = _mm256_fmadd_pd(a0, b, c00);
+    c10 = _mm256_fmadd_pd(a1, b, c10);
+    b = _mm256_broadcast_sd(Bp + 1);
+    c01 = _mm256_fmadd_pd(a0, b, c01);
+    c11 = _mm256_fmadd_pd(a1, b, c11);
+    b = _mm256_broadcast_sd(Bp + 2);
+    c02 = _mm256_fmadd_pd(a0, b, c02);
+    c12 = _mm256_fmadd_pd(a1, b, c12);
+    b = _mm256_broadcast_sd(Bp + 3);
+    c03 = _mm256_fmadd_pd(a0, b, c03);
+    c13 = _mm256_fmadd_pd(a1, b, c13);
+    Ap += MR;
+    Bp += NR;
+  }
+  _mm256_storeu_pd(AB + 0 * MR, c00);
+  _mm256_storeu_pd(AB + 0 * MR + 4, c10);
+  _mm256_storeu_pd(AB + 1 * MR, c01);
+  _mm256_storeu_pd(AB + 1 * MR + 4, c11);
+  _mm256_storeu_pd(AB + 2 * MR, c02);
+  _mm256_storeu_pd(AB + 2 * MR + 4, c12);
+  _mm256_storeu_pd(AB + 3 * MR, c03);
+  _mm256_storeu_pd(AB + 3 * MR + 4, c13);
+}
+
+static void AxpyAVX2(int n, double alpha, const double* x, double* y) {
+  __m256d a = _mm256_set1_pd(alpha);
+  int i = 0;
+  for (; i + 4 <= n; i += 4) {
+    __m256d yi = _mm256_fmadd_pd(a, _mm256_loadu_pd(x + i), _mm256_loadu_pd(y + i));
+    _mm256_storeu_pd(y + i, yi);
+  }
+  for (; i < n; ++i) {
+    y[i] += alpha * x[i];
+  }
+}
+
+static double DotAVX2(int n, const double* x, const double* y) {
+  __m256d acc0 = _mm256_setzero_pd();
+  __m256d acc1 = _mm256_setzero_pd();
+  int i = 0;
+  for (; i + 8 <= n; i += 8) {
+    acc0 = _mm256_fmadd_pd(_mm256_loadu_pd(x + i), _mm256_loadu_pd(y + i), acc0);
+    acc1 = _mm256_fmadd_pd(_mm256_loadu_pd(x + i + 4), _mm256_loadu_pd(y + i + 4), acc1);
+  }
+  for (; i + 4 <= n; i += 4) {
+    acc0 = _mm256_fmadd_pd(_mm256_loadu_pd(x + i), _mm256_loadu_pd(y + i), acc0);
+  }
+  acc0 = _mm256_add_pd(acc0, acc1);
+  __m128d sum2 = _mm_add_pd(_mm256_castpd256_pd128(acc0), _mm256_extractf128_pd(acc0, 1));
+  sum2 = _mm_add_sd(sum2, _mm_unpackhi_pd(sum2, sum2));
+  double dot = _mm_cvtsd_f64(sum2);
+  for (; i < n; ++i) {
+    dot += x[i] * y[i];
+  }
+  return dot;
+}
+
+static void RotAVX2(int n, double c, double s, double* x, double* y) {
+  __m256d cv = _mm256_set1_pd(c);
+  __m256d sv = _mm256_set1_pd(s);
+  int i = 0;
+  for (; i + 4 <= n; i += 4) {
+    __m256d xi = _mm256_loadu_pd(x + i);
+    __m256d yi = _mm256_loadu_pd(y + i);
+    _mm256_storeu_pd(x + i, _mm256_fmadd_pd(cv, xi, _mm256_mul_pd(sv, yi)));
+    _mm256_storeu_pd(y + i, _mm256_fmsub_pd(cv, yi, _mm256_mul_pd(sv, xi)));
+  }
+  for (; i < n; ++i) {
+    double xi = x[i];
+    double yi = y[i];
+    x[i] = c * xi + s * yi;
+    y[i] = c * yi - s * xi;
+  }
+}
+
+#endif
+
+const slap_Kernels slap_kernels_avx2 = {
+    SLAP_ISA_AVX2,
+    GemmAVX2,
+    AxpyAVX2,
+    DotAVX2,
+    RotAVX2,
+};
+
+#else
+
+// ISO C forbids an empty translation unit
+typedef int slap_kernels_avx2_unused;
+
+#endif
@@ -0,0 +1,180 @@
+//
+// Created by Brian Jackson on 10/18/26.
+// Copyright (c) 2026 Robotic Exploration Lab. All rights reserved.
+//
+
+/*
+ * AVX-512F kernels. This file is compiled with `-mavx512f -mavx2 -mfma` by CMake, and the
+ * kernels are only called after checking the CPU supports them (see kernels.c).
+ */
+
+#include "kernels.h"
+
+#if defined(SLAP_HAS_AVX512) && defined(__AVX512F__)
+
+#include <immintrin.h>
+
+#include "gemm.h"
+
+#define MR SLAP_GEMM_MR
+#define NR SLAP_GEMM_NR
+
+#ifdef SLAP_SINGLE_PRECISION
+
+// The 8x4 tile only fills half a 512-bit register of floats, so the micro-kernel uses
+// 256-bit FMAs. The vector kernels use the full width.
+static void GemmAVX512(int kc, const float* Ap, const float* Bp, float* AB) {
+  __m256 c0 = _mm256_setzero_ps();
+  __m256 c1 = _mm256_setzero_ps();
+  __m256 c2 = _mm256_setzero_ps();
+  __m256 c3 = _mm256_setzero_ps();
+  for (int p = 0; p < kc; ++p) {
+    __m256 a = _mm256_loadu_ps(Ap);
+    c0 = _mm256_fmadd_ps(a, _mm256_broadcast_ss(Bp + 0), c0);
+    c1 = _mm256_fmadd_ps(a, _mm256_broadcast_ss(Bp + 1), c1);
+    c2 = _mm256_fmadd_ps(a, _mm256_broadcast_ss(Bp + 2), c2);
+    c3 = _mm256_fmadd_ps(a, _mm256_broadcast_ss(Bp + 3), c3);
+    Ap += MR;
+    Bp += NR;
+  }
+  _mm256_storeu_ps(AB + 0 * MR, c0);
+  _mm256_storeu_ps(AB + 1 * MR, c1);
+  _mm256_storeu_ps(AB + 2 * MR, c2);
+  _mm256_storeu_ps(AB + 3 * MR, c3);
+}
+
+static void AxpyAVX512(int n, float alpha, const float* x, float* y) {
+  __m512 a = _mm512_set1_ps(alpha);
+  int i = 0;
+  for (; i + 16 <= n; i += 16) {
+    __m512 yi = _mm512_fmadd_ps(a, _mm512_loadu_ps(x + i), _mm512_loadu_ps(y + i));
+    _mm512_storeu_ps(y + i, yi);
+  }
+  if (i < n) {
+    __mmask16 mask = (__mmask16)((1u << (n - i)) - 1u);
+    __m512 xi = _mm512_maskz_loadu_ps(mask, x + i);
+    __m512 yi = _mm512_maskz_loadu_ps(mask, y + i);
+    _mm512_mask_storeu_ps(y + i, mask, _mm512_fmadd_ps(a, xi, yi));
+  }
+}
+
+static float DotAVX512(int n, const float* x, const float* y) {
+  __m512 acc = _mm512_setzero_ps();
+  int i = 0;
+  for (; i + 16 <= n; i += 16) {
+    acc = _mm512_fmadd_ps(_mm512_loadu_ps(x + i), _mm512_loadu_ps(y + i), acc);
+  }
+  if (i < n) {
+    __mmask16 mask = (__mmask16)((1u << (n - i)) - 1u);
+    acc = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, x + i),
+                          _mm512_maskz_loadu_ps(mask, y + i), acc);
+  }
+  return _mm512_reduce_add_ps(acc);
+}
+
+static void RotAVX512(int n, float c, float s, float* x, float* y) {
+  __m512 cv = _mm512_set1_ps(c);
+  __m512 sv = _mm512_set1_ps(s);
+  int i = 0;
+  for (; i + 16 <= n; i += 16) {
+    __m512 xi = _mm512_loadu_ps(x + i);
+    __m512 yi = _mm512_loadu_ps(y + i);
+    _mm512_storeu_ps(x + i, _mm512_fmadd_ps(cv, xi, _mm512_mul_ps(sv, yi)));
+    _mm512_storeu_ps(y + i, _mm512_fmsub_ps(cv, yi, _mm512_mul_ps(sv, xi)));
+  }
+  if (i < n) {
+    __mmask16 mask = (__mmask16)((1u << (n - i)) - 1u);
+    __m512 xi = _mm512_maskz_loadu_ps(mask, x + i);
+    __m512 yi = _mm512_maskz_loadu_ps(mask, y + i);
+    _mm512_mask_storeu_ps(x + i, mask, _mm512_fmadd_ps(cv, xi, _mm512_mul_ps(sv, yi)));
+    _mm512_mask_storeu_ps(y + i, mask, _mm512_fmsub_ps(cv, yi, _mm512_mul_ps(sv, xi)));
+  }
+}
+
+#else
+
+// 8 doubles per register: one register per column of the 8x4 tile
+static void GemmAVX512(int kc, const double* Ap, const double* Bp, double* AB) {
+  __m512d c0 = _mm512_setzero_pd();
+  __m512d c1 = _mm512_setzero_pd();
+  __m512d c2 = _mm512_setzero_pd();
+  __m512d c3 = _mm512_setzero_pd();
+  for (int p = 0; p < kc; ++p) {
+    __m512d a = _mm512_loadu_pd(Ap);
+    c0 = _mm512_fmadd_pd(a, _mm512_set1_pd(Bp[0]), c0);
+    c1 = _mm512_fmadd_pd(a, _mm512_set1_pd(Bp[1]), c1);
+    c2 = _mm512_fmadd_pd(a, _mm512_set1_pd(Bp[2]), c2);
+    c3 = _mm512_fmadd_pd(a, _mm512_set1_pd(Bp[3]), c3);
+    Ap += MR;
+    Bp += NR;
+  }
+  _mm512_storeu_pd(AB + 0 * MR, c0);
+  _mm512_storeu_pd(AB + 1 * MR, c1);
+  _mm512_storeu_pd(AB + 2 * MR, c2);
+  _mm512_storeu_pd(AB + 3 * MR, c3);
+}
+
+static void AxpyAVX512(int n, double alpha, const double* x, double* y) {
+  __m512d a = _mm512_set1_pd(alpha);
+  int i = 0;
+  for (; i + 8 <= n; i += 8) {
+    __m512d yi = _mm512_fmadd_pd(a, _mm512_loadu_pd(x + i), _mm512_loadu_pd(y + i));
+    _mm512_storeu_pd(y + i, yi);
+  }
+  if (i < n) {
+    __mmask8 mask = (__mmask8)((1u << (n - i)) - 1u);
+    __m512d xi = _mm512_maskz_loadu_pd(mask, x + i);
+    __m512d yi = _mm512_maskz_loadu_pd(mask, y + i);
+    _mm512_mask_storeu_pd(y + i, mask, _mm512_fmadd_pd(a, xi, yi));
+  }
+}
+
+static double DotAVX512(int n, const double* x, const double* y) {
+  __m512d acc = _mm512_setzero_pd();
+  int i = 0;
+  for (; i + 8 <= n; i += 8) {
+    acc = _mm512_fmadd_pd(_mm512_loadu_pd(x + i), _mm512_loadu_pd(y + i), acc);
+  }
+  if (i < n) {
+    __mmask8 mask = (__mmask8)((1u << (n - i)) - 1u);
+    acc = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(mask, x + i),
+                          _mm512_maskz_loadu_pd(mask, y + i), acc);
+  }
+  return _mm512_reduce_add_pd(acc);
+}
+
+static void RotAVX512(int n, double c, double s, double* x, double* y) {
+  __m512d cv = _mm512_set1_pd(c);
+  __m512d sv = _mm512_set1_pd(s);
+  int i = 0;
+  for (; i + 8 <= n; i += 8) {
+    __m512d xi = _mm512_loadu_pd(x + i);
+    __m512d yi = _mm512_loadu_pd(y + i);
+    _mm512_storeu_pd(x + i, _mm512_fmadd_pd(cv, xi, _mm512_mul_pd(sv, yi)));
+    _mm512_storeu_pd(y + i, _mm512_fmsub_pd(cv, yi, _mm512_mul_pd(sv, xi)));
+  }
+  if (i < n) {
+    __mmask8 mask = (__mmask8)((1u << (n - i)) - 1u);
+    __m512d xi = _mm512_maskz_loadu_pd(mask, x + i);
+    __m512d yi = _mm512_maskz_loadu_pd(mask, y + i);
+    _mm512_mask_storeu_pd(x + i, mask, _mm512_fmadd_pd(cv, xi, _mm512_mul_pd(sv, yi)));
+    _mm512_mask_storeu_pd(y + i, mask, _mm512_fmsub_pd(cv, yi, _mm512_mul_pd(sv, xi)));
+  }
+}
+
+#endif
+
+const slap_Kernels slap_kernels_avx512 = {
+    SLAP_ISA_AVX512,
+    GemmAVX512,
+    AxpyAVX512,
+    DotAVX512,
+    RotAVX512,
+};
+
+#else
+
+// ISO C forbids an empty translation unit
+typedef int slap_kernels_avx512_unused;
+
+#endif
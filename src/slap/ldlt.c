@@ -0,0 +1,272 @@
+//
+// Created by Brian Jackson on 10/18/26.
+// Copyright (c) 2026 Robotic Exploration Lab. All rights reserved.
+//
+
+#include "ldlt.h"
+
+#include <math.h>
+
+#include "kernels.h"
+
+// Strided access to the elements of a (possibly transposed) matrix
+typedef struct {
+  sfloat* data;
+  int rs;
+  int cs;
+} Strided;
+
+static Strided MakeStrided(Matrix A) {
+  Strided S = {A.data, slap_RowStride(A), slap_ColStride(A)};
+  return S;
+}
+
+static inline sfloat* At(Strided A, int i, int j) { return A.data + i * A.rs + j * A.cs; }
+
+static inline void Swap(sfloat* a, sfloat* b) {
+  sfloat tmp = *a;
+  *a = *b;
+  *b = tmp;
+}
+
+// Swap rows i and p of B
+static void SwapRows(Strided B, int i, int p, int nrhs) {
+  if (i == p) {
+    return;
+  }
+  for (int j = 0; j < nrhs; ++j) {
+    Swap(At(B, i, j), At(B, p, j));
+  }
+}
+
+// Symmetrically swap rows and columns kk and kp > kk of the trailing matrix starting at
+// column k, only touching the lower triangle
+static void SymmetricSwap(Strided A, int n, int k, int kk, int kp) {
+  for (int i = kp + 1; i < n; ++i) {
+    Swap(At(A, i, kk), At(A, i, kp));
+  }
+  for (int j = kk + 1; j < kp; ++j) {
+    Swap(At(A, j, kk), At(A, kp, j));
+  }
+  Swap(At(A, kk, kk), At(A, kp, kp));
+  if (kk > k) {
+    Swap(At(A, kk, k), At(A, kp, k));
+  }
+}
+
+static sfloat Regularize(sfloat d, sfloat delta) {
+  if (fabs(d) < delta) {
+    return d < 0 ? -delta : delta;
+  }
+  return d;
+}
+
+// Eliminate column k with the 1x1 pivot A[k,k]:
+// A[k+1:n, k+1:n] -= A[k+1:n, k] A[k+1:n, k]' / d, then L[k+1:n, k] = A[k+1:n, k] / d
+static void Eliminate1x1(Strided A, int n, int k, const slap_Kernels* kernels) {
+  sfloat dinv = 1 / *At(A, k, k);
+  for (int j = k + 1; j < n; ++j) {
+    sfloat Ajk = *At(A, j, k);
+    if (Ajk != 0) {
+      slap_AxpyStrided(kernels, n - j, -dinv * Ajk, At(A, j, k), A.rs, At(A, j, j), A.rs);
+    }
+  }
+  for (int i = k + 1; i < n; ++i) {
+    *At(A, i, k) *= dinv;
+  }
+}
+
+// Eliminate columns k and k+1 with a 2x2 pivot, following LAPACK's sytf2
+static void Eliminate2x2(Strided A, int n, int k, const slap_Kernels* kernels) {
+  sfloat d21 = *At(A, k + 1, k);
+  sfloat d11 = *At(A, k + 1, k + 1) / d21;
+  sfloat d22 = *At(A, k, k) / d21;
+  sfloat t = 1 / (d11 * d22 - 1);
+  d21 = t / d21;
+  for (int j = k + 2; j < n; ++j) {
+    sfloat* Ajk = At(A, j, k);
+    sfloat* Ajk1 = At(A, j, k + 1);
+    sfloat wk = d21 * (d11 * *Ajk - *Ajk1);
+    sfloat wk1 = d21 * (d22 * *Ajk1 - *Ajk);
+    slap_AxpyStrided(kernels, n - j, -wk, Ajk, A.rs, At(A, j, j), A.rs);
+    slap_AxpyStrided(kernels, n - j, -wk1, Ajk1, A.rs, At(A, j, j), A.rs);
+    *Ajk = wk;
+    *Ajk1 = wk1;
+  }
+}
+
+// Bunch-Kaufman pivoting. Returns the first column of a zero pivot block, or -1.
+static int LDLTPivoted(Strided A, int n, int* piv, sfloat delta,
+                       const slap_Kernels* kernels) {
+  const sfloat alpha = (1 + sqrt(17.0)) / 8;
+  int fail = -1;
+  int k = 0;
+  while (k < n) {
+    int kstep = 1;
+    int kp = k;
+    sfloat absakk = fabs(*At(A, k, k));
+
+    // Largest off-diagonal entry in column k
+    int imax = k;
+    sfloat colmax = 0;
+    for (int i = k + 1; i < n; ++i) {
+      sfloat Aik = fabs(*At(A, i, k));
+      if (Aik > colmax) {
+        colmax = Aik;
+        imax = i;
+      }
+    }
+
+    if (absakk < alpha * colmax) {
+      // Largest off-diagonal entry in row/column imax of the trailing matrix
+      sfloat rowmax = 0;
+      for (int j = k; j < imax; ++j) {
+        rowmax = fmax(rowmax, fabs(*At(A, imax, j)));
+      }
+      for (int i = imax + 1; i < n; ++i) {
+        rowmax = fmax(rowmax, fabs(*At(A, i, imax)));
+      }
+      if (absakk * rowmax >= alpha * colmax * colmax) {
+        kp = k;
+      } else if (fabs(*At(A, imax, imax)) >= alpha * rowmax) {
+        kp = imax;
+      } else {
+        kp = imax;
+        kstep = 2;
+      }
+    }
+
+    int kk = k + kstep - 1;
+    if (kp != kk) {
+      SymmetricSwap(A, n, k, kk, kp);
+    }
+
+    if (kstep == 1) {
+      piv[k] = kp;
+      sfloat* Akk = At(A, k, k);
+      *Akk = Regularize(*Akk, delta);
+      if (*Akk == 0) {
+        // The column is zero, so there's nothing to eliminate
+        if (fail < 0) {
+          fail = k;
+        }
+      } else {
+        Eliminate1x1(A, n, k, kernels);
+      }
+    } else {
+      piv[k] = -kp - 1;
+      piv[k + 1] = -kp - 1;
+      Eliminate2x2(A, n, k, kernels);
+    }
+    k += kstep;
+  }
+  return fail;
+}
+
+// Without pivoting. Returns the column of a zero pivot, or -1.
+static int LDLTUnpivoted(Strided A, int n, sfloat delta, const slap_Kernels* kernels) {
+  for (int k = 0; k < n; ++k) {
+    sfloat* Akk = At(A, k, k);
+    *Akk = Regularize(*Akk, delta);
+    if (*Akk == 0) {
+      return k;
+    }
+    Eliminate1x1(A, n, k, kernels);
+  }
+  return -1;
+}
+
+enum slap_ErrorCode slap_LDLT(Matrix A, int* piv, sfloat delta) {
+  SLAP_ASSERT_VALID(A, SLAP_INVALID_MATRIX, "LDLT: matrix invalid");
+  SLAP_ASSERT(slap_IsSquare(A), SLAP_MATRIX_NOT_SQUARE, SLAP_MATRIX_NOT_SQUARE,
+              "LDLT: matrix must be square. Got size (%d,%d)", slap_NumRows(A),
+              slap_NumCols(A));
+  int n = slap_NumRows(A);
+  const slap_Kernels* kernels = slap_GetKernels();
+  int fail;
+  if (piv) {
+    fail = LDLTPivoted(MakeStrided(A), n, piv, delta, kernels);
+  } else {
+    fail = LDLTUnpivoted(MakeStrided(A), n, delta, kernels);
+  }
+  return fail < 0 ? SLAP_NO_ERROR : SLAP_SINGULAR_MATRIX;
+}
+
+size_t slap_LDLTWorkspaceSize(int n) {
+  (void)n;
+  return 0;
+}
+
+enum slap_ErrorCode slap_LDLTSolve(Matrix LDL, const int* piv, Matrix b) {
+  SLAP_ASSERT_VALID(LDL, SLAP_INVALID_MATRIX, "LDLTSolve: LDL matrix invalid");
+  SLAP_ASSERT_VALID(b, SLAP_INVALID_MATRIX, "LDLTSolve: b matrix invalid");
+  SLAP_ASSERT(slap_IsSquare(LDL), SLAP_MATRIX_NOT_SQUARE, SLAP_MATRIX_NOT_SQUARE,
+              "LDLTSolve: matrix must be square. Got size (%d,%d)", slap_NumRows(LDL),
+              slap_NumCols(LDL));
+  SLAP_ASSERT(slap_NumCols(LDL) == slap_NumRows(b), SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              "LDLTSolve: LDL has %d columns but b has %d rows", slap_NumCols(LDL),
+              slap_NumRows(b));
+  int n = slap_NumRows(LDL);
+  int nrhs = slap_NumCols(b);
+  Strided A = MakeStrided(LDL);
+  Strided B = MakeStrided(b);
+  const slap_Kernels* kernels = slap_GetKernels();
+
+  // Solve L D y = P b
+  int k = 0;
+  while (k < n) {
+    if (!piv || piv[k] >= 0) {
+      SwapRows(B, k, piv ? piv[k] : k, nrhs);
+      sfloat dinv = 1 / *At(A, k, k);
+      for (int j = 0; j < nrhs; ++j) {
+        sfloat* bk = At(B, k, j);
+        slap_AxpyStrided(kernels, n - k - 1, -*bk, At(A, k + 1, k), A.rs, bk + B.rs, B.rs);
+        *bk *= dinv;
+      }
+      k += 1;
+    } else {
+      SwapRows(B, k + 1, -piv[k] - 1, nrhs);
+      sfloat d21 = *At(A, k + 1, k);
+      sfloat d11 = *At(A, k, k) / d21;
+      sfloat d22 = *At(A, k + 1, k + 1) / d21;
+      sfloat denom = d11 * d22 - 1;
+      for (int j = 0; j < nrhs; ++j) {
+        sfloat* bk = At(B, k, j);
+        sfloat* bk1 = At(B, k + 1, j);
+        slap_AxpyStrided(kernels, n - k - 2, -*bk, At(A, k + 2, k), A.rs, bk1 + B.rs, B.rs);
+        slap_AxpyStrided(kernels, n - k - 2, -*bk1, At(A, k + 2, k + 1), A.rs, bk1 + B.rs,
+                         B.rs);
+        sfloat y1 = *bk / d21;
+        sfloat y2 = *bk1 / d21;
+        *bk = (d22 * y1 - y2) / denom;
+        *bk1 = (d11 * y2 - y1) / denom;
+      }
+      k += 2;
+    }
+  }
+
+  // Solve L' P x = y
+  k = n - 1;
+  while (k >= 0) {
+    bool is_2x2 = piv && piv[k] < 0;
+    for (int j = 0; j < nrhs; ++j) {
+      sfloat* bk = At(B, k, j);
+      *bk -= slap_DotStrided(kernels, n - k - 1, At(A, k + 1, k), A.rs, bk + B.rs, B.rs);
+      if (is_2x2) {
+        *(bk - B.rs) -= slap_DotStrided(kernels, n - k - 1, At(A, k + 1, k - 1), A.rs,
+                                        bk + B.rs, B.rs);
+      }
+    }
+    if (is_2x2) {
+      SwapRows(B, k, -piv[k] - 1, nrhs);
+      k -= 2;
+    } else {
+      if (piv) {
+        SwapRows(B, k, piv[k], nrhs);
+      }
+      k -= 1;
+    }
+  }
+  return SLAP_NO_ERROR;
+}
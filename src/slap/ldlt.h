@@ -0,0 +1,75 @@
+//
+// Created by Brian Jackson on 10/18/26.
+// Copyright (c) 2026 Robotic Exploration Lab. All rights reserved.
+//
+
+#pragma once
+
+#include <stddef.h>
+
+#include "matrix.h"
+
+/**
+ * @brief LDLᵀ decomposition of a symmetric, possibly indefinite, matrix
+ *
+ * Computes \f$ P A P^T = L D L^T \f$, where \f$ L \f$ is unit lower triangular and
+ * \f$ D \f$ is block diagonal. Like slap_Cholesky(), only the lower triangle of @p A is
+ * read, and the result is stored in the lower triangular portion of @p A: \f$ D \f$ on
+ * the diagonal and \f$ L \f$ below it. The strictly upper triangular portion is not
+ * modified.
+ *
+ * If @p piv is not NULL, uses Bunch-Kaufman pivoting, which works for any symmetric
+ * matrix. \f$ D \f$ then has 1x1 and 2x2 blocks, and the off-diagonal entry of each 2x2
+ * block is stored just below the diagonal. The pivots are stored using the same
+ * convention as LAPACK's `sytrf`, but 0-based:
+ *  - `piv[k] >= 0`: a 1x1 block, after swapping rows and columns `k` and `piv[k]`
+ *  - `piv[k] = piv[k+1] < 0`: a 2x2 block in rows `k` and `k+1`, after swapping rows and
+ *    columns `k+1` and `-piv[k] - 1`
+ *
+ * If @p piv is NULL, the matrix isn't pivoted and \f$ D \f$ is diagonal. This is stable
+ * for quasi-definite matrices, like the KKT systems of regularized optimization problems,
+ * and keeps the original ordering.
+ *
+ * Any 1x1 pivot with a magnitude less than @p delta is replaced by @p delta, keeping its
+ * sign (positive if it's zero). This dynamic regularization lets nearly singular KKT
+ * systems be factored without pivoting.
+ *
+ * # Example
+ * ```c
+ * int piv[n];
+ * slap_LDLT(A, piv, 0);
+ * slap_LDLTSolve(A, piv, x);
+ * ```
+ *
+ * **Header File:** `slap/linalg.h`
+ * @param[inout] A A square symmetric matrix. Replaced by its LDLᵀ decomposition.
+ * @param[out] piv Array of `n` pivot indices, or NULL to factor without pivoting
+ * @param[in] delta Minimum magnitude of the 1x1 pivots. Use 0 for no regularization.
+ * @return SLAP_NO_ERROR, or SLAP_SINGULAR_MATRIX if a pivot is exactly zero. Without
+ *         pivoting, the factorization stops at the zero pivot.
+ */
+enum slap_ErrorCode slap_LDLT(Matrix A, int* piv, sfloat delta);
+
+/**
+ * @brief Arena bytes needed for the workspace of slap_LDLT()
+ *
+ * Always 0, since the factorization is done in place. The pivot array is supplied by the
+ * caller.
+ *
+ * **Header File:** `slap/linalg.h`
+ * @param n Size of the matrix being factored
+ */
+size_t slap_LDLTWorkspaceSize(int n);
+
+/**
+ * @brief Solve a linear system with a precomputed LDLᵀ decomposition
+ *
+ * **Header File:** `slap/linalg.h`
+ * @param[in] LDL LDLᵀ decomposition from slap_LDLT()
+ * @param[in] piv Pivot indices from slap_LDLT(), or NULL if it was factored without
+ *                pivoting
+ * @param[inout] b The right-hand side, with any number of columns. Stores the solution
+ *               upon completion of the function.
+ * @return slap error code
+ */
+enum slap_ErrorCode slap_LDLTSolve(Matrix LDL, const int* piv, Matrix b);
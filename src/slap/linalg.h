@@ -1,3 +1,13 @@
 #include "matmul.h"
+#include "threads.h"
+#include "gemm.h"
+#include "fixed_size.h"
+#include "batched.h"
 #include "cholesky.h"
+#include "band.h"
+#include "diagonal.h"
+#include "packed.h"
+#include "blocktri.h"
+#include "ldlt.h"
+#include "lu.h"
 #include "vector_products.h"
\ No newline at end of file
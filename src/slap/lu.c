@@ -0,0 +1,197 @@
+//
+// Created by Brian Jackson on 10/18/26.
+// Copyright (c) 2026 Robotic Exploration Lab. All rights reserved.
+//
+
+#include "lu.h"
+
+#include <math.h>
+
+#include "band.h"
+#include "kernels.h"
+#include "matmul.h"
+#include "tri.h"
+
+// A dense view of an r x c block of A, starting at (i,j). A must not be transposed.
+static Matrix Block(Matrix A, int i, int j, int r, int c) {
+  Matrix block = A;
+  block.rows = r;
+  block.cols = c;
+  block.data = A.data + i + j * A.sy;
+  block.mattype = slap_DENSE;
+  return block;
+}
+
+// Swap rows i and p of A, for columns j0 to j1 - 1
+static void SwapRows(Matrix A, int i, int p, int j0, int j1) {
+  if (i == p) {
+    return;
+  }
+  int rs = slap_RowStride(A);
+  int cs = slap_ColStride(A);
+  sfloat* Ai = A.data + i * rs;
+  sfloat* Ap = A.data + p * rs;
+  for (int j = j0; j < j1; ++j) {
+    sfloat tmp = Ai[j * cs];
+    Ai[j * cs] = Ap[j * cs];
+    Ap[j * cs] = tmp;
+  }
+}
+
+// Solve L X = B, overwriting B with X, where L is the unit lower triangle of the leading
+// n x n block of L
+static void UnitLowerSolve(Matrix L, int n, Matrix B, const slap_Kernels* kernels) {
+  int rs_L = slap_RowStride(L);
+  int cs_L = slap_ColStride(L);
+  int rs_B = slap_RowStride(B);
+  int cs_B = slap_ColStride(B);
+  int m = slap_NumCols(B);
+  for (int k = 0; k < m; ++k) {
+    sfloat* x = B.data + k * cs_B;
+    for (int j = 0; j < n - 1; ++j) {
+      sfloat xj = x[j * rs_B];
+      const sfloat* Lcol = L.data + (j + 1) * rs_L + j * cs_L;
+      if (rs_L == 1 && rs_B == 1) {
+        kernels->axpy(n - j - 1, -xj, Lcol, x + j + 1);
+      } else {
+        for (int i = 0; i < n - j - 1; ++i) {
+          x[(j + 1 + i) * rs_B] -= Lcol[i * rs_L] * xj;
+        }
+      }
+    }
+  }
+}
+
+// Right-looking factorization of the leading m x n block of A, with m >= n.
+// Rows are only swapped within these n columns, and the pivots are relative to the first
+// row of A. Returns the first column with a zero pivot, or -1 if there wasn't one.
+static int LUUnblocked(Matrix A, int m, int n, int* piv, const slap_Kernels* kernels) {
+  int rs = slap_RowStride(A);
+  int cs = slap_ColStride(A);
+  int fail = -1;
+  for (int j = 0; j < n; ++j) {
+    sfloat* Ajj_ptr = A.data + j * rs + j * cs;
+
+    // Largest entry in the column, on or below the diagonal
+    int p = j;
+    sfloat max = fabs(*Ajj_ptr);
+    for (int i = j + 1; i < m; ++i) {
+      sfloat Aij = fabs(A.data[i * rs + j * cs]);
+      if (Aij > max) {
+        max = Aij;
+        p = i;
+      }
+    }
+    piv[j] = p;
+    if (max == 0) {
+      if (fail < 0) {
+        fail = j;
+      }
+      continue;
+    }
+    SwapRows(A, j, p, 0, n);
+
+    // L[j+1:m, j] = A[j+1:m, j] / A[j, j]
+    sfloat scale = 1 / *Ajj_ptr;
+    for (int i = 1; i < m - j; ++i) {
+      Ajj_ptr[i * rs] *= scale;
+    }
+
+    // A[j+1:m, j+1:n] -= L[j+1:m, j] * U[j, j+1:n]
+    const sfloat* Lcol = Ajj_ptr + rs;
+    for (int c = j + 1; c < n; ++c) {
+      sfloat* Ajc_ptr = A.data + j * rs + c * cs;
+      sfloat Ujc = *Ajc_ptr;
+      if (Ujc == 0) {
+        continue;
+      }
+      if (rs == 1) {
+        kernels->axpy(m - j - 1, -Ujc, Lcol, Ajc_ptr + 1);
+      } else {
+        for (int i = 0; i < m - j - 1; ++i) {
+          Ajc_ptr[(i + 1) * rs] -= Lcol[i * rs] * Ujc;
+        }
+      }
+    }
+  }
+  return fail;
+}
+
+// Right-looking: factor a panel of nb columns, apply its row swaps to the rest of the
+// matrix, solve for the block row of U, and update the trailing matrix.
+// Returns the first column with a zero pivot, or -1 if there wasn't one.
+static int LUBlocked(Matrix A, int n, int* piv, const slap_Kernels* kernels) {
+  const int nb = SLAP_LU_BLOCK_SIZE;
+  int fail = -1;
+  for (int k = 0; k < n; k += nb) {
+    int kb = n - k < nb ? n - k : nb;
+    int m = n - k - kb;
+    int panel_fail = LUUnblocked(Block(A, k, k, n - k, kb), n - k, kb, piv + k, kernels);
+    if (panel_fail >= 0 && fail < 0) {
+      fail = panel_fail + k;
+    }
+    for (int j = k; j < k + kb; ++j) {
+      piv[j] += k;
+      SwapRows(A, j, piv[j], 0, k);
+      SwapRows(A, j, piv[j], k + kb, n);
+    }
+    if (m > 0) {
+      // U12 = L11^{-1} A12
+      UnitLowerSolve(Block(A, k, k, kb, kb), kb, Block(A, k, k + kb, kb, m), kernels);
+
+      // A22 -= L21 U12
+      slap_MatMulAdd(Block(A, k + kb, k + kb, m, m), Block(A, k + kb, k, m, kb),
+                     Block(A, k, k + kb, kb, m), -1, 1);
+    }
+  }
+  return fail;
+}
+
+enum slap_ErrorCode slap_LU(Matrix A, int* piv) {
+  if (slap_GetType(A) == slap_BANDED) {
+    return slap_BandLU(A, piv);
+  }
+  SLAP_ASSERT_VALID(A, SLAP_INVALID_MATRIX, "LU: matrix invalid");
+  SLAP_ASSERT(piv != NULL, SLAP_BAD_POINTER, SLAP_BAD_POINTER, "LU: pivot array is NULL");
+  SLAP_ASSERT(slap_IsSquare(A), SLAP_MATRIX_NOT_SQUARE, SLAP_MATRIX_NOT_SQUARE,
+              "LU: matrix must be square. Got size (%d,%d)", slap_NumRows(A),
+              slap_NumCols(A));
+  int n = slap_NumRows(A);
+  const slap_Kernels* kernels = slap_GetKernels();
+  int fail;
+  if (n <= SLAP_LU_THRESHOLD || slap_IsTransposed(A)) {
+    fail = LUUnblocked(A, n, n, piv, kernels);
+  } else {
+    fail = LUBlocked(A, n, piv, kernels);
+  }
+  return fail < 0 ? SLAP_NO_ERROR : SLAP_SINGULAR_MATRIX;
+}
+
+size_t slap_LUWorkspaceSize(int n) {
+  (void)n;
+  return 0;
+}
+
+enum slap_ErrorCode slap_LUSolve(Matrix LU, const int* piv, Matrix b) {
+  if (slap_GetType(LU) == slap_BANDED) {
+    return slap_BandLUSolve(LU, piv, b);
+  }
+  SLAP_ASSERT_VALID(LU, SLAP_INVALID_MATRIX, "LUSolve: LU matrix invalid");
+  SLAP_ASSERT_VALID(b, SLAP_INVALID_MATRIX, "LUSolve: b matrix invalid");
+  SLAP_ASSERT(piv != NULL, SLAP_BAD_POINTER, SLAP_BAD_POINTER,
+              "LUSolve: pivot array is NULL");
+  SLAP_ASSERT(slap_IsSquare(LU), SLAP_MATRIX_NOT_SQUARE, SLAP_MATRIX_NOT_SQUARE,
+              "LUSolve: matrix must be square. Got size (%d,%d)", slap_NumRows(LU),
+              slap_NumCols(LU));
+  SLAP_ASSERT(slap_NumCols(LU) == slap_NumRows(b), SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              "LUSolve: LU has %d columns but b has %d rows", slap_NumCols(LU),
+              slap_NumRows(b));
+  int n = slap_NumRows(LU);
+  int nrhs = slap_NumCols(b);
+  for (int k = 0; k < n; ++k) {
+    SwapRows(b, k, piv[k], 0, nrhs);
+  }
+  UnitLowerSolve(LU, n, b, slap_GetKernels());
+  return slap_TriSolve(slap_UpperTri(LU), b);
+}
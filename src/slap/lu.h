@@ -0,0 +1,76 @@
+//
+// Created by Brian Jackson on 10/18/26.
+// Copyright (c) 2026 Robotic Exploration Lab. All rights reserved.
+//
+
+#pragma once
+
+#include <stddef.h>
+
+#include "matrix.h"
+
+// Matrices larger than SLAP_LU_THRESHOLD are factored in panels of SLAP_LU_BLOCK_SIZE
+// columns, so that most of the work is done by the blocked matrix multiply
+#ifndef SLAP_LU_BLOCK_SIZE
+#define SLAP_LU_BLOCK_SIZE 32
+#endif
+#ifndef SLAP_LU_THRESHOLD
+#define SLAP_LU_THRESHOLD 64
+#endif
+
+/**
+ * @brief LU decomposition with partial pivoting
+ *
+ * Computes \f$ P A = L U \f$ for a square matrix @p A, where \f$ L \f$ is unit lower
+ * triangular and \f$ U \f$ is upper triangular. Both are stored in @p A: \f$ U \f$ in the
+ * upper triangle, and the strictly lower triangle of \f$ L \f$ below the diagonal.
+ *
+ * The row permutation is stored as a sequence of swaps, using the same convention as
+ * LAPACK (but 0-based): row `k` was swapped with row `piv[k]`, in order of increasing `k`.
+ *
+ * Matrices larger than `SLAP_LU_THRESHOLD` are factored with a blocked, right-looking
+ * algorithm that does most of its work in slap_MatMulAdd(). @p A can be strided or
+ * transposed.
+ *
+ * **Header File:** `slap/linalg.h`
+ * @param[inout] A A square matrix. Replaced by its LU decomposition.
+ * @param[out] piv Array of `n` pivot indices
+ * @return SLAP_NO_ERROR, or SLAP_SINGULAR_MATRIX if a pivot is exactly zero. The
+ *         factorization is still completed, but can't be used to solve a system.
+ */
+enum slap_ErrorCode slap_LU(Matrix A, int* piv);
+
+/**
+ * @brief Arena bytes needed for the workspace of slap_LU()
+ *
+ * Always 0, since the factorization is done in place. The pivot array is supplied by the
+ * caller.
+ *
+ * **Header File:** `slap/linalg.h`
+ * @param n Size of the matrix being factored
+ */
+size_t slap_LUWorkspaceSize(int n);
+
+/**
+ * @brief Solve a linear system with a precomputed LU decomposition
+ *
+ * Solves \f$ A X = B \f$ by applying the row swaps to @p b and solving with
+ * \f$ L \f$ and \f$ U \f$.
+ *
+ * # Example
+ * ```c
+ * int piv[n];
+ * if (slap_LU(A, piv) == SLAP_SINGULAR_MATRIX) {
+ *   printf("Matrix is singular!\n");
+ * }
+ * slap_LUSolve(A, piv, x);
+ * ```
+ *
+ * **Header File:** `slap/linalg.h`
+ * @param[in] LU LU decomposition from slap_LU()
+ * @param[in] piv Pivot indices from slap_LU()
+ * @param[inout] b The right-hand side, with any number of columns. Stores the solution
+ *               upon completion of the function.
+ * @return slap error code
+ */
+enum slap_ErrorCode slap_LUSolve(Matrix LU, const int* piv, Matrix b);
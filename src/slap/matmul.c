@@ -4,6 +4,12 @@
 //
 
 #include "matmul.h"
+
+#include "band.h"
+#include "diagonal.h"
+#include "fixed_size.h"
+#include "gemm.h"
+#include "packed.h"
 #include "tri.h"
 
 enum slap_ErrorCode slap_MatMulAdd(
@@ -11,16 +17,29 @@ enum slap_ErrorCode slap_MatMulAdd(
     sfloat beta) {
 
   // Check for special structure
+  if (slap_GetType(A) == slap_DIAGONAL || slap_GetType(B) == slap_DIAGONAL ||
+      slap_GetType(C) == slap_DIAGONAL) {
+    return slap_DiagonalMatMulAdd(C, A, B, alpha, beta);
+  }
   if (slap_GetType(A) == slap_TRIANGULAR_UPPER) {
     return slap_UpperTriMulAdd(C, A, B, alpha, beta);
   }
   if (slap_GetType(A) == slap_TRIANGULAR_LOWER) {
     return slap_LowerTriMulAdd(C, A, B, alpha, beta);
   }
+  if (slap_GetType(A) == slap_BANDED) {
+    return slap_BandMatMulAdd(C, A, B, alpha, beta);
+  }
+  if (slap_IsPacked(A)) {
+    return slap_PackedMatMulAdd(C, A, B, alpha, beta);
+  }
 
   SLAP_ASSERT_VALID(C, SLAP_INVALID_MATRIX, "MatMulAdd: invalid C matrix");
   SLAP_ASSERT_VALID(A, SLAP_INVALID_MATRIX, "MatMulAdd: invalid A matrix");
   SLAP_ASSERT_VALID(B, SLAP_INVALID_MATRIX, "MatMulAdd: invalid B matrix");
+  SLAP_ASSERT(!slap_IsStructured(B) && !slap_IsStructured(C), SLAP_INVALID_MATRIX,
+              SLAP_INVALID_MATRIX,
+              "MatMulAdd: band and packed matrices are only supported as the A matrix");
   int n = slap_NumRows(A);
   int m = slap_NumCols(A);
   int p = slap_NumCols(B);
@@ -36,15 +55,31 @@ enum slap_ErrorCode slap_MatMulAdd(
               SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
               "MatMulAdd: dimension mismatch, C has %d columns, expected %d",
               slap_NumCols(C), p);
-  for (int i = 0; i < n; ++i) {    // rows of output
-    for (int j = 0; j < p; ++j) {  // Columns of output
-      sfloat* Cij = slap_GetElement(C, i, j);
-      *Cij *= beta;
+  if (slap_MatMulAddFixedSize(C, A, B, alpha, beta)) {
+    return SLAP_NO_ERROR;
+  }
+  if ((double)n * m * p >= SLAP_GEMM_THRESHOLD) {
+    return slap_MatMulBlocked(C, A, B, alpha, beta);
+  }
+
+  // Small matrices: not worth packing, but index directly with the strides and keep the
+  // running sum in a local instead of re-reading C every iteration
+  int rs_a = slap_RowStride(A);
+  int cs_a = slap_ColStride(A);
+  int rs_b = slap_RowStride(B);
+  int cs_b = slap_ColStride(B);
+  int rs_c = slap_RowStride(C);
+  int cs_c = slap_ColStride(C);
+  for (int j = 0; j < p; ++j) {    // Columns of output
+    const sfloat* Bj = B.data + j * cs_b;
+    for (int i = 0; i < n; ++i) {  // rows of output
+      const sfloat* Ai = A.data + i * rs_a;
+      sfloat ABij = 0;
       for (int k = 0; k < m; ++k) {  // columns of A, rows of B
-        sfloat Aik = *slap_GetElementConst(A, i, k);
-        sfloat Bkj = *slap_GetElementConst(B, k, j);
-        *Cij += alpha * Aik * Bkj;
+        ABij += Ai[k * cs_a] * Bj[k * rs_b];
       }
+      sfloat* Cij = C.data + i * rs_c + j * cs_c;
+      *Cij = beta == 0 ? alpha * ABij : beta * *Cij + alpha * ABij;
     }
   }
   return SLAP_NO_ERROR;
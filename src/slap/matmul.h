@@ -38,7 +38,11 @@
  * slap_MatMulAdd(slap_Transpose(C), A, B, 0.5, 1);
  * ```
  *
- * See also: slap_MatMulAB(), slap_MatMulAtB()
+ * Large products (more than `SLAP_GEMM_THRESHOLD` multiply-adds) are computed with the
+ * cache-blocked engine in slap_MatMulBlocked(). If @p beta is zero, the existing contents
+ * of @p C are ignored.
+ *
+ * See also: slap_MatMulAB(), slap_MatMulAtB(), slap_MatMulBlocked()
  *
  * **Header File:** `slap/linalg.h`
  * @param C Destination matrix
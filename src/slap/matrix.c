@@ -1,14 +1,24 @@
 #include "matrix.h"
 
 Matrix slap_MatrixFromArray(int rows, int cols, sfloat* data) {  // NOLINT(readability-non-const-parameter)
-  Matrix mat = {rows, cols, rows, 0, data, slap_DENSE};
+  Matrix mat = {rows, cols, rows, 0, data, slap_DENSE, 0, 0};
   return mat;
 }
 
-void slap_Linear2Cart(Matrix mat, int k, int* row, int* col) {  // NOLINT(bugprone-easily-swappable-parameters)
+Matrix slap_DiagonalFromArray(int n, sfloat* data) {  // NOLINT(readability-non-const-parameter)
+  Matrix mat = {n, n, 1, 0, data, slap_DIAGONAL, 0, 0};
+  return mat;
+}
+
+Matrix slap_PackedFromArray(int n, sfloat* data) {  // NOLINT(readability-non-const-parameter)
+  Matrix mat = {n, n, 1, 0, data, slap_PACKED, 0, 0};
+  return mat;
+}
+
+void slap_Linear2Cart(Matrix mat, slap_index_t k, int* row, int* col) {  // NOLINT(bugprone-easily-swappable-parameters)
   int rows = slap_NumRows(mat);
-  *row = k % rows;
-  *col = k / rows;
+  *row = (int)(k % rows);
+  *col = (int)(k / rows);
 }
 
 Matrix slap_Flatten(const Matrix mat) {
@@ -34,6 +44,8 @@ Matrix slap_Transpose(Matrix mat) {
       .is_transposed = !mat.is_transposed,
       .data = mat.data,
       .mattype = mat.mattype,
+      .kl = mat.kl,
+      .ku = mat.ku,
   };
   return new_mat;
 }
@@ -58,6 +70,12 @@ Matrix slap_Reshape(Matrix mat, int rows, int cols) {
   return new_mat;
 }
 Matrix slap_UpperTri(Matrix mat) {
+  if (slap_IsPacked(mat)) {
+    // The upper triangle of a symmetric packed matrix is the transpose of its lower one
+    Matrix new_mat = slap_LowerTri(mat);
+    new_mat.is_transposed = true;
+    return new_mat;
+  }
   Matrix new_mat = {
       .rows = mat.rows,
       .cols = mat.cols,
@@ -70,6 +88,12 @@ Matrix slap_UpperTri(Matrix mat) {
 }
 
 Matrix slap_LowerTri(Matrix mat) {
+  if (slap_IsPacked(mat)) {
+    Matrix new_mat = mat;
+    new_mat.is_transposed = false;
+    new_mat.mattype = slap_PACKED_LOWER;
+    return new_mat;
+  }
   Matrix new_mat = {
       .rows = mat.rows,
       .cols = mat.cols,
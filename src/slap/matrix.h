@@ -13,6 +13,7 @@
 
 #include <inttypes.h>
 #include <stdbool.h>
+#include <stddef.h>
 
 #include "errors.h"
 
@@ -22,12 +23,48 @@ typedef SLAP_FLOAT sfloat;
 typedef double sfloat;
 #endif
 
+// Types for matrix dimensions and linear indices.
+// By default, dimensions and strides are 16-bit, which keeps Matrix small on
+// microcontrollers. Define SLAP_WIDE_INDEX (the SLAP_WIDE_INDEX CMake option) for 32-bit
+// dimensions and pointer-sized linear indices. The wide dimensions are signed, so they
+// compare with `int` loop counters the same way the promoted 16-bit ones do. The kernels
+// still index within a matrix with `int` offsets, so a single matrix can hold at most
+// INT_MAX elements.
+#ifdef SLAP_WIDE_INDEX
+typedef int32_t slap_dim_t;
+typedef ptrdiff_t slap_index_t;
+#else
+typedef uint16_t slap_dim_t;
+typedef int slap_index_t;
+#endif
+
+// Alignment in bytes of the data and of every column of matrices created with
+// slap_NewMatrixAligned(), whose column stride is padded to a multiple of this size
+#ifndef SLAP_MATRIX_ALIGNMENT
+#if defined(__AVR__)
+#define SLAP_MATRIX_ALIGNMENT 1
+#else
+#define SLAP_MATRIX_ALIGNMENT 64
+#endif
+#endif
+
 enum slap_MatrixType {
   slap_DENSE,
 //  slap_TRANSPOSED,
   slap_TRIANGULAR_UPPER,
   slap_TRIANGULAR_LOWER,
-  //  slap_DIAGONAL
+  // Square matrix that only stores its diagonal, with element (k,k) at data[k]. See
+  // slap_DiagonalFromArray().
+  slap_DIAGONAL,
+  // LAPACK-style band storage, see slap_NewBandMatrix(). Only supported by the methods in
+  // band.h, and the methods that dispatch to them.
+  slap_BANDED,
+  // Lower triangle of a square matrix, packed column by column. See
+  // slap_PackedFromArray() and packed.h.
+  slap_PACKED,
+  // Lower triangular matrix with the same storage as slap_PACKED, e.g. a packed Cholesky
+  // factor. Created with slap_LowerTri() or slap_UpperTri() on a packed matrix.
+  slap_PACKED_LOWER,
 };
 
 
@@ -41,12 +78,14 @@ enum slap_MatrixType {
  * matrix.
  */
 typedef struct Matrix {
-  uint16_t rows;      //!< number of rows
-  uint16_t cols;      //!< number of columns
-  uint16_t sy;        //!< column stride (distance between adjacent elements in the same row)
+  slap_dim_t rows;    //!< number of rows
+  slap_dim_t cols;    //!< number of columns
+  slap_dim_t sy;      //!< column stride (distance between adjacent elements in the same row)
   bool is_transposed; //!< is transposed
   sfloat* data;       //!< pointer to the start of the data
   enum slap_MatrixType mattype;  //!< type of matrix
+  slap_dim_t kl;      //!< number of sub-diagonals in the band, for slap_BANDED
+  slap_dim_t ku;      //!< number of super-diagonals in the band, for slap_BANDED
 } Matrix;
 
 //*********************************************//
@@ -79,6 +118,49 @@ typedef struct Matrix {
  */
 Matrix slap_MatrixFromArray(int rows, int cols, sfloat* data);
 
+/**
+ * @brief Create a diagonal matrix from an array of its diagonal elements
+ *
+ * The matrix is `n x n` and has type `slap_DIAGONAL`, but only wraps the @a n diagonal
+ * elements. slap_MatMulAdd(), slap_MatrixAddition(), slap_QuadraticForm(),
+ * slap_TriSolve() and slap_Cholesky() all take advantage of the structure, so diagonal
+ * weighting matrices never need to be stored densely. Element `(k,k)` is `data[k]`, and
+ * transposing the matrix has no effect.
+ *
+ * # Example
+ * ```c
+ * sfloat weights[3] = {1.0, 10.0, 0.1};
+ * Matrix W = slap_DiagonalFromArray(3, weights);
+ * slap_MatMulAdd(C, W, B, 1, 0);  // scales the rows of B
+ * ```
+ *
+ * @param n Number of rows and columns in the matrix
+ * @param data The diagonal elements. Must not be NULL, and should have at least @a n
+ *             elements.
+ * @return A new matrix
+ */
+Matrix slap_DiagonalFromArray(int n, sfloat* data);
+
+/**
+ * @brief Create a packed matrix from an array of the elements in its lower triangle
+ *
+ * The matrix is `n x n` and has type `slap_PACKED`, but only wraps the
+ * `slap_PackedSize(n) = n(n+1)/2` elements on and below the diagonal, stored column by
+ * column like LAPACK's packed format: element `(i,j)` for `i >= j` is at
+ * `data[i + j * (2n - j - 1) / 2]`. Use slap_PackedElement() to access them.
+ *
+ * Like the dense methods, slap_Cholesky() and slap_TriSolve() only use the lower
+ * triangle, and transposing the matrix gives the upper triangular factor. slap_MatMulAdd()
+ * and slap_QuadraticForm() treat the matrix as symmetric, unless it's been turned into a
+ * triangular matrix of type `slap_PACKED_LOWER` with slap_LowerTri(). See packed.h.
+ *
+ * @param n Number of rows and columns in the matrix
+ * @param data The packed elements. Must not be NULL, and should have at least
+ *             `slap_PackedSize(n)` elements.
+ * @return A new matrix
+ */
+Matrix slap_PackedFromArray(int n, sfloat* data);
+
 /**
  * @brief Create a "Null" matrix
  *
@@ -98,7 +180,7 @@ static inline Matrix slap_NullMatrix(void) {
   // NOTE: Can't use named initializer here because it's inlined
   // (so causes issues for C++)
   Matrix mat = {
-      0, 0, 0, 0, NULL, slap_DENSE,
+      0, 0, 0, 0, NULL, slap_DENSE, 0, 0,
   };
   return mat;
 }
@@ -116,6 +198,8 @@ static inline void slap_SetNull(Matrix* mat) {
   mat->is_transposed = 0;
   mat->data = NULL;
   mat->mattype = slap_DENSE;
+  mat->kl = 0;
+  mat->ku = 0;
 }
 
 //*********************************************//
@@ -154,14 +238,40 @@ static inline bool slap_IsEmpty(Matrix mat) { return mat.rows <= 0 || mat.cols <
  */
 static inline bool slap_IsSquare(Matrix mat) { return mat.rows == mat.cols; }
 
+/**
+ * @brief Check if a matrix only stores some of its elements
+ *
+ * True for band, diagonal and packed matrices, whose elements can't be reached with
+ * slap_GetElement() or by walking `rows` elements in each column of the data. See
+ * slap_StoredRows().
+ *
+ * @param[in] mat Any matrix
+ */
+static inline bool slap_IsStructured(Matrix mat) {
+  return mat.mattype == slap_BANDED || mat.mattype == slap_DIAGONAL ||
+         mat.mattype == slap_PACKED || mat.mattype == slap_PACKED_LOWER;
+}
+
+/**
+ * @brief Check if a matrix uses packed storage, either symmetric or triangular
+ *
+ * @param[in] mat Any matrix
+ */
+static inline bool slap_IsPacked(Matrix mat) {
+  return mat.mattype == slap_PACKED || mat.mattype == slap_PACKED_LOWER;
+}
+
 /**
  * @brief Check if all elements are adjacent in memory
  *
- * True if column stride is equal to the number of rows.
+ * True if column stride is equal to the number of rows, or if the data is a single
+ * column (e.g. a vector with a padded stride).
  *
  * @param[in] mat Any matrix
  */
-static inline bool slap_IsDense(Matrix mat) { return mat.sy == mat.rows; }
+static inline bool slap_IsDense(Matrix mat) {
+  return !slap_IsStructured(mat) && (mat.sy == mat.rows || mat.cols == 1);
+}
 
 /**
  * @brief Check if a matrix is valid
@@ -221,7 +331,7 @@ static inline enum slap_MatrixType slap_GetType(Matrix mat) { return mat.mattype
  * @param[in] mat Any matrix
  * @return Smaller of the number of rows and columns
  */
-static inline uint16_t slap_MinDim(Matrix mat) {
+static inline slap_dim_t slap_MinDim(Matrix mat) {
   return mat.rows <= mat.cols ? mat.rows : mat.cols;
 }
 
@@ -251,7 +361,9 @@ static inline int slap_NumCols(Matrix mat) {
  * @param mat Any matrix
  * @return Number of elements in the matrix
  */
-static inline int slap_NumElements(const Matrix mat) { return mat.rows * mat.cols; }
+static inline slap_index_t slap_NumElements(const Matrix mat) {
+  return (slap_index_t)mat.rows * (slap_index_t)mat.cols;
+}
 
 /**
  * @brief Get the column-stride stride of the matrix
@@ -267,6 +379,84 @@ static inline int slap_NumElements(const Matrix mat) { return mat.rows * mat.col
  */
 static inline int slap_Stride(const Matrix mat) { return mat.sy; }
 
+/**
+ * @brief Number of elements in the packed lower triangle of an `n x n` matrix
+ *
+ * @param n Number of rows and columns in the matrix
+ */
+static inline slap_index_t slap_PackedSize(int n) {
+  return (slap_index_t)n * (n + 1) / 2;
+}
+
+/**
+ * @brief Number of elements stored in each column of the underlying data
+ *
+ * Equal to the number of rows, except for band and diagonal matrices, which only store
+ * the elements in their band. Packed matrices are treated as a single column holding all
+ * of their elements, see slap_StoredCols().
+ *
+ * @param mat Any matrix
+ */
+static inline int slap_StoredRows(const Matrix mat) {
+  if (mat.mattype == slap_BANDED || mat.mattype == slap_DIAGONAL) {
+    return mat.sy;
+  }
+  if (slap_IsPacked(mat)) {
+    return (int)slap_PackedSize(mat.rows);
+  }
+  return mat.rows;
+}
+
+/**
+ * @brief Number of columns in the underlying data
+ *
+ * Together with slap_StoredRows() and slap_Stride(), gives the layout of all of the
+ * stored elements, regardless of the matrix type.
+ *
+ * @param mat Any matrix
+ */
+static inline int slap_StoredCols(const Matrix mat) {
+  return slap_IsPacked(mat) ? 1 : mat.cols;
+}
+
+/**
+ * @brief Memory distance between an element and the one below it (row index + 1)
+ *
+ * Takes the transpose into account, such that the linear index of element `(i,j)` is
+ * always `i * slap_RowStride(mat) + j * slap_ColStride(mat)`.
+ *
+ * See also: slap_ColStride(), slap_Cart2Index()
+ *
+ * @param mat Any matrix
+ */
+static inline int slap_RowStride(const Matrix mat) {
+  return mat.is_transposed ? (int)mat.sy : 1;
+}
+
+/**
+ * @brief Memory distance between an element and the one to its right (column index + 1)
+ *
+ * See also: slap_RowStride(), slap_Cart2Index()
+ *
+ * @param mat Any matrix
+ */
+static inline int slap_ColStride(const Matrix mat) {
+  return mat.is_transposed ? 1 : (int)mat.sy;
+}
+
+/**
+ * @brief Column stride used by slap_NewMatrixAligned() for a given number of rows
+ *
+ * The number of rows rounded up so that each column takes a multiple of
+ * `SLAP_MATRIX_ALIGNMENT` bytes.
+ *
+ * @param rows Number of rows in the matrix
+ */
+static inline int slap_AlignedStride(int rows) {
+  const int lanes = SLAP_MATRIX_ALIGNMENT / (int)sizeof(sfloat);
+  return lanes > 1 ? (rows + lanes - 1) / lanes * lanes : rows;
+}
+
 //*********************************************//
 // Indexing
 //*********************************************//
@@ -285,10 +475,10 @@ static inline int slap_Stride(const Matrix mat) { return mat.sy; }
  * @return Linear index corresponding to `row` and `col`.
            Returns -1 for a bad input.
  */
-static inline int slap_Cart2Index(const Matrix mat, int row, int col) {
+static inline slap_index_t slap_Cart2Index(const Matrix mat, int row, int col) {
   // clang-format off
-  return (mat.is_transposed) ? col + (int)mat.sy * row
-                             : row + (int)mat.sy * col;
+  return (mat.is_transposed) ? col + (slap_index_t)mat.sy * row
+                             : row + (slap_index_t)mat.sy * col;
   // clang-format on
 }
 
@@ -305,7 +495,7 @@ static inline int slap_Cart2Index(const Matrix mat, int row, int col) {
  * @param[out] row Destination for row index
  * @param[out] col Destination for column index
  */
-void slap_Linear2Cart(Matrix mat, int k, int* row, int* col);
+void slap_Linear2Cart(Matrix mat, slap_index_t k, int* row, int* col);
 
 /**
  * @brief Converts a linear index to the index into the underlying array
@@ -320,8 +510,8 @@ void slap_Linear2Cart(Matrix mat, int k, int* row, int* col);
  * @param k The linear index, ranging from 0 to slap_NumElements()
  * @return The index into mat.data corresponding the `k`th element of @a mat
  */
-static inline int slap_Linear2Index(const Matrix mat, int k) {
-  int index;
+static inline slap_index_t slap_Linear2Index(const Matrix mat, slap_index_t k) {
+  slap_index_t index;
   if (slap_IsDense(mat)) {
     index = k;
   } else {
@@ -398,6 +588,24 @@ static inline const sfloat* slap_GetElementConst(const Matrix mat, int row, int
   return mat.data + slap_Cart2Index(mat, row, col);
 }
 
+/**
+ * @brief Get an element of the symmetric part of a dense or diagonal matrix
+ *
+ * Returns \f$ (A_{ij} + A_{ji}) / 2 \f$, which is just \f$ A_{ij} \f$ for a symmetric
+ * matrix. Used by methods that take a symmetric cost or covariance, which is often
+ * diagonal.
+ *
+ * @param mat A dense or diagonal matrix
+ * @param row Row index
+ * @param col Column index
+ */
+static inline sfloat slap_SymmetricElement(const Matrix mat, int row, int col) {
+  if (mat.mattype == slap_DIAGONAL) {
+    return row == col ? mat.data[row] : 0;
+  }
+  return (*slap_GetElementConst(mat, row, col) + *slap_GetElementConst(mat, col, row)) / 2;
+}
+
 /**
  * @brief Set an matrix element to a given value
  *
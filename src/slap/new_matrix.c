@@ -6,6 +6,7 @@
 #include "new_matrix.h"
 
 #include <stdlib.h>
+#include <string.h>
 
 Matrix slap_NewMatrix(int rows, int cols) {
   size_t num_el = (size_t)(rows) * (size_t)(cols);
@@ -31,6 +32,59 @@ Matrix slap_NewMatrixZeros(int rows, int cols) {
   return mat;
 }
 
+Matrix slap_NewMatrixAligned(int rows, int cols) {
+  int sy = slap_AlignedStride(rows);
+  size_t size = (size_t)(sy) * (size_t)(cols) * sizeof(sfloat);
+#if defined(_MSC_VER) || defined(__AVR__)
+  sfloat* data = (sfloat*)malloc(size);
+#else
+  // aligned_alloc requires the size to be a multiple of the alignment
+  size_t alignment = SLAP_MATRIX_ALIGNMENT;
+  size = size == 0 ? alignment : (size + alignment - 1) / alignment * alignment;
+  sfloat* data = (sfloat*)aligned_alloc(alignment, size);
+#endif
+  Matrix mat = {.rows = rows,
+                .cols = cols,
+                .sy = sy,
+                .is_transposed = false,
+                .data = data,
+                .mattype = slap_DENSE};
+  return mat;
+}
+
+Matrix slap_NewMatrixAlignedZeros(int rows, int cols) {
+  Matrix mat = slap_NewMatrixAligned(rows, cols);
+  if (mat.data) {
+    memset(mat.data, 0, (size_t)(mat.sy) * (size_t)(cols) * sizeof(sfloat));
+  }
+  return mat;
+}
+
+Matrix slap_NewBandMatrix(int rows, int cols, int kl, int ku) {
+  int sy = kl + ku + 1;
+  size_t num_el = (size_t)(sy) * (size_t)(cols);
+  sfloat* data = (sfloat*)calloc(num_el, sizeof(sfloat));
+  Matrix mat = {.rows = rows,
+                .cols = cols,
+                .sy = sy,
+                .is_transposed = false,
+                .data = data,
+                .mattype = slap_BANDED,
+                .kl = kl,
+                .ku = ku};
+  return mat;
+}
+
+Matrix slap_NewDiagonalMatrix(int n) {
+  sfloat* data = (sfloat*)calloc((size_t)(n), sizeof(sfloat));
+  return slap_DiagonalFromArray(n, data);
+}
+
+Matrix slap_NewPackedMatrix(int n) {
+  sfloat* data = (sfloat*)calloc((size_t)slap_PackedSize(n), sizeof(sfloat));
+  return slap_PackedFromArray(n, data);
+}
+
 enum slap_ErrorCode slap_FreeMatrix(Matrix* mat) {
   if (mat->data) {
     free(mat->data);
@@ -51,6 +51,87 @@ Matrix slap_NewMatrix(int rows, int cols);
  */
 Matrix slap_NewMatrixZeros(int rows, int cols);
 
+/**
+ * @brief Allocate a new matrix on the heap, with aligned and padded columns
+ *
+ * The data starts on a multiple of `SLAP_MATRIX_ALIGNMENT` bytes, and the column stride
+ * is padded to slap_AlignedStride(), so every column is aligned as well. Columns of
+ * these matrices can be processed with full-width SIMD loads, and square matrices of the
+ * sizes in fixed_size.h use the same specialized kernels as dense ones.
+ *
+ * Data will not be initialized. Wrapper around a call to `aligned_alloc`, except with
+ * MSVC, where `malloc` is used and only the padding is guaranteed.
+ * Must be followed by a call to `FreeMatrix`.
+ *
+ * **Header File:** `"slap/new_matrix.h"`
+ * @param rows number of rows in the matrix
+ * @param cols number of columns in the matrix
+ * @return A new matrix
+ */
+Matrix slap_NewMatrixAligned(int rows, int cols);
+
+/**
+ * @brief Allocate a new aligned and padded matrix on the heap, initialized with zeros
+ *
+ * Same as slap_NewMatrixAligned(), but the data (including the padding) is set to zero.
+ *
+ * **Header File:** `"slap/new_matrix.h"`
+ * @param rows number of rows in the matrix
+ * @param cols number of columns in the matrix
+ * @return A new matrix
+ */
+Matrix slap_NewMatrixAlignedZeros(int rows, int cols);
+
+/**
+ * @brief Allocate a new band matrix on the heap, initialized with zeros
+ *
+ * Only the @p kl sub-diagonals, the diagonal, and the @p ku super-diagonals are stored,
+ * using the same layout as LAPACK: each column is stored contiguously, with element
+ * `(i,j)` at `data[ku + i - j + j * sy]`, where `sy = kl + ku + 1`. The matrix has type
+ * `slap_BANDED`, and should be accessed with slap_BandElement().
+ *
+ * Must be followed by a call to `FreeMatrix`.
+ *
+ * # Example
+ * ```c
+ * Matrix A = slap_NewBandMatrix(100, 100, 2, 1);  // tridiagonal plus one sub-diagonal
+ * *slap_BandElement(A, 2, 0) = 1.0;
+ * slap_FreeMatrix(&A);
+ * ```
+ *
+ * **Header File:** `"slap/new_matrix.h"`
+ * @param rows number of rows in the matrix
+ * @param cols number of columns in the matrix
+ * @param kl number of sub-diagonals
+ * @param ku number of super-diagonals
+ * @return A new matrix
+ */
+Matrix slap_NewBandMatrix(int rows, int cols, int kl, int ku);
+
+/**
+ * @brief Allocate a new diagonal matrix on the heap, initialized with zeros
+ *
+ * Only stores the @p n diagonal elements. See slap_DiagonalFromArray().
+ * Must be followed by a call to `FreeMatrix`.
+ *
+ * **Header File:** `"slap/new_matrix.h"`
+ * @param n number of rows and columns in the matrix
+ * @return A new matrix
+ */
+Matrix slap_NewDiagonalMatrix(int n);
+
+/**
+ * @brief Allocate a new packed matrix on the heap, initialized with zeros
+ *
+ * Only stores the `n(n+1)/2` elements in the lower triangle. See slap_PackedFromArray().
+ * Must be followed by a call to `FreeMatrix`.
+ *
+ * **Header File:** `"slap/new_matrix.h"`
+ * @param n number of rows and columns in the matrix
+ * @return A new matrix
+ */
+Matrix slap_NewPackedMatrix(int n);
+
 /**
  * @brief Free the data for a matrix
  *
@@ -60,7 +141,9 @@ Matrix slap_NewMatrixZeros(int rows, int cols);
  * Note this does NOT attempt to free the matrix object itself, only the data
  * it wraps.
  *
- * Should only be used in conjunction with slap_NewMatrix() or slap_NewMatrixZeros().
+ * Should only be used in conjunction with slap_NewMatrix(), slap_NewMatrixZeros(),
+ * slap_NewBandMatrix(), slap_NewDiagonalMatrix(), slap_NewPackedMatrix(), or the
+ * aligned variants.
  *
  * **Header File:** `"slap/new_matrix.h"`
  */
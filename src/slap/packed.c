@@ -0,0 +1,242 @@
+//
+// Created by Brian Jackson on 10/18/26.
+// Copyright (c) 2026 Robotic Exploration Lab. All rights reserved.
+//
+
+#include "packed.h"
+
+#include <math.h>
+
+#include "kernels.h"
+#include "unary_ops.h"
+
+// Start of column j of the packed lower triangle of an n x n matrix, which has n - j
+// elements starting at the diagonal
+static inline sfloat* Column(Matrix P, int j) {
+  return P.data + (slap_index_t)j * (2 * (slap_index_t)P.rows - j + 1) / 2;
+}
+
+sfloat* slap_PackedElement(Matrix P, int i, int j) {
+  int n = P.rows;
+  if (i < 0 || j < 0 || i >= n || j >= n) {
+    return NULL;
+  }
+  bool swap = slap_GetType(P) == slap_PACKED_LOWER ? slap_IsTransposed(P) : i < j;
+  if (swap) {
+    int tmp = i;
+    i = j;
+    j = tmp;
+  }
+  if (i < j) {
+    return NULL;
+  }
+  return Column(P, j) + i - j;
+}
+
+enum slap_ErrorCode slap_PackedToDense(Matrix dense, Matrix P) {
+  SLAP_ASSERT_VALID(dense, SLAP_INVALID_MATRIX, "PackedToDense: dense matrix invalid");
+  SLAP_ASSERT_VALID(P, SLAP_INVALID_MATRIX, "PackedToDense: packed matrix invalid");
+  SLAP_ASSERT_SAME_SIZE(dense, P, SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS, "PackedToDense");
+  int n = P.rows;
+  bool triangular = slap_GetType(P) == slap_PACKED_LOWER;
+  for (int j = 0; j < n; ++j) {
+    const sfloat* col = Column(P, j);
+    for (int i = j; i < n; ++i) {
+      sfloat lower = col[i - j];
+      sfloat upper = lower;
+      if (triangular && i != j) {
+        // Zero the triangle that isn't stored, which is the lower one if P is transposed
+        if (slap_IsTransposed(P)) {
+          lower = 0;
+        } else {
+          upper = 0;
+        }
+      }
+      slap_SetElement(dense, i, j, lower);
+      slap_SetElement(dense, j, i, upper);
+    }
+  }
+  return SLAP_NO_ERROR;
+}
+
+enum slap_ErrorCode slap_PackedFromDense(Matrix P, Matrix dense) {
+  SLAP_ASSERT_VALID(P, SLAP_INVALID_MATRIX, "PackedFromDense: packed matrix invalid");
+  SLAP_ASSERT_VALID(dense, SLAP_INVALID_MATRIX, "PackedFromDense: dense matrix invalid");
+  SLAP_ASSERT_SAME_SIZE(dense, P, SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS, "PackedFromDense");
+  int n = P.rows;
+  // A transposed triangular matrix is upper triangular, so its elements are above the
+  // diagonal of the dense matrix
+  bool upper = slap_GetType(P) == slap_PACKED_LOWER && slap_IsTransposed(P);
+  for (int j = 0; j < n; ++j) {
+    sfloat* col = Column(P, j);
+    for (int i = j; i < n; ++i) {
+      col[i - j] = upper ? *slap_GetElement(dense, j, i) : *slap_GetElement(dense, i, j);
+    }
+  }
+  return SLAP_NO_ERROR;
+}
+
+enum slap_ErrorCode slap_PackedMatMulAdd(Matrix C, Matrix P, Matrix B, sfloat alpha,
+                                         sfloat beta) {
+  SLAP_ASSERT_VALID(C, SLAP_INVALID_MATRIX, "PackedMatMulAdd: invalid C matrix");
+  SLAP_ASSERT_VALID(P, SLAP_INVALID_MATRIX, "PackedMatMulAdd: invalid P matrix");
+  SLAP_ASSERT_VALID(B, SLAP_INVALID_MATRIX, "PackedMatMulAdd: invalid B matrix");
+  SLAP_ASSERT(slap_GetType(B) == slap_DENSE && slap_GetType(C) == slap_DENSE,
+              SLAP_INVALID_MATRIX, SLAP_INVALID_MATRIX,
+              "PackedMatMulAdd: B and C must be dense matrices");
+  SLAP_ASSERT(slap_NumRows(C) == slap_NumRows(P), SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              "PackedMatMulAdd: Rows of C (%d) not equal to Rows of P (%d).",
+              slap_NumRows(C), slap_NumRows(P));
+  SLAP_ASSERT(slap_NumCols(P) == slap_NumRows(B), SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              "PackedMatMulAdd: Columns of P (%d) not equal to Rows of B (%d).",
+              slap_NumCols(P), slap_NumRows(B));
+  SLAP_ASSERT(slap_NumCols(C) == slap_NumCols(B), SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              "PackedMatMulAdd: Columns of C (%d) not equal to Columns of B (%d).",
+              slap_NumCols(C), slap_NumCols(B));
+  if (beta == 0) {
+    slap_SetConst(C, 0);
+  } else if (beta != 1) {
+    slap_ScaleByConst(C, beta);
+  }
+  int n = P.rows;
+  int m = slap_NumCols(B);
+  int rs_B = slap_RowStride(B);
+  int cs_B = slap_ColStride(B);
+  int rs_C = slap_RowStride(C);
+  int cs_C = slap_ColStride(C);
+  const slap_Kernels* kernels = slap_GetKernels();
+
+  if (slap_GetType(P) == slap_PACKED_LOWER) {
+    for (int k = 0; k < m; ++k) {
+      const sfloat* b = B.data + k * cs_B;
+      sfloat* c = C.data + k * cs_C;
+      for (int j = 0; j < n; ++j) {
+        const sfloat* col = Column(P, j);
+        if (!slap_IsTransposed(P)) {
+          // c[j:n] += b[j] * L[j:n,j]
+          slap_AxpyStrided(kernels, n - j, alpha * b[j * rs_B], col, 1, c + j * rs_C, rs_C);
+        } else {
+          // Row j of L' is column j of L
+          c[j * rs_C] += alpha * slap_DotStrided(kernels, n - j, col, 1, b + j * rs_B,
+                                                 rs_B);
+        }
+      }
+    }
+    return SLAP_NO_ERROR;
+  }
+
+  // Column j of the lower triangle contributes to c[j] through row j of P, and to
+  // c[j+1:n] through column j
+  for (int k = 0; k < m; ++k) {
+    const sfloat* b = B.data + k * cs_B;
+    sfloat* c = C.data + k * cs_C;
+    for (int j = 0; j < n; ++j) {
+      const sfloat* col = Column(P, j);
+      int len = n - j - 1;
+      sfloat bj = alpha * b[j * rs_B];
+      sfloat sum = slap_DotStrided(kernels, len, col + 1, 1, b + (j + 1) * rs_B, rs_B);
+      c[j * rs_C] += bj * col[0] + alpha * sum;
+      slap_AxpyStrided(kernels, len, bj, col + 1, 1, c + (j + 1) * rs_C, rs_C);
+    }
+  }
+  return SLAP_NO_ERROR;
+}
+
+sfloat slap_PackedQuadraticForm(Matrix y, Matrix P, Matrix x) {
+  SLAP_ASSERT_VALID(y, NAN, "PackedQuadraticForm: y vector not valid");
+  SLAP_ASSERT_VALID(P, NAN, "PackedQuadraticForm: P matrix not valid");
+  SLAP_ASSERT_VALID(x, NAN, "PackedQuadraticForm: x vector not valid");
+  SLAP_ASSERT_DENSE(y, NAN, "PackedQuadraticForm: y matrix must be dense");
+  SLAP_ASSERT_DENSE(x, NAN, "PackedQuadraticForm: x matrix must be dense");
+  int n = P.rows;
+  SLAP_ASSERT(slap_NumElements(y) == n && slap_NumElements(x) == n,
+              SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS, NAN,
+              "PackedQuadraticForm: vectors must have length %d", n);
+  const slap_Kernels* kernels = slap_GetKernels();
+  sfloat out = 0;
+  if (slap_GetType(P) == slap_PACKED_LOWER) {
+    // y' L x = sum_j x[j] * (y[j:n]' L[j:n,j]), and y' L' x = x' L y
+    const sfloat* xd = slap_IsTransposed(P) ? y.data : x.data;
+    const sfloat* yd = slap_IsTransposed(P) ? x.data : y.data;
+    for (int j = 0; j < n; ++j) {
+      out += xd[j] * kernels->dot(n - j, Column(P, j), yd + j);
+    }
+    return out;
+  }
+  for (int j = 0; j < n; ++j) {
+    const sfloat* col = Column(P, j);
+    int len = n - j - 1;
+    sfloat Px = col[0] * x.data[j] + kernels->dot(len, col + 1, x.data + j + 1);
+    out += y.data[j] * Px + x.data[j] * kernels->dot(len, col + 1, y.data + j + 1);
+  }
+  return out;
+}
+
+enum slap_ErrorCode slap_PackedTriSolve(Matrix L, Matrix b) {
+  SLAP_ASSERT_VALID(L, SLAP_INVALID_MATRIX, "PackedTriSolve: L matrix invalid");
+  SLAP_ASSERT_VALID(b, SLAP_INVALID_MATRIX, "PackedTriSolve: b matrix invalid");
+  SLAP_ASSERT(slap_NumCols(L) == slap_NumRows(b), SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              "PackedTriSolve: L has %d columns but b has %d rows", slap_NumCols(L),
+              slap_NumRows(b));
+  int n = L.rows;
+  int m = slap_NumCols(b);
+  int rs_b = slap_RowStride(b);
+  int cs_b = slap_ColStride(b);
+  const slap_Kernels* kernels = slap_GetKernels();
+
+  for (int k = 0; k < m; ++k) {
+    sfloat* x = b.data + k * cs_b;
+    if (!slap_IsTransposed(L)) {
+      // Forward substitution, eliminating x[j] by walking down column j of L
+      for (int j = 0; j < n; ++j) {
+        const sfloat* col = Column(L, j);
+        x[j * rs_b] /= col[0];
+        slap_AxpyStrided(kernels, n - j - 1, -x[j * rs_b], col + 1, 1, x + (j + 1) * rs_b,
+                         rs_b);
+      }
+    } else {
+      // Back substitution, where row j of L' is column j of L
+      for (int j = n - 1; j >= 0; --j) {
+        const sfloat* col = Column(L, j);
+        sfloat sum = slap_DotStrided(kernels, n - j - 1, col + 1, 1, x + (j + 1) * rs_b,
+                                     rs_b);
+        x[j * rs_b] = (x[j * rs_b] - sum) / col[0];
+      }
+    }
+  }
+  return SLAP_NO_ERROR;
+}
+
+enum slap_ErrorCode slap_PackedCholesky(Matrix P, int* fail_col) {
+  SLAP_ASSERT_VALID(P, SLAP_INVALID_MATRIX, "PackedCholesky: matrix invalid");
+  int n = P.rows;
+  int fail = -1;
+  const slap_Kernels* kernels = slap_GetKernels();
+
+  // Right-looking, like LAPACK's pptrf: after computing column j, subtract its outer
+  // product from the columns to the right
+  for (int j = 0; j < n; ++j) {
+    sfloat* col = Column(P, j);
+    if (col[0] <= 0) {
+      fail = j;
+      break;
+    }
+    sfloat ajj = sqrt(col[0]);
+    col[0] = ajj;
+    int len = n - j - 1;
+    for (int i = 1; i <= len; ++i) {
+      col[i] /= ajj;
+    }
+    for (int c = 1; c <= len; ++c) {
+      kernels->axpy(len - c + 1, -col[c], col + c, Column(P, j + c));
+    }
+  }
+  if (fail_col) {
+    *fail_col = fail;
+  }
+  return fail < 0 ? SLAP_NO_ERROR : SLAP_CHOLESKY_FAIL;
+}
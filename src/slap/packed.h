@@ -0,0 +1,126 @@
+//
+// Created by Brian Jackson on 10/18/26.
+// Copyright (c) 2026 Robotic Exploration Lab. All rights reserved.
+//
+
+#pragma once
+
+#include "matrix.h"
+
+/**
+ * @brief Get a pointer to an element of a packed matrix
+ *
+ * Only the lower triangle is stored, so for `i < j` this returns the element `(j,i)`,
+ * which is the same element of a symmetric matrix. As a result, transposing the matrix
+ * has no effect on the output.
+ *
+ * For a triangular matrix of type `slap_PACKED_LOWER`, the elements that aren't stored
+ * are zero, so this returns NULL for `i < j`, or for `i > j` if @p P is transposed.
+ *
+ * **Header File:** `slap/linalg.h`
+ * @param P A packed matrix, created with slap_PackedFromArray() or slap_NewPackedMatrix()
+ * @param i row index
+ * @param j column index
+ * @return Pointer to the element, or NULL if the indices are out of bounds.
+ */
+sfloat* slap_PackedElement(Matrix P, int i, int j);
+
+/**
+ * @brief Copy a packed matrix into a dense symmetric matrix
+ *
+ * Both triangles of @p dense are set. If @p P has type `slap_PACKED_LOWER`, the triangle
+ * that isn't stored is set to zero, so this gives the dense triangular matrix.
+ *
+ * **Header File:** `slap/linalg.h`
+ * @param[out] dense A square dense matrix
+ * @param[in] P A packed matrix of the same size
+ * @return slap error code
+ */
+enum slap_ErrorCode slap_PackedToDense(Matrix dense, Matrix P);
+
+/**
+ * @brief Pack the lower triangle of a dense matrix
+ *
+ * The strictly upper triangular portion of @p dense isn't read, unless @p P is a
+ * transposed `slap_PACKED_LOWER` matrix, in which case only the upper triangle is read.
+ *
+ * **Header File:** `slap/linalg.h`
+ * @param[out] P A packed matrix
+ * @param[in] dense A square matrix of the same size
+ * @return slap error code
+ */
+enum slap_ErrorCode slap_PackedFromDense(Matrix P, Matrix dense);
+
+/**
+ * @brief Symmetric matrix multiplication with a packed matrix
+ *
+ * Computes \f$ C = \beta C + \alpha P B \f$, where @p P is the symmetric matrix whose
+ * lower triangle is stored. Each element of @p P is read once per column of @p B, which
+ * is the same amount of work as a dense multiplication with half the memory traffic.
+ * With a single column this is the `SYMV` kernel from BLAS.
+ *
+ * If @p P has type `slap_PACKED_LOWER`, it's the triangular matrix \f$ L \f$ instead, or
+ * \f$ L^T \f$ if it's transposed, which is the `TPMV` kernel from BLAS.
+ *
+ * Called by slap_MatMulAdd() when @p P is packed.
+ *
+ * **Header File:** `slap/linalg.h`
+ * @param[out] C Output matrix
+ * @param[in] P A packed matrix
+ * @param[in] B A dense matrix
+ * @param[in] alpha scaling on the product
+ * @param[in] beta scaling on the original value of @p C
+ * @return slap error code
+ */
+enum slap_ErrorCode slap_PackedMatMulAdd(Matrix C, Matrix P, Matrix B, sfloat alpha,
+                                         sfloat beta);
+
+/**
+ * @brief Calculate \f$ y^T P x \f$ for a packed symmetric matrix \f$ P \f$
+ *
+ * If @p P has type `slap_PACKED_LOWER`, it's treated as a triangular matrix, like in
+ * slap_PackedMatMulAdd().
+ *
+ * Called by slap_QuadraticForm() when @p P is packed.
+ *
+ * **Header File:** `slap/linalg.h`
+ * @param y A dense vector of length n
+ * @param P A packed matrix of size (n,n)
+ * @param x A dense vector of length n
+ * @return The scaled inner product, or NAN if invalid.
+ */
+sfloat slap_PackedQuadraticForm(Matrix y, Matrix P, Matrix x);
+
+/**
+ * @brief Triangular solve with a packed matrix
+ *
+ * Follows the same convention as slap_TriSolve() for dense matrices: if @p L isn't
+ * transposed, solves \f$ L x = b \f$ with the stored lower triangle. If it is transposed,
+ * solves \f$ L^T x = b \f$.
+ *
+ * Called by slap_TriSolve() when @p L is packed, with either type.
+ *
+ * **Header File:** `slap/linalg.h`
+ * @param[in] L A packed matrix
+ * @param[inout] b The right-hand side, with any number of columns. Stores the solution
+ *                 upon completion of the function.
+ * @return slap error code
+ */
+enum slap_ErrorCode slap_PackedTriSolve(Matrix L, Matrix b);
+
+/**
+ * @brief Cholesky decomposition of a packed symmetric positive-definite matrix
+ *
+ * Replaces the lower triangle by the Cholesky factor, in place. The factor can be passed
+ * to slap_CholeskySolve(), which calls slap_PackedTriSolve().
+ *
+ * Called by slap_Cholesky() when @p P is packed. Use slap_LowerTri() on the result to
+ * multiply by the factor.
+ *
+ * **Header File:** `slap/linalg.h`
+ * @param[inout] P A packed matrix
+ * @param[out] fail_col Column where the factorization failed, or -1 if it succeeded.
+ *                      Can be NULL.
+ * @return SLAP_NO_ERROR, or SLAP_CHOLESKY_FAIL if the matrix isn't positive definite
+ */
+enum slap_ErrorCode slap_PackedCholesky(Matrix P, int* fail_col);
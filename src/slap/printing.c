@@ -2,11 +2,32 @@
 
 #include <stdio.h>
 
+#include "band.h"
+#include "packed.h"
+
+// Element (i,j) of any type of matrix, including the ones that aren't stored
+static sfloat Element(Matrix mat, int i, int j) {
+  const sfloat* value;
+  switch (slap_GetType(mat)) {
+    case slap_DIAGONAL:
+      return i == j ? mat.data[i] : 0;
+    case slap_BANDED:
+      value = slap_BandElement(mat, i, j);
+      return value ? *value : 0;
+    case slap_PACKED:
+    case slap_PACKED_LOWER:
+      value = slap_PackedElement(mat, i, j);
+      return value ? *value : 0;
+    default:
+      return *slap_GetElementConst(mat, i, j);
+  }
+}
+
 enum slap_ErrorCode slap_PrintMatrix(const Matrix mat) {
   SLAP_ASSERT_VALID(mat, SLAP_INVALID_MATRIX, "PrintMatrix: invalid matrix");
   for (int row = 0; row < slap_NumRows(mat); ++row) {
     for (int col = 0; col < slap_NumCols(mat); ++col) {
-      printf("% 8.*g ", PRECISION, *slap_GetElementConst(mat, row, col));
+      printf("% 8.*g ", PRECISION, Element(mat, row, col));
     }
     printf("\n");
   }
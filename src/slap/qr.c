@@ -7,6 +7,9 @@
 
 #include <math.h>
 
+#include "arena.h"
+#include "kernels.h"
+#include "matmul.h"
 #include "printing.h"
 #include "unary_ops.h"
 #include "strided_matrix.h"
@@ -41,6 +44,7 @@ sfloat Householder(Matrix R, Matrix v, int k) {
 
   // Check if column is already empty
   if (fabs(sigma) < ZERO_TOL) {
+    v.data[k] = 1;  // so the stored reflector is finite
     return 0;
   }
 
@@ -60,73 +64,69 @@ sfloat Householder(Matrix R, Matrix v, int k) {
   return beta;
 }
 
-/**
- * Calculates \f$ \bar{Q} = Q * (I - \alpha v v^T) \f$
- * where \f$v = [1 \; y^T]^T\f$.
- *
- * @param[out] Q_bar
- * @param[in] Q
- * @param[in] R Scaled Householder reflection
- * @param[in] k Column index
- * @param alpha scaling factor
- */
-void Qmuly(Matrix Q_bar, Matrix Q, Matrix R, sfloat alpha, int k) {
-  int m = slap_NumRows(Q);
-
-  // Top left corner: Stays the same
-  // Bottom left corner: Stays the same
-
-//  printf("Qmuly with k = %d\n", k);
-//  printf("  Looping columns %d to %d\n", k, m - 1);
-  for (int j = k; j < m; ++j) {
-    sfloat v_j = 1;
-    if (j > k) {
-      v_j = *slap_GetElement(R, j, k);
-    }
-    sfloat Qiv;
-
-    // Top right corner: Q12 - alpha * Q12 * v * v'
-//    printf("    Looping rows %d to %d\n", 0, k - 1);
-    for (int i = 0; i < k; ++i) {
-      Qiv = 0;
-
-      // Calculate Q[i,:] * v
-      for (int kk = k; kk < m; ++kk) {
-        sfloat v_kk = 1.0;
-        if (kk > k) {
-          v_kk = *slap_GetElement(R, kk, k);
-        }
-        Qiv += *slap_GetElement(Q, i, kk) * v_kk;
-      }
-
-      // Calculate the output
-      sfloat *Qij = slap_GetElement(Q_bar, i, j);
-      *Qij -= alpha * Qiv * v_j;
-//      printf("    Qv[%d] = %5.3f, v[%d] = %5.3f\n", i, Qiv, j, v_j);
-    }
+// Dense view of a block of A, which may be transposed
+static Matrix View(Matrix A, int i, int j, int r, int c) {
+  Matrix view = A;
+  view.data = A.data + slap_Cart2Index(A, i, j);
+  view.rows = slap_IsTransposed(A) ? c : r;
+  view.cols = slap_IsTransposed(A) ? r : c;
+  view.mattype = slap_DENSE;
+  return view;
+}
 
-    // Bottom right corner: Q22 - alpha * A22 * v * v'
-    for (int i = k; i < m; ++i) {
-      Qiv = 0;
+// Application of a Householder reflection to columns k to end of A,
+// split into independent blocks of columns
+typedef struct {
+  Matrix A;
+  const sfloat* v;
+  sfloat beta;
+  int k;
+  int end;
+  sfloat* temp;
+  int cols_per_task;
+  const slap_Kernels* kernels;
+} Reflection;
+
+static void ReflectTask(void* context, int task) {
+  const Reflection* r = (const Reflection*)context;
+  int m = slap_NumRows(r->A);
+  int k = r->k;
+  int rs = slap_RowStride(r->A);
+  int cs = slap_ColStride(r->A);
+  int j0 = k + task * r->cols_per_task;
+  int j1 = r->end - j0 < r->cols_per_task ? r->end : j0 + r->cols_per_task;
+  for (int j = j0; j < j1; ++j) {
+    sfloat* Aj = r->A.data + k * rs + j * cs;
+    const sfloat* v = r->v + k;
 
-      // Calculate Q[i,:] * v
-      for (int kk = k; kk < m; kk++) {
-        sfloat v_kk = 1.0;
-        if (kk > k) {
-          v_kk = *slap_GetElement(R, kk, k);
-        }
-        Qiv += *slap_GetElement(Q, i, kk) * v_kk;
+    // 1. Calculate temp = v'A
+    sfloat vA;
+    if (rs == 1) {
+      vA = r->kernels->dot(m - k, Aj, v);
+    } else {
+      vA = 0;
+      for (int i = 0; i < m - k; ++i) {
+        vA += Aj[i * rs] * v[i];
       }
+    }
+    r->temp[j] = vA;
 
-      // Calculate the output
-      sfloat *Qij = slap_GetElement(Q_bar, i, j);
-      *Qij -= alpha * Qiv * v_j;
+    // 2. Calculate A = A - beta *  v * temp
+    if (rs == 1) {
+      r->kernels->axpy(m - k, -r->beta * vA, v, Aj);
+    } else {
+      for (int i = 0; i < m - k; ++i) {
+        Aj[i * rs] -= r->beta * v[i] * vA;
+      }
     }
   }
 }
-enum slap_ErrorCode slap_QR(Matrix A, Matrix betas, Matrix temp) {
+
+// Householder QR of columns k0 to k1 of A, applying each reflection to columns up to end
+static void QRUnblocked(Matrix A, Matrix betas, Matrix temp, int k0, int k1, int end,
+                        slap_ThreadPool* pool, const slap_Kernels* kernels) {
   int m = slap_NumRows(A);
-  int n = slap_NumCols(A);
+  int num_threads = slap_ThreadPoolNumThreads(pool);
 
   // Rename betas to v
   // The first k elements of v are the previous beta values,
@@ -134,28 +134,24 @@ enum slap_ErrorCode slap_QR(Matrix A, Matrix betas, Matrix temp) {
   Matrix v = betas;
 
   // Loop over columns
-  for (int k = 0; k < n; ++k) {
+  for (int k = k0; k < k1; ++k) {
     // Calculate Householder reflection vector
     sfloat beta = Householder(A, betas, k);
 
     // Perform Householder reflection
     // A = (I - beta * v * v') * A
-
-    // 1. Calculate temp = v'A
-    for (int j = k; j < n; ++j) {    // loop over columns
-      temp.data[j] = 0;
-      for (int i = k; i < m; ++i) {  // loop over rows
-        temp.data[j] += *slap_GetElement(A, i, j) * v.data[i];
-      }
-    }
-
-    // 2. Calculate A = A - beta *  v * temp
-    for (int j = k; j < n; ++j) {    // loop over columns
-      for (int i = k; i < m; ++i) {  // loop over rows
-        sfloat *Aij = slap_GetElement(A, i, j);
-        *Aij -= beta * v.data[i] * temp.data[j];
-      }
-    }
+    int cols = end - k;
+    bool parallel = 2.0 * (m - k) * cols >= SLAP_PARALLEL_THRESHOLD;
+    Reflection reflection = {A,
+                             v.data,
+                             beta,
+                             k,
+                             end,
+                             temp.data,
+                             parallel ? (cols + num_threads - 1) / num_threads : cols,
+                             kernels};
+    int num_tasks = (cols + reflection.cols_per_task - 1) / reflection.cols_per_task;
+    slap_ThreadPoolRun(parallel ? pool : NULL, num_tasks, ReflectTask, &reflection);
 
     // Store y = v / v[1] below the diagonal
     // Discards the first element, which is known to be 1
@@ -165,50 +161,255 @@ enum slap_ErrorCode slap_QR(Matrix A, Matrix betas, Matrix temp) {
     }
     v.data[k] = v_k * v_k * beta;  // save the scaling
   }
+}
 
-  return SLAP_NO_ERROR;
+// Calculates C = (I - beta * v * v') C for the reflection stored in column k of R
+static void ApplyReflection(const Matrix R, sfloat beta, int k, Matrix C) {
+  if (beta == 0) {
+    return;
+  }
+  int m = slap_NumRows(R);
+  int rs = slap_RowStride(R);
+  const sfloat* y = R.data + slap_Cart2Index(R, k, k);
+  int crs = slap_RowStride(C);
+  for (int j = 0; j < slap_NumCols(C); ++j) {
+    sfloat* Cj = slap_GetElement(C, k, j);
+    sfloat alpha = Cj[0];
+    for (int i = 1; i < m - k; ++i) {
+      alpha += y[i * rs] * Cj[i * crs];
+    }
+    alpha *= beta;
+    Cj[0] -= alpha;
+    for (int i = 1; i < m - k; ++i) {
+      Cj[i * crs] -= alpha * y[i * rs];
+    }
+  }
 }
 
-enum slap_ErrorCode slap_ComputeQ(Matrix Q, const Matrix R, const Matrix betas,
-                                  Matrix Q_work) {
+#if SLAP_QR_BLOCK_SIZE > 0
+
+// Block of kb reflections H = H_0 H_1 ... H_{kb-1} = I - V T V', applied to the columns of C
+typedef struct {
+  Matrix V1;  // leading kb x kb block of V, with explicit ones and zeros
+  Matrix V2;  // remaining rows of V
+  Matrix T;   // upper triangular, with explicit zeros
+  Matrix C;   // same rows as V
+  bool transpose;
+  int cols_per_task;
+} BlockReflection;
+
+// Forms the triangular factor of the block reflection in columns k to k + kb of R
+static void BlockReflectionFactor(const Matrix R, const Matrix betas, int k, int kb,
+                                  BlockReflection* block, const slap_Kernels* kernels) {
   int m = slap_NumRows(R);
-  int n = slap_NumCols(R);
-  slap_SetIdentity(Q, 1.0);
-  slap_SetIdentity(Q_work, 1.0);
-  for (int k = 0; k < n; ++k) {
-    // Calculate Q_work = Q * (I - beta * v * v')
-    Qmuly(Q_work, Q, R, betas.data[k], k);
-
-    // Copy the modified columns on the right back to Q
-    for (int j = k; j < m; ++j) {
-      for (int i = 0; i < m; ++i) {
-        slap_SetElement(Q, i, j, *slap_GetElement(Q_work, i, j));
+  Matrix V = View(R, k, k, m - k, kb);
+  int rs = slap_RowStride(V);
+  int cs = slap_ColStride(V);
+  sfloat* T = block->T.data;
+  sfloat* V1 = block->V1.data;
+  for (int i = 0; i < kb; ++i) {
+    for (int r = 0; r < kb; ++r) {
+      V1[r + i * kb] = r < i ? 0 : (r == i ? 1 : V.data[r * rs + i * cs]);
+    }
+  }
+
+  for (int i = 0; i < kb; ++i) {
+    // T[0:i, i] = -beta_i * T[0:i, 0:i] * V[:, 0:i]' * v_i
+    sfloat beta = betas.data[k + i];
+    const sfloat* vi = V.data + (i + 1) * rs + i * cs;
+    for (int j = 0; j < i; ++j) {
+      const sfloat* vj = V.data + (i + 1) * rs + j * cs;
+      sfloat vjvi = V.data[i * rs + j * cs];
+      if (rs == 1) {
+        vjvi += kernels->dot(m - k - i - 1, vj, vi);
+      } else {
+        for (int r = 0; r < m - k - i - 1; ++r) {
+          vjvi += vj[r * rs] * vi[r * rs];
+        }
       }
+      T[j + i * kb] = -beta * vjvi;
+    }
+    for (int j = 0; j < i; ++j) {
+      sfloat Tji = 0;
+      for (int l = j; l < i; ++l) {
+        Tji += T[j + l * kb] * T[l + i * kb];
+      }
+      T[j + i * kb] = Tji;
+    }
+    T[i + i * kb] = beta;
+    for (int j = i + 1; j < kb; ++j) {
+      T[j + i * kb] = 0;
     }
   }
+  block->V2 = View(R, k + kb, k, m - k - kb, kb);
+}
+
+// Each task applies the block reflection to a range of columns of C, SLAP_QR_BLOCK_SIZE
+// columns at a time
+static void BlockReflectTask(void* context, int task) {
+  const BlockReflection* block = (const BlockReflection*)context;
+  const int nb = SLAP_QR_BLOCK_SIZE;
+  sfloat W_data[SLAP_QR_BLOCK_SIZE * SLAP_QR_BLOCK_SIZE];
+  sfloat TW_data[SLAP_QR_BLOCK_SIZE * SLAP_QR_BLOCK_SIZE];
+  int m = slap_NumRows(block->C);
+  int n = slap_NumCols(block->C);
+  int kb = slap_NumRows(block->T);
+  Matrix T = block->transpose ? slap_Transpose(block->T) : block->T;
+  int j0 = task * block->cols_per_task;
+  int j1 = n - j0 < block->cols_per_task ? n : j0 + block->cols_per_task;
+  for (int j = j0; j < j1; j += nb) {
+    int jb = j1 - j < nb ? j1 - j : nb;
+    Matrix C1 = View(block->C, 0, j, kb, jb);
+    Matrix W = slap_MatrixFromArray(kb, jb, W_data);
+    Matrix TW = slap_MatrixFromArray(kb, jb, TW_data);
+
+    // W = T * V' * C, or T' * V' * C
+    slap_MatMulAdd(W, slap_Transpose(block->V1), C1, 1, 0);
+    if (m > kb) {
+      Matrix C2 = View(block->C, kb, j, m - kb, jb);
+      slap_MatMulAdd(W, slap_Transpose(block->V2), C2, 1, 1);
+    }
+    slap_MatMulAdd(TW, T, W, 1, 0);
+
+    // C = C - V * W
+    slap_MatMulAdd(C1, block->V1, TW, -1, 1);
+    if (m > kb) {
+      Matrix C2 = View(block->C, kb, j, m - kb, jb);
+      slap_MatMulAdd(C2, block->V2, TW, -1, 1);
+    }
+  }
+}
+
+// Applies the block of reflections in columns k to k + kb of R to C, which has the rows
+// k to m of the original matrix
+static void ApplyBlockReflection(const Matrix R, const Matrix betas, int k, int kb,
+                                 Matrix C, bool transpose, slap_ThreadPool* pool,
+                                 const slap_Kernels* kernels) {
+  sfloat V1_data[SLAP_QR_BLOCK_SIZE * SLAP_QR_BLOCK_SIZE];
+  sfloat T_data[SLAP_QR_BLOCK_SIZE * SLAP_QR_BLOCK_SIZE];
+  int m = slap_NumRows(C);
+  int n = slap_NumCols(C);
+  int num_threads = slap_ThreadPoolNumThreads(pool);
+  BlockReflection block;
+  block.V1 = slap_MatrixFromArray(kb, kb, V1_data);
+  block.T = slap_MatrixFromArray(kb, kb, T_data);
+  block.C = C;
+  block.transpose = transpose;
+  BlockReflectionFactor(R, betas, k, kb, &block, kernels);
+
+  // Split the columns evenly, rounded up to whole chunks
+  bool parallel = 4.0 * m * kb * n >= SLAP_PARALLEL_THRESHOLD;
+  int chunks = (n + SLAP_QR_BLOCK_SIZE - 1) / SLAP_QR_BLOCK_SIZE;
+  int chunks_per_task = parallel ? (chunks + num_threads - 1) / num_threads : chunks;
+  block.cols_per_task = chunks_per_task * SLAP_QR_BLOCK_SIZE;
+  int num_tasks = (chunks + chunks_per_task - 1) / chunks_per_task;
+  slap_ThreadPoolRun(parallel ? pool : NULL, num_tasks, BlockReflectTask, &block);
+}
+
+#endif
+
+static enum slap_ErrorCode QR(Matrix A, Matrix betas, Matrix temp, slap_ThreadPool* pool) {
+  int m = slap_NumRows(A);
+  int n = slap_NumCols(A);
+  const slap_Kernels* kernels = slap_GetKernels();
+
+#if SLAP_QR_BLOCK_SIZE > 0
+  if (n >= SLAP_QR_THRESHOLD) {
+    // Factor a panel, then update the columns to its right with the block reflection
+    const int nb = SLAP_QR_BLOCK_SIZE;
+    for (int k = 0; k < n; k += nb) {
+      int kb = n - k < nb ? n - k : nb;
+      QRUnblocked(A, betas, temp, k, k + kb, k + kb, pool, kernels);
+      if (k + kb < n) {
+        Matrix A2 = View(A, k, k + kb, m - k, n - k - kb);
+        ApplyBlockReflection(A, betas, k, kb, A2, true, pool, kernels);
+      }
+    }
+    return SLAP_NO_ERROR;
+  }
+#else
+  (void)m;
+#endif
+  QRUnblocked(A, betas, temp, 0, n, n, pool, kernels);
   return SLAP_NO_ERROR;
 }
-enum slap_ErrorCode slap_Qtb(const Matrix R, const Matrix betas, Matrix b) {
+
+enum slap_ErrorCode slap_QR(Matrix A, Matrix betas, Matrix temp) {
+  return QR(A, betas, temp, NULL);
+}
+
+size_t slap_QRWorkspaceSize(int rows, int cols) {
+  (void)cols;
+  return 2 * slap_ArenaMatrixSize(rows, 1);
+}
+
+enum slap_ErrorCode slap_QRParallel(slap_ThreadPool* pool, Matrix A, Matrix betas,
+                                    Matrix temp) {
+  return QR(A, betas, temp, pool);
+}
+
+// Q = H_0 H_1 ... H_{n-1} is applied from the last reflection to the first,
+// and Q' = H_{n-1} ... H_0 from the first to the last
+static enum slap_ErrorCode ApplyQ(const Matrix R, const Matrix betas, Matrix C,
+                                  bool transpose) {
+  SLAP_ASSERT(slap_NumRows(C) == slap_NumRows(R), SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              "ApplyQ: C must have the same number of rows as R (%d), got %d",
+              slap_NumRows(R), slap_NumRows(C));
   int m = slap_NumRows(R);
   int n = slap_NumCols(R);
-  for (int k = 0; k < n; ++k) {
-    // b[k+1] = b[k] - beta[k] * v[k] * (v[k]'b[k])
-
-    // alpha = beta[k] * v[k]'b[k]
-    sfloat alpha = b.data[k];
-    for (int i = k + 1; i < m; ++i) {
-        alpha += *slap_GetElement(R, i, k) * b.data[i];
+  int num_blocks = 0;
+#if SLAP_QR_BLOCK_SIZE > 0
+  // Forming the block reflection only pays off if it is applied to several columns
+  const int nb = SLAP_QR_BLOCK_SIZE;
+  if (n >= SLAP_QR_THRESHOLD && slap_NumCols(C) >= 4) {
+    const slap_Kernels* kernels = slap_GetKernels();
+    num_blocks = (n + nb - 1) / nb;
+    for (int b = 0; b < num_blocks; ++b) {
+      int k = (transpose ? b : num_blocks - 1 - b) * nb;
+      int kb = n - k < nb ? n - k : nb;
+      Matrix Ck = View(C, k, 0, m - k, slap_NumCols(C));
+      ApplyBlockReflection(R, betas, k, kb, Ck, transpose, NULL, kernels);
     }
-    alpha *= betas.data[k];
-
-    // b[k+1] = b[k] - alpha * v[k]
-    b.data[k] -= alpha;
-    for (int i = k + 1; i < m; ++i) {
-      b.data[i] -= alpha * *slap_GetElement(R, i, k);
+  }
+#else
+  (void)m;
+#endif
+  if (num_blocks == 0) {
+    for (int i = 0; i < n; ++i) {
+      int k = transpose ? i : n - 1 - i;
+      ApplyReflection(R, betas.data[k], k, C);
     }
   }
   return SLAP_NO_ERROR;
 }
+
+enum slap_ErrorCode slap_ApplyQ(const Matrix R, const Matrix betas, Matrix C) {
+  return ApplyQ(R, betas, C, false);
+}
+
+enum slap_ErrorCode slap_ApplyQt(const Matrix R, const Matrix betas, Matrix C) {
+  return ApplyQ(R, betas, C, true);
+}
+
+enum slap_ErrorCode slap_ComputeQ(Matrix Q, const Matrix R, const Matrix betas) {
+  SLAP_ASSERT(slap_NumCols(Q) <= slap_NumRows(Q), SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              "ComputeQ: Q can't have more columns than rows");
+  slap_SetIdentity(Q, 1.0);
+  return slap_ApplyQ(R, betas, Q);
+}
+
+size_t slap_ComputeQWorkspaceSize(int rows, int cols) {
+  (void)rows;
+  (void)cols;
+  return 0;
+}
+
+enum slap_ErrorCode slap_Qtb(const Matrix R, const Matrix betas, Matrix b) {
+  return slap_ApplyQt(R, betas, b);
+}
+
 enum slap_ErrorCode slap_LeastSquares(Matrix A, Matrix b, Matrix betas, Matrix temp) {
   // Perform QR on A
   slap_QR(A, betas, temp);
@@ -219,7 +420,109 @@ enum slap_ErrorCode slap_LeastSquares(Matrix A, Matrix b, Matrix betas, Matrix t
   // Triangular solve R x = Q'b
   int n = slap_NumCols(A);
   Matrix R = slap_UpperTri(slap_CreateSubMatrix(A, 0, 0, n, n));
-  Matrix x = slap_CreateSubMatrix(b, 0, 0, n, 1);
+  Matrix x = slap_CreateSubMatrix(b, 0, 0, n, slap_NumCols(b));
   slap_TriSolve(R, x);
   return SLAP_NO_ERROR;
 }
+
+size_t slap_LeastSquaresWorkspaceSize(int rows, int cols) {
+  return slap_QRWorkspaceSize(rows, cols);
+}
+
+static inline bool IsVector(Matrix v) { return slap_NumRows(v) == 1 || slap_NumCols(v) == 1; }
+
+// Distance between consecutive elements of a row or column vector
+static int VectorStride(Matrix v) {
+  return slap_NumRows(v) == 1 ? slap_ColStride(v) : slap_RowStride(v);
+}
+
+// Add (sign = 1) or remove (sign = -1) the row [a' beta] from the triangular system
+// [R d]. Row j of [R d] is rotated against the new row to zero out a[j], using a Givens
+// rotation to add it or a hyperbolic rotation to remove it. This is the same as updating
+// the Cholesky factor of [A b]'[A b], without ever forming the last row of R.
+static enum slap_ErrorCode QRRowUpdate(Matrix R, Matrix Qtb, Matrix row, Matrix b_row,
+                                       sfloat sign) {
+  SLAP_ASSERT_VALID(R, SLAP_INVALID_MATRIX, "QRAddRow: R matrix invalid");
+  SLAP_ASSERT_VALID(row, SLAP_INVALID_MATRIX, "QRAddRow: row invalid");
+  int n = slap_NumCols(R);
+  int k = slap_IsNull(Qtb) ? 0 : slap_NumCols(Qtb);
+  SLAP_ASSERT(slap_NumRows(R) >= n, SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              "QRAddRow: R must have at least as many rows as columns. Got size (%d,%d)",
+              slap_NumRows(R), n);
+  SLAP_ASSERT(IsVector(row) && slap_NumElements(row) == n,
+              SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS, SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              "QRAddRow: row must be a vector with %d elements", n);
+  SLAP_ASSERT(k == 0 || slap_NumRows(Qtb) >= n, SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              "QRAddRow: Qtb must have at least %d rows", n);
+  SLAP_ASSERT(k == 0 || (IsVector(b_row) && slap_NumElements(b_row) == k),
+              SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS, SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              "QRAddRow: b_row must be a vector with %d elements", k);
+
+  int rs_R = slap_RowStride(R);
+  int cs_R = slap_ColStride(R);
+  int rs_d = k > 0 ? slap_RowStride(Qtb) : 0;
+  int cs_d = k > 0 ? slap_ColStride(Qtb) : 0;
+  int inc_a = VectorStride(row);
+  int inc_b = k > 0 ? VectorStride(b_row) : 0;
+  sfloat* a = row.data;
+  sfloat* beta = b_row.data;
+  for (int j = 0; j < n; ++j) {
+    sfloat aj = a[j * inc_a];
+    if (aj == 0) {
+      continue;
+    }
+    sfloat* Rj = R.data + j * rs_R;  // row j
+    sfloat Rjj = Rj[j * cs_R];
+    sfloat r2 = Rjj * Rjj + sign * aj * aj;
+    if (r2 <= 0) {
+      return SLAP_SINGULAR_MATRIX;
+    }
+    sfloat r = sqrt(r2);
+    Rj[j * cs_R] = r;
+    if (sign > 0) {
+      // Givens rotation, dividing by the new diagonal so that a zero or rank-deficient R
+      // (e.g. when building it up one row at a time) is fine
+      sfloat c = Rjj / r;
+      sfloat s = aj / r;
+      for (int l = j + 1; l < n; ++l) {
+        sfloat Rjl = Rj[l * cs_R];
+        Rj[l * cs_R] = c * Rjl + s * a[l * inc_a];
+        a[l * inc_a] = c * a[l * inc_a] - s * Rjl;
+      }
+      for (int p = 0; p < k; ++p) {
+        sfloat* dj = Qtb.data + j * rs_d + p * cs_d;
+        sfloat djp = *dj;
+        *dj = c * djp + s * beta[p * inc_b];
+        beta[p * inc_b] = c * beta[p * inc_b] - s * djp;
+      }
+      continue;
+    }
+
+    // Hyperbolic rotation, in the mixed form that updates a[l] with the new R[j,l]
+    sfloat c = r / Rjj;
+    sfloat s = aj / Rjj;
+    sfloat c_inv = 1 / c;
+    for (int l = j + 1; l < n; ++l) {
+      sfloat Rjl = (Rj[l * cs_R] - s * a[l * inc_a]) * c_inv;
+      Rj[l * cs_R] = Rjl;
+      a[l * inc_a] = c * a[l * inc_a] - s * Rjl;
+    }
+    for (int p = 0; p < k; ++p) {
+      sfloat* dj = Qtb.data + j * rs_d + p * cs_d;
+      sfloat djp = (*dj - s * beta[p * inc_b]) * c_inv;
+      *dj = djp;
+      beta[p * inc_b] = c * beta[p * inc_b] - s * djp;
+    }
+  }
+  return SLAP_NO_ERROR;
+}
+
+enum slap_ErrorCode slap_QRAddRow(Matrix R, Matrix Qtb, Matrix row, Matrix b_row) {
+  return QRRowUpdate(R, Qtb, row, b_row, 1);
+}
+
+enum slap_ErrorCode slap_QRDeleteRow(Matrix R, Matrix Qtb, Matrix row, Matrix b_row) {
+  return QRRowUpdate(R, Qtb, row, b_row, -1);
+}
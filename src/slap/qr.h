@@ -5,7 +5,28 @@
 
 #pragma once
 
+#include <stddef.h>
+
 #include "matrix.h"
+#include "threads.h"
+
+// Matrices with at least SLAP_QR_THRESHOLD columns are factored in panels of
+// SLAP_QR_BLOCK_SIZE columns. The reflectors of each panel are aggregated into the compact
+// WY form \f$ I - V T V^T \f$ and applied to the rest of the matrix with slap_MatMulAdd().
+// The block reflector workspace lives on the stack and takes 4 * BLOCK_SIZE^2 elements.
+// Set SLAP_QR_BLOCK_SIZE to 0 to always apply the reflections one at a time.
+#if defined(__AVR__)
+#ifndef SLAP_QR_BLOCK_SIZE
+#define SLAP_QR_BLOCK_SIZE 0
+#endif
+#else
+#ifndef SLAP_QR_BLOCK_SIZE
+#define SLAP_QR_BLOCK_SIZE 32
+#endif
+#endif
+#ifndef SLAP_QR_THRESHOLD
+#define SLAP_QR_THRESHOLD 64
+#endif
 
 /**
  * @brief Performs QR decomposition
@@ -15,7 +36,13 @@
  * while the reflection vectors are stored below the diagonal, which
  * can be used to recover the Q matrix.
  *
- * See also: slap_ComputeQ(), slap_Qtb(), slap_LeastSquares()
+ * The reflection vectors are normalized so that their first element is 1, and
+ * \f$ Q = H_0 H_1 \cdots H_{n-1} \f$ with \f$ H_k = I - \beta_k v_k v_k^T \f$.
+ *
+ * Matrices with at least `SLAP_QR_THRESHOLD` columns are factored with a blocked
+ * algorithm that does most of its work in slap_MatMulAdd().
+ *
+ * See also: slap_ComputeQ(), slap_ApplyQt(), slap_Qtb(), slap_LeastSquares()
  *
  * **Header File:** `slap/qr.h`
  * @param A A square or skinny matrix
@@ -25,19 +52,87 @@
  */
 enum slap_ErrorCode slap_QR(Matrix A, Matrix betas, Matrix temp);
 
+/**
+ * @brief Arena bytes needed for the workspace of slap_QR()
+ *
+ * Covers the @p betas and @p temp vectors, allocated with slap_ArenaNewMatrix().
+ *
+ * **Header File:** `slap/qr.h`
+ * @param rows Number of rows in the matrix being factored
+ * @param cols Number of columns in the matrix being factored
+ */
+size_t slap_QRWorkspaceSize(int rows, int cols);
+
+/**
+ * @brief Multithreaded QR decomposition
+ *
+ * Same as slap_QR(), but the reflections are applied to the remaining columns of @p A in
+ * parallel, splitting the columns evenly across the threads in @p pool.
+ *
+ * **Header File:** `slap/qr.h`
+ * @param pool Thread pool from slap_ThreadPoolCreate(). Can be NULL.
+ * @param A A square or skinny matrix
+ * @param[out] betas Stores scaling factors needed to recover Q. Must have
+ *                   the same number of rows as A.
+ * @param[in] temp A temporary vector with the same number of rows as A.
+ */
+enum slap_ErrorCode slap_QRParallel(slap_ThreadPool* pool, Matrix A, Matrix betas,
+                                    Matrix temp);
+
 /**
  * @brief Computes the Q matrix from a previously-computed QR decomposition
  *
- * See also: slap_QR(), slap_LeastSquares(), slap_Qtb()
+ * If @p Q has fewer columns than rows, only the leading columns of \f$Q\f$ are computed,
+ * e.g. the "thin" \f$Q\f$ with the same size as @p R.
+ *
+ * See also: slap_QR(), slap_ApplyQ(), slap_LeastSquares(), slap_Qtb()
  *
  * **Header File:** `slap/qr.h`
- * @param[out] A A square matrix with the same number of rows as R.
+ * @param[out] Q A matrix with the same number of rows as R, and at most as many columns.
  * @param[in] R A square or skinny matrix containing the results from a QR decomposition.
  * @param[in] betas A vector of scaling factors needed to recover the Q matrix.
- * @param Q_work A temporary matrix of the same size as Q for intermediate calculations
  */
-enum slap_ErrorCode slap_ComputeQ(Matrix Q, const Matrix R, const Matrix betas,
-                                  Matrix Q_work);
+enum slap_ErrorCode slap_ComputeQ(Matrix Q, const Matrix R, const Matrix betas);
+
+/**
+ * @brief Arena bytes needed for the workspace of slap_ComputeQ()
+ *
+ * Always 0, since \f$Q\f$ is formed in place.
+ *
+ * **Header File:** `slap/qr.h`
+ * @param rows Number of rows in the factored matrix
+ * @param cols Number of columns in the factored matrix
+ */
+size_t slap_ComputeQWorkspaceSize(int rows, int cols);
+
+/**
+ * @brief Calculates \f$Q C\f$ without forming \f$Q\f$
+ *
+ * Applies the reflections stored in a QR decomposition to the columns of @p C, in
+ * blocks when possible. The result is stored in @p C.
+ *
+ * See also: slap_QR(), slap_ApplyQt(), slap_ComputeQ()
+ *
+ * **Header File:** `slap/qr.h`
+ * @param[in] R A square or skinny matrix containing the results from a QR decomposition.
+ * @param[in] betas Scaling factors for the reflections
+ * @param[in,out] C A matrix with the same number of rows as R
+ */
+enum slap_ErrorCode slap_ApplyQ(const Matrix R, const Matrix betas, Matrix C);
+
+/**
+ * @brief Calculates \f$Q^T C\f$ without forming \f$Q\f$
+ *
+ * Same as slap_ApplyQ(), but multiplies by the transpose of \f$Q\f$.
+ *
+ * See also: slap_QR(), slap_ApplyQ(), slap_Qtb(), slap_LeastSquares()
+ *
+ * **Header File:** `slap/qr.h`
+ * @param[in] R A square or skinny matrix containing the results from a QR decomposition.
+ * @param[in] betas Scaling factors for the reflections
+ * @param[in,out] C A matrix with the same number of rows as R
+ */
+enum slap_ErrorCode slap_ApplyQt(const Matrix R, const Matrix betas, Matrix C);
 
 /**
  * @brief Calculates \f$Q^T b\f$ where $Q$ is the orthogonal matrix from a QR decomposition
@@ -45,7 +140,7 @@ enum slap_ErrorCode slap_ComputeQ(Matrix Q, const Matrix R, const Matrix betas,
  * This method is useful for solving linear systems with the QR decomposition, where the
  * right side needs to be multiplied by \f$Q^T\f$.
  *
- * The result is stored in b.
+ * The result is stored in b. Same as slap_ApplyQt().
  *
  * See also: slap_QR(), slap_LeastSquares()
  *
@@ -69,7 +164,7 @@ enum slap_ErrorCode slap_Qtb(const Matrix R, const Matrix betas, Matrix b);
  *
  * **Header File:** `slap/qr.h`
  * @param[in,out] A A "skinny" matrix
- * @param[in,out] b
+ * @param[in,out] b One or more right-hand sides
  * @param[out] betas A vector of scaling factors to recover Q. Must have the same number of
  *                   rows as `A`.
  * @param temp A temporary vector used to compute the QR decomposition of `A`.
@@ -77,3 +172,67 @@ enum slap_ErrorCode slap_Qtb(const Matrix R, const Matrix betas, Matrix b);
  * @return
  */
 enum slap_ErrorCode slap_LeastSquares(Matrix A, Matrix b, Matrix betas, Matrix temp);
+
+/**
+ * @brief Arena bytes needed for the workspace of slap_LeastSquares()
+ *
+ * Covers the @p betas and @p temp vectors, allocated with slap_ArenaNewMatrix().
+ *
+ * **Header File:** `slap/qr.h`
+ * @param rows Number of rows in `A`
+ * @param cols Number of columns in `A`
+ */
+size_t slap_LeastSquaresWorkspaceSize(int rows, int cols);
+
+/**
+ * @brief Update a QR decomposition after appending a row
+ *
+ * Given the triangular factor \f$ R \f$ and \f$ d = Q^T b \f$ of a least squares problem
+ * \f$ \text{minimize} || A x - b || \f$, computes the factors for the problem with the
+ * extra row \f$ a^T x = \beta \f$ using Givens rotations, in \f$ O(n^2) \f$ time instead of
+ * the \f$ O(m n^2) \f$ needed to refactor \f$ A \f$.
+ *
+ * Only the leading n x n upper triangle of @p R is used, so it can be the output of
+ * slap_QR(). The Householder vectors stored below the diagonal are left alone, but no
+ * longer describe \f$ Q \f$, so slap_ApplyQ() and slap_ComputeQ() can't be used
+ * afterwards. The updated solution is found by solving \f$ R x = d \f$ with
+ * slap_TriSolve().
+ *
+ * @p R doesn't need to have full rank, so a streaming least squares problem can start
+ * from \f$ R = 0 \f$ and \f$ d = 0 \f$ and add its rows one at a time.
+ *
+ * See also: slap_QRDeleteRow()
+ *
+ * **Header File:** `slap/qr.h`
+ * @param[in,out] R Matrix with at least n rows whose upper triangle is \f$ R \f$
+ * @param[in,out] Qtb Matrix with at least n rows and k columns, whose first n rows are
+ *                    \f$ Q^T b \f$. Can be a null matrix, to only update \f$ R \f$.
+ * @param[in,out] row The new row \f$ a \f$, as a vector with n elements. Overwritten.
+ * @param[in,out] b_row The new entries of \f$ b \f$, as a vector with k elements. On
+ *                      exit, holds the residual of the new row after the update: the sum
+ *                      of squared residuals grows by its squared norm.
+ * @return slap error code
+ */
+enum slap_ErrorCode slap_QRAddRow(Matrix R, Matrix Qtb, Matrix row, Matrix b_row);
+
+/**
+ * @brief Update a QR decomposition after deleting a row
+ *
+ * The inverse of slap_QRAddRow(): removes the row \f$ a^T x = \beta \f$ from the least
+ * squares problem using hyperbolic rotations, in \f$ O(n^2) \f$ time. The row must be
+ * part of the problem described by @p R, e.g. the oldest measurement in a sliding
+ * window.
+ *
+ * If the remaining rows don't have full column rank the update stops, leaving @p R and
+ * @p Qtb in an unspecified state.
+ *
+ * **Header File:** `slap/qr.h`
+ * @param[in,out] R Matrix with at least n rows whose upper triangle is \f$ R \f$
+ * @param[in,out] Qtb Matrix with at least n rows and k columns, whose first n rows are
+ *                    \f$ Q^T b \f$. Can be a null matrix, to only update \f$ R \f$.
+ * @param[in,out] row The row \f$ a \f$ to remove, as a vector with n elements. Overwritten.
+ * @param[in,out] b_row The entries of \f$ b \f$ for the row, as a vector with k elements.
+ *                      Overwritten.
+ * @return SLAP_NO_ERROR, or SLAP_SINGULAR_MATRIX if \f$ R \f$ would become singular
+ */
+enum slap_ErrorCode slap_QRDeleteRow(Matrix R, Matrix Qtb, Matrix row, Matrix b_row);
@@ -0,0 +1,139 @@
+//
+// Created by Brian Jackson on 10/18/26.
+// Copyright (c) 2026 Robotic Exploration Lab. All rights reserved.
+//
+
+#include "riccati.h"
+
+#include "arena.h"
+#include "cholesky.h"
+#include "binary_ops.h"
+#include "copy_matrix.h"
+#include "kernels.h"
+#include "matmul.h"
+#include "tri.h"
+#include "unary_ops.h"
+
+// P = (P + P') / 2
+static void Symmetrize(Matrix P) {
+  int n = slap_NumRows(P);
+  for (int j = 0; j < n; ++j) {
+    for (int i = j + 1; i < n; ++i) {
+      sfloat* Pij = slap_GetElement(P, i, j);
+      sfloat* Pji = slap_GetElement(P, j, i);
+      sfloat avg = (*Pij + *Pji) / 2;
+      *Pij = avg;
+      *Pji = avg;
+    }
+  }
+}
+
+// P = Q + A' PA - G' G, computing each element of the lower triangle with two dot products
+// over contiguous columns and copying it to the upper triangle. Needs the columns of A to
+// be contiguous, i.e. A to be a dense matrix that isn't transposed.
+static void SymmetricCostToGo(Matrix P, Matrix Q, Matrix A, Matrix PA, Matrix G) {
+  const slap_Kernels* kernels = slap_GetKernels();
+  int n_next = slap_NumRows(A);
+  int n = slap_NumCols(A);
+  int m = slap_NumRows(G);
+  for (int j = 0; j < n; ++j) {
+    const sfloat* PAj = PA.data + j * n_next;
+    const sfloat* Gj = G.data + j * m;
+    for (int i = j; i < n; ++i) {
+      sfloat Pij = slap_SymmetricElement(Q, i, j);
+      Pij += kernels->dot(n_next, A.data + i * A.sy, PAj);
+      Pij -= kernels->dot(m, G.data + i * m, Gj);
+      slap_SetElement(P, i, j, Pij);
+      slap_SetElement(P, j, i, Pij);
+    }
+  }
+}
+
+enum slap_ErrorCode slap_RiccatiStep(Matrix K, Matrix P, Matrix A, Matrix B, Matrix Q,
+                                     Matrix R, Matrix P_next, Matrix work) {
+  SLAP_ASSERT_VALID(A, SLAP_INVALID_MATRIX, "RiccatiStep: A matrix invalid");
+  SLAP_ASSERT_VALID(B, SLAP_INVALID_MATRIX, "RiccatiStep: B matrix invalid");
+  int n_next = slap_NumRows(A);
+  int n = slap_NumCols(A);
+  int m = slap_NumCols(B);
+  SLAP_ASSERT(slap_NumRows(B) == n_next, SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              "RiccatiStep: B must have %d rows, like A", n_next);
+  SLAP_ASSERT(slap_NumRows(P_next) == n_next && slap_NumCols(P_next) == n_next,
+              SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS, SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              "RiccatiStep: P_next must be %d x %d", n_next, n_next);
+  SLAP_ASSERT(slap_NumRows(Q) == n && slap_NumCols(Q) == n && slap_NumRows(P) == n &&
+                  slap_NumCols(P) == n,
+              SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS, SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              "RiccatiStep: Q and P must be %d x %d", n, n);
+  SLAP_ASSERT(slap_NumRows(R) == m && slap_NumCols(R) == m && slap_NumRows(K) == m &&
+                  slap_NumCols(K) == n,
+              SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS, SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              "RiccatiStep: R must be %d x %d and K must be %d x %d", m, m, m, n);
+  SLAP_ASSERT_DENSE(work, SLAP_MATRIX_NOT_DENSE, "RiccatiStep: work must be dense");
+  SLAP_ASSERT(slap_NumElements(work) >= (n_next + m) * (n + m),
+              SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS, SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              "RiccatiStep: work must have at least %d elements", (n_next + m) * (n + m));
+
+  // P+ [B A]
+  Matrix PB = slap_MatrixFromArray(n_next, m, work.data);
+  Matrix PA = slap_MatrixFromArray(n_next, n, work.data + n_next * m);
+  slap_MatMulAdd(PB, P_next, B, 1, 0);
+  slap_MatMulAdd(PA, P_next, A, 1, 0);
+
+  // Blocks of the action-value Hessian, [Quu Qux] = R + B'P+ [B A], which are contiguous
+  // in the workspace
+  sfloat* H = work.data + n_next * (m + n);
+  Matrix Quu = slap_MatrixFromArray(m, m, H);
+  Matrix Qux = slap_MatrixFromArray(m, n, H + m * m);
+  slap_MatMulAdd(slap_MatrixFromArray(m, m + n, H), slap_Transpose(B),
+                 slap_MatrixFromArray(n_next, m + n, work.data), 1, 0);
+  slap_MatrixAddition(Quu, Quu, R, 1);
+
+  // Quu = L L', G = L \ Qux, K = L' \ G
+  enum slap_ErrorCode err = slap_CholeskyInfo(Quu, NULL);
+  if (err != SLAP_NO_ERROR) {
+    return err;
+  }
+  Matrix G = Qux;
+  slap_TriSolve(Quu, G);
+  slap_Copy(K, G);
+  slap_TriSolve(slap_Transpose(Quu), K);
+
+  // P = Q + A'P+ A - G'G. P+ isn't needed anymore, so P can alias it.
+  if (slap_GetType(A) == slap_DENSE && !slap_IsTransposed(A)) {
+    SymmetricCostToGo(P, Q, A, PA, G);
+  } else {
+    slap_SetConst(P, 0);
+    slap_MatrixAddition(P, P, Q, 1);
+    slap_MatMulAdd(P, slap_Transpose(A), PA, 1, 1);
+    slap_MatMulAdd(P, slap_Transpose(G), G, -1, 1);
+    Symmetrize(P);
+  }
+  return SLAP_NO_ERROR;
+}
+
+size_t slap_RiccatiWorkspaceSize(int n, int m) {
+  return slap_ArenaMatrixSize(n + m, n + m);
+}
+
+enum slap_ErrorCode slap_RiccatiRecursion(int N, const Matrix* K, const Matrix* P,
+                                          const Matrix* A, const Matrix* B, const Matrix* Q,
+                                          const Matrix* R, Matrix work, int* fail_step) {
+  SLAP_ASSERT(N > 0, SLAP_INVALID_MATRIX, SLAP_INVALID_MATRIX,
+              "RiccatiRecursion: horizon must have at least one knot point");
+  if (fail_step) {
+    *fail_step = -1;
+  }
+  for (int k = N - 2; k >= 0; --k) {
+    enum slap_ErrorCode err =
+        slap_RiccatiStep(K[k], P[k], A[k], B[k], Q[k], R[k], P[k + 1], work);
+    if (err != SLAP_NO_ERROR) {
+      if (fail_step) {
+        *fail_step = k;
+      }
+      return err;
+    }
+  }
+  return SLAP_NO_ERROR;
+}
@@ -0,0 +1,92 @@
+//
+// Created by Brian Jackson on 10/18/26.
+// Copyright (c) 2026 Robotic Exploration Lab. All rights reserved.
+//
+
+#pragma once
+
+#include <stddef.h>
+
+#include "matrix.h"
+
+/**
+ * @brief One step of the discrete-time LQR backward pass
+ *
+ * For the dynamics \f$ x^+ = A x + B u \f$, stage cost
+ * \f$ \frac{1}{2} (x^T Q x + u^T R u) \f$ and cost-to-go
+ * \f$ \frac{1}{2} x^{+T} P^+ x^+ \f$, computes the optimal feedback \f$ u = -K x \f$ and
+ * the new cost-to-go \f$ P \f$:
+ * \f[
+ * \begin{aligned}
+ * K &= (R + B^T P^+ B)^{-1} B^T P^+ A \\
+ * P &= Q + A^T P^+ A - (B^T P^+ A)^T K
+ * \end{aligned}
+ * \f]
+ *
+ * Instead of forming each product above separately, the blocks
+ * \f$ \begin{bmatrix} R + B^T P^+ B & B^T P^+ A \end{bmatrix} \f$ of the action-value
+ * Hessian are computed with a single product from \f$ P^+ \begin{bmatrix} B & A
+ * \end{bmatrix} \f$. Factoring the left block as \f$ L L^T \f$, the cost-to-go is the
+ * Schur complement \f$ P = Q + A^T P^+ A - G^T G \f$ with
+ * \f$ G = L^{-1} B^T P^+ A \f$, and \f$ K = L^{-T} G \f$, so no inverse or
+ * \f$ K^T (R + B^T P^+ B) K \f$ product is needed. Only the lower triangle of @p P is
+ * computed, with the `dot` kernel from slap_GetKernels(), and it's copied to the upper
+ * triangle, so @p P stays exactly symmetric over a long horizon.
+ *
+ * The dimensions can change between steps: @p A is \f$ n^+ \times n \f$ and @p B is
+ * \f$ n^+ \times m \f$.
+ *
+ * **Header File:** `slap/riccati.h`
+ * @param[out] K m x n feedback gain
+ * @param[out] P n x n cost-to-go. Can be the same matrix as @p P_next (when
+ *               \f$ n = n^+ \f$), e.g. to iterate to the infinite-horizon solution.
+ * @param[in] A State Jacobian of the dynamics
+ * @param[in] B Control Jacobian of the dynamics
+ * @param[in] Q n x n symmetric state cost. Can be a diagonal matrix.
+ * @param[in] R m x m symmetric control cost. Can be a diagonal matrix.
+ * @param[in] P_next \f$ n^+ \times n^+ \f$ symmetric cost-to-go at the next step
+ * @param work A dense workspace with at least \f$ (n^+ + m)(n + m) \f$ elements, e.g.
+ *             from an arena with slap_RiccatiWorkspaceSize() bytes
+ * @return SLAP_NO_ERROR, or SLAP_CHOLESKY_FAIL if \f$ R + B^T P^+ B \f$ isn't positive
+ *         definite
+ */
+enum slap_ErrorCode slap_RiccatiStep(Matrix K, Matrix P, Matrix A, Matrix B, Matrix Q,
+                                     Matrix R, Matrix P_next, Matrix work);
+
+/**
+ * @brief Arena bytes needed for the workspace of slap_RiccatiStep() and
+ *        slap_RiccatiRecursion()
+ *
+ * Covers the @p work vector, allocated with slap_ArenaNewMatrix(). If the dimensions
+ * change along the horizon, pass the largest ones.
+ *
+ * **Header File:** `slap/riccati.h`
+ * @param n Number of states
+ * @param m Number of controls
+ */
+size_t slap_RiccatiWorkspaceSize(int n, int m);
+
+/**
+ * @brief Full-horizon LQR backward pass
+ *
+ * Calls slap_RiccatiStep() for `k = N-2, ..., 0`, where step `k` computes `K[k]` and
+ * `P[k]` from `A[k]`, `B[k]`, `Q[k]`, `R[k]` and `P[k+1]`. For a time-invariant problem,
+ * the arrays of @p A, @p B, @p Q and @p R can all hold the same matrix.
+ *
+ * **Header File:** `slap/riccati.h`
+ * @param[in] N Number of knot points in the horizon
+ * @param[out] K Array of `N-1` feedback gains
+ * @param[inout] P Array of @p N cost-to-go matrices. `P[N-1]` holds the terminal cost,
+ *                 and the others are outputs.
+ * @param[in] A Array of `N-1` state Jacobians
+ * @param[in] B Array of `N-1` control Jacobians
+ * @param[in] Q Array of `N-1` state costs
+ * @param[in] R Array of `N-1` control costs
+ * @param work Workspace for slap_RiccatiStep(), large enough for every step
+ * @param[out] fail_step Step where \f$ R + B^T P^+ B \f$ wasn't positive definite, or -1
+ *                       if the recursion succeeded. Can be NULL.
+ * @return SLAP_NO_ERROR, or SLAP_CHOLESKY_FAIL if a step failed
+ */
+enum slap_ErrorCode slap_RiccatiRecursion(int N, const Matrix* K, const Matrix* P,
+                                          const Matrix* A, const Matrix* B, const Matrix* Q,
+                                          const Matrix* R, Matrix work, int* fail_step);
@@ -9,6 +9,7 @@ void __gcov_flush(void);
 
 #include "matrix.h"
 #include "new_matrix.h"
+#include "arena.h"
 #include "copy_matrix.h"
 #include "unary_ops.h"
 #include "binary_ops.h"
@@ -18,9 +19,27 @@ void __gcov_flush(void);
 #include "function_mapping.h"
 #include "strided_matrix.h"
 #include "matmul.h"
+#include "gemm.h"
+#include "fixed_size.h"
+#include "batched.h"
+#include "kernels.h"
+#include "threads.h"
 #include "cholesky.h"
+#include "band.h"
+#include "diagonal.h"
+#include "packed.h"
+#include "blocktri.h"
+#include "ldlt.h"
+#include "lu.h"
 #include "tri.h"
 #include "qr.h"
+#include "eigen.h"
+#include "svd.h"
+#include "expm.h"
+#include "riccati.h"
+#include "kalman.h"
+#include "sparse.h"
+#include "sparse_cholesky.h"
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,274 @@
+//
+// Created by Brian Jackson on 10/18/26.
+// Copyright (c) 2026 Robotic Exploration Lab. All rights reserved.
+//
+
+#include "sparse.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+#include "kernels.h"
+#include "unary_ops.h"
+
+static inline bool IsValidSparse(SparseMatrix A) {
+  return A.colptr != NULL && (A.colptr[A.cols] == 0 || (A.rowind && A.values));
+}
+
+SparseMatrix slap_SparseFromArrays(int rows, int cols, int nzmax, int* colptr, int* rowind,
+                                   sfloat* values) {
+  SparseMatrix mat = {
+      .rows = rows,
+      .cols = cols,
+      .nzmax = nzmax,
+      .is_transposed = false,
+      .colptr = colptr,
+      .rowind = rowind,
+      .values = values,
+  };
+  return mat;
+}
+
+SparseMatrix slap_NewSparseMatrix(int rows, int cols, int nzmax) {
+  int* colptr = (int*)calloc((size_t)(cols) + 1, sizeof(int));
+  int* rowind = (int*)malloc((size_t)(nzmax) * sizeof(int));
+  sfloat* values = (sfloat*)malloc((size_t)(nzmax) * sizeof(sfloat));
+  return slap_SparseFromArrays(rows, cols, nzmax, colptr, rowind, values);
+}
+
+enum slap_ErrorCode slap_FreeSparseMatrix(SparseMatrix* mat) {
+  if (!mat->colptr) {
+    return SLAP_BAD_MATRIX_DATA_POINTER;
+  }
+  free(mat->colptr);
+  free(mat->rowind);
+  free(mat->values);
+  mat->colptr = NULL;
+  mat->rowind = NULL;
+  mat->values = NULL;
+  return SLAP_NO_ERROR;
+}
+
+SparseMatrix slap_SparseTranspose(SparseMatrix mat) {
+  mat.is_transposed = !mat.is_transposed;
+  return mat;
+}
+
+enum slap_ErrorCode slap_SparseFromDense(SparseMatrix sparse, Matrix dense, sfloat tol) {
+  SLAP_ASSERT_VALID(dense, SLAP_INVALID_MATRIX, "SparseFromDense: dense matrix invalid");
+  SLAP_ASSERT(sparse.colptr != NULL, SLAP_BAD_POINTER, SLAP_BAD_POINTER,
+              "SparseFromDense: sparse matrix invalid");
+  SLAP_ASSERT(!sparse.is_transposed, SLAP_INVALID_MATRIX, SLAP_INVALID_MATRIX,
+              "SparseFromDense: sparse matrix can't be transposed");
+  SLAP_ASSERT(sparse.rows == slap_NumRows(dense) && sparse.cols == slap_NumCols(dense),
+              SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS, SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              "SparseFromDense: matrices must be the same size. Got sizes (%d,%d) and "
+              "(%d,%d)",
+              sparse.rows, sparse.cols, slap_NumRows(dense), slap_NumCols(dense));
+  int nnz = 0;
+  for (int j = 0; j < sparse.cols; ++j) {
+    sparse.colptr[j] = nnz;
+    for (int i = 0; i < sparse.rows; ++i) {
+      sfloat Aij = *slap_GetElement(dense, i, j);
+      if (fabs(Aij) > tol) {
+        if (nnz == sparse.nzmax) {
+          sparse.colptr[j + 1] = nnz;
+          return SLAP_ERROR(SLAP_INDEX_OUT_OF_BOUNDS,
+                            "SparseFromDense: more than %d nonzeros", sparse.nzmax);
+        }
+        sparse.rowind[nnz] = i;
+        sparse.values[nnz] = Aij;
+        ++nnz;
+      }
+    }
+  }
+  sparse.colptr[sparse.cols] = nnz;
+  return SLAP_NO_ERROR;
+}
+
+enum slap_ErrorCode slap_SparseToDense(Matrix dense, SparseMatrix sparse) {
+  SLAP_ASSERT_VALID(dense, SLAP_INVALID_MATRIX, "SparseToDense: dense matrix invalid");
+  SLAP_ASSERT(IsValidSparse(sparse), SLAP_BAD_POINTER, SLAP_BAD_POINTER,
+              "SparseToDense: sparse matrix invalid");
+  SLAP_ASSERT(slap_SparseNumRows(sparse) == slap_NumRows(dense) &&
+                  slap_SparseNumCols(sparse) == slap_NumCols(dense),
+              SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS, SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              "SparseToDense: matrices must be the same size. Got sizes (%d,%d) and "
+              "(%d,%d)",
+              slap_NumRows(dense), slap_NumCols(dense), slap_SparseNumRows(sparse),
+              slap_SparseNumCols(sparse));
+  slap_SetConst(dense, 0);
+  for (int j = 0; j < sparse.cols; ++j) {
+    for (int p = sparse.colptr[j]; p < sparse.colptr[j + 1]; ++p) {
+      int i = sparse.rowind[p];
+      if (sparse.is_transposed) {
+        slap_SetElement(dense, j, i, sparse.values[p]);
+      } else {
+        slap_SetElement(dense, i, j, sparse.values[p]);
+      }
+    }
+  }
+  return SLAP_NO_ERROR;
+}
+
+enum slap_ErrorCode slap_SparseMatMulAdd(Matrix C, SparseMatrix A, Matrix B, sfloat alpha,
+                                         sfloat beta) {
+  SLAP_ASSERT_VALID(C, SLAP_INVALID_MATRIX, "SparseMatMulAdd: invalid C matrix");
+  SLAP_ASSERT(IsValidSparse(A), SLAP_BAD_POINTER, SLAP_BAD_POINTER,
+              "SparseMatMulAdd: invalid A matrix");
+  SLAP_ASSERT_VALID(B, SLAP_INVALID_MATRIX, "SparseMatMulAdd: invalid B matrix");
+  SLAP_ASSERT(slap_GetType(B) == slap_DENSE && slap_GetType(C) == slap_DENSE,
+              SLAP_INVALID_MATRIX, SLAP_INVALID_MATRIX,
+              "SparseMatMulAdd: B and C must be dense matrices");
+  SLAP_ASSERT(slap_NumRows(C) == slap_SparseNumRows(A), SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              "SparseMatMulAdd: Rows of C (%d) not equal to Rows of A (%d).",
+              slap_NumRows(C), slap_SparseNumRows(A));
+  SLAP_ASSERT(slap_SparseNumCols(A) == slap_NumRows(B), SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              "SparseMatMulAdd: Columns of A (%d) not equal to Rows of B (%d).",
+              slap_SparseNumCols(A), slap_NumRows(B));
+  SLAP_ASSERT(slap_NumCols(C) == slap_NumCols(B), SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              "SparseMatMulAdd: Columns of C (%d) not equal to Columns of B (%d).",
+              slap_NumCols(C), slap_NumCols(B));
+  if (beta == 0) {
+    slap_SetConst(C, 0);
+  } else if (beta != 1) {
+    slap_ScaleByConst(C, beta);
+  }
+  int m = slap_NumCols(B);
+  int rs_B = slap_RowStride(B);
+  int cs_B = slap_ColStride(B);
+  int rs_C = slap_RowStride(C);
+  int cs_C = slap_ColStride(C);
+
+  for (int j = 0; j < A.cols; ++j) {
+    int start = A.colptr[j];
+    int stop = A.colptr[j + 1];
+    if (!A.is_transposed) {
+      // Scatter row j of B into the nonzero rows of C. Looping over the columns of B
+      // innermost reads each nonzero of A once.
+      const sfloat* Bj = B.data + j * rs_B;
+      for (int p = start; p < stop; ++p) {
+        sfloat Aij = alpha * A.values[p];
+        sfloat* Ci = C.data + A.rowind[p] * rs_C;
+        for (int k = 0; k < m; ++k) {
+          Ci[k * cs_C] += Aij * Bj[k * cs_B];
+        }
+      }
+    } else {
+      // Row j of C is a sparse dot product of column j of A with each column of B
+      sfloat* Cj = C.data + j * rs_C;
+      for (int k = 0; k < m; ++k) {
+        const sfloat* Bk = B.data + k * cs_B;
+        sfloat sum = 0;
+        for (int p = start; p < stop; ++p) {
+          sum += A.values[p] * Bk[A.rowind[p] * rs_B];
+        }
+        Cj[k * cs_C] += alpha * sum;
+      }
+    }
+  }
+  return SLAP_NO_ERROR;
+}
+
+enum slap_ErrorCode slap_MatMulSparseAdd(Matrix C, Matrix A, SparseMatrix B, sfloat alpha,
+                                         sfloat beta) {
+  SLAP_ASSERT_VALID(C, SLAP_INVALID_MATRIX, "MatMulSparseAdd: invalid C matrix");
+  SLAP_ASSERT_VALID(A, SLAP_INVALID_MATRIX, "MatMulSparseAdd: invalid A matrix");
+  SLAP_ASSERT(IsValidSparse(B), SLAP_BAD_POINTER, SLAP_BAD_POINTER,
+              "MatMulSparseAdd: invalid B matrix");
+  SLAP_ASSERT(slap_GetType(A) == slap_DENSE && slap_GetType(C) == slap_DENSE,
+              SLAP_INVALID_MATRIX, SLAP_INVALID_MATRIX,
+              "MatMulSparseAdd: A and C must be dense matrices");
+  SLAP_ASSERT(slap_NumRows(C) == slap_NumRows(A), SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              "MatMulSparseAdd: Rows of C (%d) not equal to Rows of A (%d).",
+              slap_NumRows(C), slap_NumRows(A));
+  SLAP_ASSERT(slap_NumCols(A) == slap_SparseNumRows(B), SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              "MatMulSparseAdd: Columns of A (%d) not equal to Rows of B (%d).",
+              slap_NumCols(A), slap_SparseNumRows(B));
+  SLAP_ASSERT(slap_NumCols(C) == slap_SparseNumCols(B), SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              "MatMulSparseAdd: Columns of C (%d) not equal to Columns of B (%d).",
+              slap_NumCols(C), slap_SparseNumCols(B));
+  if (beta == 0) {
+    slap_SetConst(C, 0);
+  } else if (beta != 1) {
+    slap_ScaleByConst(C, beta);
+  }
+  int n = slap_NumRows(C);
+  int rs_A = slap_RowStride(A);
+  int cs_A = slap_ColStride(A);
+  int rs_C = slap_RowStride(C);
+  int cs_C = slap_ColStride(C);
+  const slap_Kernels* kernels = slap_GetKernels();
+
+  // Each nonzero B[i,j] adds a scaled column i of A to column j of C. The stored
+  // column and row indices swap roles when B is transposed.
+  for (int s = 0; s < B.cols; ++s) {
+    for (int p = B.colptr[s]; p < B.colptr[s + 1]; ++p) {
+      int i = B.is_transposed ? s : B.rowind[p];
+      int j = B.is_transposed ? B.rowind[p] : s;
+      sfloat Bij = alpha * B.values[p];
+      const sfloat* Ai = A.data + i * cs_A;
+      sfloat* Cj = C.data + j * cs_C;
+      if (rs_A == 1 && rs_C == 1) {
+        kernels->axpy(n, Bij, Ai, Cj);
+      } else {
+        for (int k = 0; k < n; ++k) {
+          Cj[k * rs_C] += Bij * Ai[k * rs_A];
+        }
+      }
+    }
+  }
+  return SLAP_NO_ERROR;
+}
+
+enum slap_ErrorCode slap_SparseAddition(SparseMatrix C, SparseMatrix A, SparseMatrix B,
+                                        sfloat alpha) {
+  SLAP_ASSERT(IsValidSparse(C) && IsValidSparse(A) && IsValidSparse(B), SLAP_BAD_POINTER,
+              SLAP_BAD_POINTER, "SparseAddition: invalid sparse matrix");
+  SLAP_ASSERT(!C.is_transposed && !A.is_transposed && !B.is_transposed,
+              SLAP_INVALID_MATRIX, SLAP_INVALID_MATRIX,
+              "SparseAddition: matrices can't be transposed");
+  SLAP_ASSERT(A.rows == C.rows && A.cols == C.cols && B.rows == C.rows && B.cols == C.cols,
+              SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS, SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              "SparseAddition: matrices must be the same size");
+
+  // Shared pattern: just combine the values
+  if (A.colptr == C.colptr && A.rowind == C.rowind && B.colptr == C.colptr &&
+      B.rowind == C.rowind) {
+    int nnz = slap_SparseNumNonzeros(C);
+    for (int p = 0; p < nnz; ++p) {
+      C.values[p] = A.values[p] + alpha * B.values[p];
+    }
+    return SLAP_NO_ERROR;
+  }
+
+  // Merge the sorted row indices of each column into the pattern of C
+  for (int j = 0; j < C.cols; ++j) {
+    int pa = A.colptr[j];
+    int pb = B.colptr[j];
+    for (int pc = C.colptr[j]; pc < C.colptr[j + 1]; ++pc) {
+      int i = C.rowind[pc];
+      sfloat Cij = 0;
+      if (pa < A.colptr[j + 1] && A.rowind[pa] == i) {
+        Cij += A.values[pa++];
+      }
+      if (pb < B.colptr[j + 1] && B.rowind[pb] == i) {
+        Cij += alpha * B.values[pb++];
+      }
+      C.values[pc] = Cij;
+    }
+    if (pa != A.colptr[j + 1] || pb != B.colptr[j + 1]) {
+      return SLAP_ERROR(SLAP_INDEX_OUT_OF_BOUNDS,
+                        "SparseAddition: column %d of A or B has a nonzero that isn't in "
+                        "the pattern of C",
+                        j);
+    }
+  }
+  return SLAP_NO_ERROR;
+}
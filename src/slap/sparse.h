@@ -0,0 +1,186 @@
+//
+// Created by Brian Jackson on 10/18/26.
+// Copyright (c) 2026 Robotic Exploration Lab. All rights reserved.
+//
+
+#pragma once
+
+#include "matrix.h"
+
+/**
+ * @brief Sparse matrix in compressed sparse column (CSC) format
+ *
+ * The row indices and values of the nonzeros in column `j` are stored in
+ * `rowind[colptr[j]:colptr[j+1]]` and `values[colptr[j]:colptr[j+1]]`, so there are
+ * `colptr[cols]` nonzeros in total. The row indices in each column must be sorted in
+ * increasing order.
+ *
+ * Like Matrix, a sparse matrix doesn't own its data, and can be transposed with
+ * slap_SparseTranspose() without moving any data.
+ */
+typedef struct {
+  slap_dim_t rows;     //!< number of rows
+  slap_dim_t cols;     //!< number of columns
+  int nzmax;           //!< capacity of the rowind and values arrays
+  bool is_transposed;  //!< is the data transposed
+  int* colptr;         //!< start of each column, with cols + 1 entries
+  int* rowind;         //!< row index of each nonzero
+  sfloat* values;      //!< value of each nonzero
+} SparseMatrix;
+
+/**
+ * @brief Wrap existing arrays in a CSC sparse matrix
+ *
+ * **Header File:** `slap/sparse.h`
+ * @param rows Number of rows
+ * @param cols Number of columns
+ * @param nzmax Length of @p rowind and @p values
+ * @param colptr Column pointers, with `cols + 1` entries
+ * @param rowind Row indices of the nonzeros
+ * @param values Values of the nonzeros
+ * @return A new sparse matrix
+ */
+SparseMatrix slap_SparseFromArrays(int rows, int cols, int nzmax, int* colptr, int* rowind,
+                                   sfloat* values);
+
+/**
+ * @brief Allocate a new sparse matrix on the heap, with no nonzeros
+ *
+ * Space is allocated for @p nzmax nonzeros, which can be filled in with
+ * slap_SparseFromDense() or directly. Must be followed by a call to
+ * slap_FreeSparseMatrix().
+ *
+ * **Header File:** `slap/sparse.h`
+ * @param rows Number of rows
+ * @param cols Number of columns
+ * @param nzmax Maximum number of nonzeros
+ * @return A new sparse matrix
+ */
+SparseMatrix slap_NewSparseMatrix(int rows, int cols, int nzmax);
+
+/**
+ * @brief Free the data for a sparse matrix created with slap_NewSparseMatrix()
+ *
+ * **Header File:** `slap/sparse.h`
+ * @param mat Sparse matrix whose data will be freed
+ * @return slap error code
+ */
+enum slap_ErrorCode slap_FreeSparseMatrix(SparseMatrix* mat);
+
+/**
+ * @brief Transpose a sparse matrix
+ *
+ * Only flips a flag, like slap_Transpose().
+ *
+ * **Header File:** `slap/sparse.h`
+ */
+SparseMatrix slap_SparseTranspose(SparseMatrix mat);
+
+/**
+ * @brief Number of rows of the sparse matrix, accounting for the transpose
+ *
+ * **Header File:** `slap/sparse.h`
+ */
+static inline int slap_SparseNumRows(SparseMatrix mat) {
+  return mat.is_transposed ? mat.cols : mat.rows;
+}
+
+/**
+ * @brief Number of columns of the sparse matrix, accounting for the transpose
+ *
+ * **Header File:** `slap/sparse.h`
+ */
+static inline int slap_SparseNumCols(SparseMatrix mat) {
+  return mat.is_transposed ? mat.rows : mat.cols;
+}
+
+/**
+ * @brief Number of nonzeros stored in the sparse matrix
+ *
+ * **Header File:** `slap/sparse.h`
+ */
+static inline int slap_SparseNumNonzeros(SparseMatrix mat) { return mat.colptr[mat.cols]; }
+
+/**
+ * @brief Convert a dense matrix to a sparse matrix
+ *
+ * Stores every element whose magnitude is greater than @p tol.
+ *
+ * **Header File:** `slap/sparse.h`
+ * @param[out] sparse A sparse matrix of the same size, which can't be transposed
+ * @param[in] dense Any dense matrix
+ * @param[in] tol Elements with a magnitude at or below this value are dropped. Use 0 to
+ *                keep all nonzero elements.
+ * @return SLAP_NO_ERROR, or SLAP_INDEX_OUT_OF_BOUNDS if there are more than `nzmax`
+ *         nonzeros.
+ */
+enum slap_ErrorCode slap_SparseFromDense(SparseMatrix sparse, Matrix dense, sfloat tol);
+
+/**
+ * @brief Convert a sparse matrix to a dense matrix
+ *
+ * **Header File:** `slap/sparse.h`
+ * @param[out] dense A dense matrix of the same size
+ * @param[in] sparse A sparse matrix, which can be transposed
+ * @return slap error code
+ */
+enum slap_ErrorCode slap_SparseToDense(Matrix dense, SparseMatrix sparse);
+
+/**
+ * @brief Sparse-dense matrix multiplication
+ *
+ * Computes \f$ C = \beta C + \alpha A B \f$, where @p A is sparse. If @p A is transposed,
+ * each element of @p C is a sparse dot product with a column of @p A, so
+ * Jacobian-transpose products like \f$ J^T \lambda \f$ don't need a transposed copy of
+ * \f$ J \f$. The work is proportional to the number of nonzeros in @p A times the
+ * number of columns of @p B.
+ *
+ * **Header File:** `slap/sparse.h`
+ * @param[out] C Dense output matrix
+ * @param[in] A Sparse matrix, which can be transposed
+ * @param[in] B Dense matrix, which can be strided or transposed. Use a single column for a
+ *              sparse matrix-vector product.
+ * @param[in] alpha scaling on the product
+ * @param[in] beta scaling on the original value of @p C
+ * @return slap error code
+ */
+enum slap_ErrorCode slap_SparseMatMulAdd(Matrix C, SparseMatrix A, Matrix B, sfloat alpha,
+                                         sfloat beta);
+
+/**
+ * @brief Dense-sparse matrix multiplication
+ *
+ * Computes \f$ C = \beta C + \alpha A B \f$, where @p B is sparse, by adding scaled
+ * columns of @p A to the columns of @p C.
+ *
+ * **Header File:** `slap/sparse.h`
+ * @param[out] C Dense output matrix
+ * @param[in] A Dense matrix, which can be strided or transposed
+ * @param[in] B Sparse matrix, which can be transposed
+ * @param[in] alpha scaling on the product
+ * @param[in] beta scaling on the original value of @p C
+ * @return slap error code
+ */
+enum slap_ErrorCode slap_MatMulSparseAdd(Matrix C, Matrix A, SparseMatrix B, sfloat alpha,
+                                         sfloat beta);
+
+/**
+ * @brief Add two sparse matrices, keeping the sparsity pattern of the output
+ *
+ * Calculates \f$ C = A + \alpha B \f$ for the nonzeros of @p C. The patterns of @p A and
+ * @p B must be contained in the pattern of @p C, which isn't changed. When all three
+ * share the same pattern (e.g. Jacobians evaluated at different points), this is a
+ * single pass over the values.
+ *
+ * @p C can be aliased with @p A or @p B. None of the matrices can be transposed.
+ *
+ * **Header File:** `slap/sparse.h`
+ * @param[out] C Destination sparse matrix
+ * @param[in] A Sparse matrix of the same size
+ * @param[in] B Sparse matrix of the same size
+ * @param alpha Scaling on @p B
+ * @return SLAP_NO_ERROR, or SLAP_INDEX_OUT_OF_BOUNDS if a nonzero of @p A or @p B isn't
+ *         in the pattern of @p C
+ */
+enum slap_ErrorCode slap_SparseAddition(SparseMatrix C, SparseMatrix A, SparseMatrix B,
+                                        sfloat alpha);
@@ -0,0 +1,561 @@
+//
+// Created by Brian Jackson on 10/18/26.
+// Copyright (c) 2026 Robotic Exploration Lab. All rights reserved.
+//
+
+#include "sparse_cholesky.h"
+
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cholesky.h"
+#include "kernels.h"
+#include "matmul.h"
+#include "tri.h"
+
+struct slap_SparseCholesky {
+  int n;
+  int nnz_A;        // nonzeros of the analyzed matrix
+  int nnz_L;        // nonzeros of the factor
+  int nsuper;       // number of supernodes
+  int* perm;        // column k of L is column perm[k] of A
+  int* iperm;       // inverse of perm
+  int* super;       // first column of each supernode, with nsuper + 1 entries
+  int* col_super;   // supernode containing each column
+  int* rowptr;      // start of the row indices of each supernode, with nsuper + 1 entries
+  int* rowind;      // sorted row indices of each supernode, starting with its own columns
+  int* valptr;      // start of the values of each supernode, with nsuper + 1 entries
+  sfloat* values;   // column-major block of each supernode, with one row per row index
+  int* amap;        // position in values of each nonzero of A, or -1 if it's ignored
+  int* map;         // position of each row in the supernode being updated
+  sfloat* work;     // update block in the factorization, and the solution in the solve
+};
+
+// A dense view of a column-major block with leading dimension sy
+static Matrix Block(sfloat* data, int rows, int cols, int sy) {
+  Matrix block = slap_MatrixFromArray(rows, cols, data);
+  block.sy = sy;
+  return block;
+}
+
+static int CompareInt(const void* a, const void* b) {
+  int x = *(const int*)a;
+  int y = *(const int*)b;
+  return (x > y) - (x < y);
+}
+
+// Minimum degree ordering on the explicit elimination graph. Eliminating a node connects
+// all of its neighbors, so their adjacency lists are rebuilt by merging sorted lists.
+// This is slower than the quotient graph used by AMD, but it only runs once per pattern.
+static bool MinimumDegree(SparseMatrix A, int* perm) {
+  int n = A.rows;
+  int* deg = (int*)calloc(n, sizeof(int));
+  int* cap = (int*)calloc(n, sizeof(int));
+  int** adj = (int**)calloc(n, sizeof(int*));
+  int* buf = (int*)malloc(n * sizeof(int));
+  bool* done = (bool*)calloc(n, sizeof(bool));
+  bool ok = deg && cap && adj && buf && done;
+
+  // Symmetric adjacency lists from the strictly lower triangle
+  for (int j = 0; ok && j < n; ++j) {
+    for (int p = A.colptr[j]; p < A.colptr[j + 1]; ++p) {
+      if (A.rowind[p] > j) {
+        ++cap[A.rowind[p]];
+        ++cap[j];
+      }
+    }
+  }
+  for (int v = 0; ok && v < n; ++v) {
+    adj[v] = (int*)malloc((cap[v] > 0 ? cap[v] : 1) * sizeof(int));
+    ok = adj[v] != NULL;
+  }
+  for (int j = 0; ok && j < n; ++j) {
+    for (int p = A.colptr[j]; p < A.colptr[j + 1]; ++p) {
+      int i = A.rowind[p];
+      if (i > j) {
+        adj[i][deg[i]++] = j;
+        adj[j][deg[j]++] = i;
+      }
+    }
+  }
+  for (int v = 0; ok && v < n; ++v) {
+    qsort(adj[v], deg[v], sizeof(int), CompareInt);
+  }
+
+  for (int k = 0; ok && k < n; ++k) {
+    int v = -1;
+    for (int u = 0; u < n; ++u) {
+      if (!done[u] && (v < 0 || deg[u] < deg[v])) {
+        v = u;
+      }
+    }
+    perm[k] = v;
+    done[v] = true;
+
+    // Each neighbor u of v is now adjacent to the rest of v's neighbors
+    for (int q = 0; ok && q < deg[v]; ++q) {
+      int u = adj[v][q];
+      int len = 0;
+      int a = 0;
+      int b = 0;
+      while (a < deg[u] || b < deg[v]) {
+        int x = a < deg[u] ? adj[u][a] : INT_MAX;
+        int y = b < deg[v] ? adj[v][b] : INT_MAX;
+        int next = x < y ? x : y;
+        a += x == next;
+        b += y == next;
+        if (next != u && next != v) {
+          buf[len++] = next;
+        }
+      }
+      if (len > cap[u]) {
+        int* grown = (int*)realloc(adj[u], len * sizeof(int));
+        ok = grown != NULL;
+        if (!ok) {
+          break;
+        }
+        adj[u] = grown;
+        cap[u] = len;
+      }
+      memcpy(adj[u], buf, len * sizeof(int));
+      deg[u] = len;
+    }
+    free(adj[v]);
+    adj[v] = NULL;
+  }
+
+  for (int v = 0; adj && v < n; ++v) {
+    free(adj[v]);
+  }
+  free(deg);
+  free(cap);
+  free(adj);
+  free(buf);
+  free(done);
+  return ok;
+}
+
+// Strictly lower triangle of P A P', stored by rows: Rj[Rp[k]:Rp[k+1]] are the columns
+// of the nonzeros in row k
+static void PermutedRows(SparseMatrix A, const int* iperm, int* Rp, int* Rj, int* next) {
+  int n = A.rows;
+  memset(Rp, 0, (n + 1) * sizeof(int));
+  for (int j = 0; j < n; ++j) {
+    for (int p = A.colptr[j]; p < A.colptr[j + 1]; ++p) {
+      int i = A.rowind[p];
+      if (i > j) {
+        int r = iperm[i] > iperm[j] ? iperm[i] : iperm[j];
+        ++Rp[r + 1];
+      }
+    }
+  }
+  for (int k = 0; k < n; ++k) {
+    Rp[k + 1] += Rp[k];
+    next[k] = Rp[k];
+  }
+  for (int j = 0; j < n; ++j) {
+    for (int p = A.colptr[j]; p < A.colptr[j + 1]; ++p) {
+      int i = A.rowind[p];
+      if (i > j) {
+        int r = iperm[i] > iperm[j] ? iperm[i] : iperm[j];
+        int c = iperm[i] > iperm[j] ? iperm[j] : iperm[i];
+        Rj[next[r]++] = c;
+      }
+    }
+  }
+}
+
+// Elimination tree, using path compression on the ancestors (Liu's algorithm)
+static void EliminationTree(int n, const int* Rp, const int* Rj, int* parent,
+                            int* ancestor) {
+  for (int k = 0; k < n; ++k) {
+    parent[k] = -1;
+    ancestor[k] = -1;
+    for (int p = Rp[k]; p < Rp[k + 1]; ++p) {
+      int i = Rj[p];
+      while (i != -1 && i < k) {
+        int next = ancestor[i];
+        ancestor[i] = k;
+        if (next == -1) {
+          parent[i] = k;
+        }
+        i = next;
+      }
+    }
+  }
+}
+
+// Depth-first postorder of the elimination tree, visiting children in increasing order
+static void Postorder(int n, const int* parent, int* post, int* head, int* next,
+                      int* stack) {
+  for (int j = 0; j < n; ++j) {
+    head[j] = -1;
+  }
+  for (int j = n - 1; j >= 0; --j) {
+    if (parent[j] != -1) {
+      next[j] = head[parent[j]];
+      head[parent[j]] = j;
+    }
+  }
+  int k = 0;
+  for (int root = 0; root < n; ++root) {
+    if (parent[root] != -1) {
+      continue;
+    }
+    int top = 0;
+    stack[0] = root;
+    while (top >= 0) {
+      int p = stack[top];
+      int child = head[p];
+      if (child == -1) {
+        --top;
+        post[k++] = p;
+      } else {
+        head[p] = next[child];
+        stack[++top] = child;
+      }
+    }
+  }
+}
+
+// Visits the nonzeros L[k,j], j < k, in row k of the factor by walking up the
+// elimination tree from each nonzero of row k of A until reaching a column already seen.
+// Counts the nonzeros of each column if rowind is NULL, otherwise appends k to the row
+// indices of the supernodes that start at column j.
+static void RowSubtrees(const slap_SparseCholesky* chol, const int* Rp, const int* Rj,
+                        const int* parent, int* mark, int* count, int* rowind, int* fill) {
+  int n = chol->n;
+  for (int j = 0; j < n; ++j) {
+    mark[j] = -1;
+  }
+  for (int k = 0; k < n; ++k) {
+    mark[k] = k;
+    for (int p = Rp[k]; p < Rp[k + 1]; ++p) {
+      for (int j = Rj[p]; mark[j] != k; j = parent[j]) {
+        mark[j] = k;
+        if (!rowind) {
+          ++count[j];
+        } else if (chol->super[chol->col_super[j]] == j) {
+          rowind[fill[chol->col_super[j]]++] = k;
+        }
+      }
+    }
+  }
+}
+
+// Rows a:b of supernode s all belong to the same supernode. Returns b.
+static int TargetBlockEnd(const slap_SparseCholesky* chol, const int* rows, int nr, int a) {
+  int t = chol->col_super[rows[a]];
+  int b = a;
+  while (b < nr && rows[b] < chol->super[t + 1]) {
+    ++b;
+  }
+  return b;
+}
+
+// Everything after the ordering, once the final permutation is known
+static bool Symbolic(slap_SparseCholesky* chol, SparseMatrix A, int* Rp, int* Rj,
+                     int* parent, int* iwork) {
+  int n = chol->n;
+  int* count = iwork;
+  int* mark = iwork + n;
+  PermutedRows(A, chol->iperm, Rp, Rj, mark);
+  EliminationTree(n, Rp, Rj, parent, mark);
+  for (int j = 0; j < n; ++j) {
+    count[j] = 1;
+  }
+  RowSubtrees(chol, Rp, Rj, parent, mark, count, NULL, NULL);
+  chol->nnz_L = 0;
+  for (int j = 0; j < n; ++j) {
+    chol->nnz_L += count[j];
+  }
+
+  // Fundamental supernodes: column j joins the supernode of column j-1 if it's the
+  // parent of j-1 and has the same pattern below the diagonal
+  chol->nsuper = 0;
+  for (int j = 0; j < n; ++j) {
+    if (j == 0 || parent[j - 1] != j || count[j - 1] != count[j] + 1) {
+      chol->super[chol->nsuper++] = j;
+    }
+    chol->col_super[j] = chol->nsuper - 1;
+  }
+  chol->super[chol->nsuper] = n;
+
+  int nsuper = chol->nsuper;
+  chol->rowptr = (int*)malloc((nsuper + 1) * sizeof(int));
+  chol->valptr = (int*)malloc((nsuper + 1) * sizeof(int));
+  if (!chol->rowptr || !chol->valptr) {
+    return false;
+  }
+  chol->rowptr[0] = 0;
+  chol->valptr[0] = 0;
+  for (int s = 0; s < nsuper; ++s) {
+    int nc = chol->super[s + 1] - chol->super[s];
+    int nr = count[chol->super[s]];
+    chol->rowptr[s + 1] = chol->rowptr[s] + nr;
+    chol->valptr[s + 1] = chol->valptr[s] + nr * nc;
+  }
+  chol->rowind = (int*)malloc(chol->rowptr[nsuper] * sizeof(int));
+  chol->values = (sfloat*)malloc(chol->valptr[nsuper] * sizeof(sfloat));
+  chol->amap = (int*)malloc((chol->nnz_A > 0 ? chol->nnz_A : 1) * sizeof(int));
+  if (!chol->rowind || !chol->values || !chol->amap) {
+    return false;
+  }
+
+  // The pattern of each supernode is the pattern of its first column
+  int* fill = count;
+  for (int s = 0; s < nsuper; ++s) {
+    chol->rowind[chol->rowptr[s]] = chol->super[s];
+    fill[s] = chol->rowptr[s] + 1;
+  }
+  RowSubtrees(chol, Rp, Rj, parent, mark, NULL, chol->rowind, fill);
+
+  // Where each nonzero of the lower triangle of A goes in the factor
+  for (int j = 0; j < n; ++j) {
+    for (int p = A.colptr[j]; p < A.colptr[j + 1]; ++p) {
+      int i = A.rowind[p];
+      chol->amap[p] = -1;
+      if (i < j) {
+        continue;
+      }
+      int r = chol->iperm[i] > chol->iperm[j] ? chol->iperm[i] : chol->iperm[j];
+      int c = chol->iperm[i] > chol->iperm[j] ? chol->iperm[j] : chol->iperm[i];
+      int s = chol->col_super[c];
+      const int* rows = chol->rowind + chol->rowptr[s];
+      int nr = chol->rowptr[s + 1] - chol->rowptr[s];
+      const int* pos = (const int*)bsearch(&r, rows, nr, sizeof(int), CompareInt);
+      chol->amap[p] = chol->valptr[s] + (c - chol->super[s]) * nr + (int)(pos - rows);
+    }
+  }
+
+  // Largest update block, which is also used for the solution vector in the solve
+  int work_size = n;
+  for (int s = 0; s < nsuper; ++s) {
+    int nc = chol->super[s + 1] - chol->super[s];
+    int nr = chol->rowptr[s + 1] - chol->rowptr[s];
+    const int* rows = chol->rowind + chol->rowptr[s];
+    for (int a = nc; a < nr;) {
+      int b = TargetBlockEnd(chol, rows, nr, a);
+      if ((nr - a) * (b - a) > work_size) {
+        work_size = (nr - a) * (b - a);
+      }
+      a = b;
+    }
+  }
+  chol->work = (sfloat*)malloc(work_size * sizeof(sfloat));
+  return chol->work != NULL;
+}
+
+slap_SparseCholesky* slap_SparseCholeskyAnalyze(SparseMatrix A, const int* perm) {
+  SLAP_ASSERT(A.colptr != NULL && !A.is_transposed && A.rows == A.cols, SLAP_INVALID_MATRIX,
+              NULL, "SparseCholeskyAnalyze: A must be a square sparse matrix that isn't "
+                    "transposed");
+  int n = A.rows;
+  slap_SparseCholesky* chol = (slap_SparseCholesky*)calloc(1, sizeof(slap_SparseCholesky));
+  if (!chol) {
+    return NULL;
+  }
+  chol->n = n;
+  chol->nnz_A = A.colptr[n];
+  chol->perm = (int*)malloc((n + 1) * sizeof(int));
+  chol->iperm = (int*)malloc((n + 1) * sizeof(int));
+  chol->super = (int*)malloc((n + 1) * sizeof(int));
+  chol->col_super = (int*)malloc((n + 1) * sizeof(int));
+  chol->map = (int*)malloc((n + 1) * sizeof(int));
+  int* Rp = (int*)malloc((n + 1) * sizeof(int));
+  int* Rj = (int*)malloc((chol->nnz_A + 1) * sizeof(int));
+  int* parent = (int*)malloc((n + 1) * sizeof(int));
+  int* post = (int*)malloc((n + 1) * sizeof(int));
+  int* iwork = (int*)malloc((3 * n + 1) * sizeof(int));
+  bool ok = chol->perm && chol->iperm && chol->super && chol->col_super && chol->map &&
+            Rp && Rj && parent && post && iwork;
+
+  if (ok && perm) {
+    memcpy(chol->perm, perm, n * sizeof(int));
+  } else if (ok) {
+    ok = MinimumDegree(A, chol->perm);
+  }
+  if (ok) {
+    // Postorder the elimination tree of the ordering, so that the columns of each
+    // supernode are contiguous
+    for (int k = 0; k < n; ++k) {
+      chol->iperm[chol->perm[k]] = k;
+    }
+    PermutedRows(A, chol->iperm, Rp, Rj, iwork);
+    EliminationTree(n, Rp, Rj, parent, iwork);
+    Postorder(n, parent, post, iwork, iwork + n, iwork + 2 * n);
+    for (int k = 0; k < n; ++k) {
+      post[k] = chol->perm[post[k]];
+    }
+    memcpy(chol->perm, post, n * sizeof(int));
+    for (int k = 0; k < n; ++k) {
+      chol->iperm[chol->perm[k]] = k;
+    }
+    ok = Symbolic(chol, A, Rp, Rj, parent, iwork);
+  }
+
+  free(Rp);
+  free(Rj);
+  free(parent);
+  free(post);
+  free(iwork);
+  if (!ok) {
+    slap_SparseCholeskyDestroy(chol);
+    return NULL;
+  }
+  return chol;
+}
+
+void slap_SparseCholeskyDestroy(slap_SparseCholesky* chol) {
+  if (!chol) {
+    return;
+  }
+  free(chol->perm);
+  free(chol->iperm);
+  free(chol->super);
+  free(chol->col_super);
+  free(chol->rowptr);
+  free(chol->rowind);
+  free(chol->valptr);
+  free(chol->values);
+  free(chol->amap);
+  free(chol->map);
+  free(chol->work);
+  free(chol);
+}
+
+enum slap_ErrorCode slap_SparseCholeskyFactor(slap_SparseCholesky* chol, SparseMatrix A,
+                                              int* fail_col) {
+  SLAP_ASSERT(chol != NULL, SLAP_BAD_POINTER, SLAP_BAD_POINTER,
+              "SparseCholeskyFactor: factorization is NULL");
+  SLAP_ASSERT(A.colptr != NULL && !A.is_transposed && A.rows == chol->n &&
+                  A.cols == chol->n && A.colptr[A.cols] == chol->nnz_A,
+              SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS, SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              "SparseCholeskyFactor: A doesn't have the analyzed pattern");
+  const slap_Kernels* kernels = slap_GetKernels();
+  memset(chol->values, 0, chol->valptr[chol->nsuper] * sizeof(sfloat));
+  for (int p = 0; p < chol->nnz_A; ++p) {
+    if (chol->amap[p] >= 0) {
+      chol->values[chol->amap[p]] += A.values[p];
+    }
+  }
+
+  // Right-looking: factor each supernode, then subtract its contribution from the
+  // supernodes that own its off-diagonal rows
+  int fail = -1;
+  for (int s = 0; s < chol->nsuper; ++s) {
+    int nc = chol->super[s + 1] - chol->super[s];
+    int nr = chol->rowptr[s + 1] - chol->rowptr[s];
+    const int* rows = chol->rowind + chol->rowptr[s];
+    sfloat* Ls = chol->values + chol->valptr[s];
+    Matrix L11 = Block(Ls, nc, nc, nr);
+    int fail_block = -1;
+    if (slap_CholeskyInfo(L11, &fail_block) != SLAP_NO_ERROR) {
+      fail = chol->super[s] + fail_block;
+      break;
+    }
+    if (nr == nc) {
+      continue;
+    }
+    slap_LowerTransposeSolveRight(L11, Block(Ls + nc, nr - nc, nc, nr), kernels);
+
+    // Rows a:b of L21 are columns of supernode t, which gets L21[a:, :] L21[a:b, :]'
+    for (int a = nc; a < nr;) {
+      int b = TargetBlockEnd(chol, rows, nr, a);
+      int t = chol->col_super[rows[a]];
+      int m = nr - a;
+      int w = b - a;
+      slap_MatMulAdd(Block(chol->work, m, w, m), Block(Ls + a, m, nc, nr),
+                     slap_Transpose(Block(Ls + a, w, nc, nr)), 1, 0);
+      int nr_t = chol->rowptr[t + 1] - chol->rowptr[t];
+      const int* rows_t = chol->rowind + chol->rowptr[t];
+      for (int q = 0; q < nr_t; ++q) {
+        chol->map[rows_t[q]] = q;
+      }
+      sfloat* Lt = chol->values + chol->valptr[t];
+      for (int j = 0; j < w; ++j) {
+        sfloat* Ltj = Lt + (rows[a + j] - chol->super[t]) * nr_t;
+        const sfloat* Wj = chol->work + j * m;
+        for (int i = j; i < m; ++i) {
+          Ltj[chol->map[rows[a + i]]] -= Wj[i];
+        }
+      }
+      a = b;
+    }
+  }
+  if (fail_col) {
+    *fail_col = fail < 0 ? -1 : chol->perm[fail];
+  }
+  return fail < 0 ? SLAP_NO_ERROR : SLAP_CHOLESKY_FAIL;
+}
+
+enum slap_ErrorCode slap_SparseCholeskySolve(slap_SparseCholesky* chol, Matrix b) {
+  SLAP_ASSERT(chol != NULL, SLAP_BAD_POINTER, SLAP_BAD_POINTER,
+              "SparseCholeskySolve: factorization is NULL");
+  SLAP_ASSERT_VALID(b, SLAP_INVALID_MATRIX, "SparseCholeskySolve: b matrix invalid");
+  SLAP_ASSERT(slap_NumRows(b) == chol->n, SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              "SparseCholeskySolve: b has %d rows but the factor has %d", slap_NumRows(b),
+              chol->n);
+  int n = chol->n;
+  int rs_b = slap_RowStride(b);
+  int cs_b = slap_ColStride(b);
+  sfloat* x = chol->work;
+
+  for (int k = 0; k < slap_NumCols(b); ++k) {
+    sfloat* bk = b.data + k * cs_b;
+    for (int i = 0; i < n; ++i) {
+      x[i] = bk[chol->perm[i] * rs_b];
+    }
+
+    // Forward substitution with L
+    for (int s = 0; s < chol->nsuper; ++s) {
+      int f = chol->super[s];
+      int nc = chol->super[s + 1] - f;
+      int nr = chol->rowptr[s + 1] - chol->rowptr[s];
+      const int* rows = chol->rowind + chol->rowptr[s];
+      sfloat* Ls = chol->values + chol->valptr[s];
+      slap_TriSolve(Block(Ls, nc, nc, nr), Block(x + f, nc, 1, nc));
+      for (int j = 0; j < nc; ++j) {
+        const sfloat* Lj = Ls + j * nr;
+        for (int i = nc; i < nr; ++i) {
+          x[rows[i]] -= Lj[i] * x[f + j];
+        }
+      }
+    }
+
+    // Back substitution with L'
+    for (int s = chol->nsuper - 1; s >= 0; --s) {
+      int f = chol->super[s];
+      int nc = chol->super[s + 1] - f;
+      int nr = chol->rowptr[s + 1] - chol->rowptr[s];
+      const int* rows = chol->rowind + chol->rowptr[s];
+      sfloat* Ls = chol->values + chol->valptr[s];
+      for (int j = 0; j < nc; ++j) {
+        const sfloat* Lj = Ls + j * nr;
+        sfloat sum = 0;
+        for (int i = nc; i < nr; ++i) {
+          sum += Lj[i] * x[rows[i]];
+        }
+        x[f + j] -= sum;
+      }
+      slap_TriSolve(slap_Transpose(Block(Ls, nc, nc, nr)), Block(x + f, nc, 1, nc));
+    }
+
+    for (int i = 0; i < n; ++i) {
+      bk[chol->perm[i] * rs_b] = x[i];
+    }
+  }
+  return SLAP_NO_ERROR;
+}
+
+int slap_SparseCholeskyNumNonzeros(const slap_SparseCholesky* chol) { return chol->nnz_L; }
+
+int slap_SparseCholeskyNumSupernodes(const slap_SparseCholesky* chol) {
+  return chol->nsuper;
+}
+
+const int* slap_SparseCholeskyPermutation(const slap_SparseCholesky* chol) {
+  return chol->perm;
+}
@@ -0,0 +1,111 @@
+//
+// Created by Brian Jackson on 10/18/26.
+// Copyright (c) 2026 Robotic Exploration Lab. All rights reserved.
+//
+
+#pragma once
+
+#include "matrix.h"
+#include "sparse.h"
+
+/**
+ * @brief Supernodal Cholesky factorization of a sparse matrix
+ *
+ * The factorization is split into two phases:
+ *  1. slap_SparseCholeskyAnalyze() looks only at the sparsity pattern. It finds a
+ *     fill-reducing ordering, the elimination tree, and the pattern of the factor, and
+ *     groups columns of the factor with the same pattern into supernodes. All of the memory
+ *     needed by the later phases is allocated here.
+ *  2. slap_SparseCholeskyFactor() computes the factor for a matrix with the analyzed
+ *     pattern. Each supernode is stored as a dense block, so most of the work is done by
+ *     slap_Cholesky() and slap_MatMulAdd(). It doesn't allocate, and can be called any
+ *     number of times, e.g. once per iteration of Gauss-Newton.
+ *
+ * The factor is then used by slap_SparseCholeskySolve().
+ */
+typedef struct slap_SparseCholesky slap_SparseCholesky;
+
+/**
+ * @brief Symbolic analysis of a sparse symmetric matrix
+ *
+ * Only the pattern of the lower triangle of @p A is used, including the diagonal. Entries
+ * above the diagonal are ignored, so @p A can store either the lower triangle or the full
+ * symmetric matrix, as long as later calls to slap_SparseCholeskyFactor() do the same.
+ *
+ * If @p perm is NULL, the columns are reordered to reduce fill-in with a minimum degree
+ * ordering. Otherwise @p perm is used as the ordering, which is useful when the structure
+ * of the problem already gives a good one (e.g. the stages of a trajectory). Either way,
+ * the ordering is then post-ordered along the elimination tree, which keeps the columns of
+ * each supernode contiguous without changing the fill-in.
+ *
+ * **Header File:** `slap/sparse_cholesky.h`
+ * @param A A square sparse matrix, which can't be transposed
+ * @param perm Optional ordering of length n, where column `k` of the factor is column
+ *             `perm[k]` of @p A. Can be NULL.
+ * @return A new factorization, which must be freed with slap_SparseCholeskyDestroy(), or
+ *         NULL if the input is invalid or memory couldn't be allocated.
+ */
+slap_SparseCholesky* slap_SparseCholeskyAnalyze(SparseMatrix A, const int* perm);
+
+/**
+ * @brief Free a sparse Cholesky factorization
+ *
+ * **Header File:** `slap/sparse_cholesky.h`
+ * @param chol Factorization to free. Can be NULL.
+ */
+void slap_SparseCholeskyDestroy(slap_SparseCholesky* chol);
+
+/**
+ * @brief Numeric factorization of a sparse symmetric positive-definite matrix
+ *
+ * Computes \f$ P A P^T = L L^T \f$, reusing the analysis from
+ * slap_SparseCholeskyAnalyze(). @p A must have the same pattern as the analyzed matrix;
+ * only its values can change.
+ *
+ * **Header File:** `slap/sparse_cholesky.h`
+ * @param chol Analyzed factorization, which stores the factor
+ * @param A Sparse matrix with the analyzed pattern
+ * @param[out] fail_col Column of @p A, in its original ordering, where the factorization
+ *                      failed, or -1 if it succeeded. Can be NULL.
+ * @return SLAP_NO_ERROR, or SLAP_CHOLESKY_FAIL if the matrix isn't positive definite
+ */
+enum slap_ErrorCode slap_SparseCholeskyFactor(slap_SparseCholesky* chol, SparseMatrix A,
+                                              int* fail_col);
+
+/**
+ * @brief Solve \f$ A x = b \f$ using a sparse Cholesky factorization
+ *
+ * **Header File:** `slap/sparse_cholesky.h`
+ * @param chol Factorization computed by slap_SparseCholeskyFactor()
+ * @param[inout] b The right-hand side, with any number of columns. Stores the solution
+ *                 upon completion of the function.
+ * @return slap error code
+ */
+enum slap_ErrorCode slap_SparseCholeskySolve(slap_SparseCholesky* chol, Matrix b);
+
+/**
+ * @brief Number of nonzeros in the Cholesky factor, including the diagonal
+ *
+ * Depends only on the ordering and the pattern of the analyzed matrix, so it can be used
+ * to compare orderings.
+ *
+ * **Header File:** `slap/sparse_cholesky.h`
+ */
+int slap_SparseCholeskyNumNonzeros(const slap_SparseCholesky* chol);
+
+/**
+ * @brief Number of supernodes in the Cholesky factor
+ *
+ * **Header File:** `slap/sparse_cholesky.h`
+ */
+int slap_SparseCholeskyNumSupernodes(const slap_SparseCholesky* chol);
+
+/**
+ * @brief Ordering used by the factorization
+ *
+ * Column `k` of the factor is column `perm[k]` of the original matrix.
+ *
+ * **Header File:** `slap/sparse_cholesky.h`
+ * @return Array of length n, owned by @p chol
+ */
+const int* slap_SparseCholeskyPermutation(const slap_SparseCholesky* chol);
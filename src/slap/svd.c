@@ -0,0 +1,223 @@
+//
+// Created by Brian Jackson on 10/18/26.
+// Copyright (c) 2026 Robotic Exploration Lab. All rights reserved.
+//
+
+#include "svd.h"
+
+#include <float.h>
+#include <math.h>
+
+#include "arena.h"
+#include "copy_matrix.h"
+#include "kernels.h"
+#include "matmul.h"
+#include "unary_ops.h"
+
+#define EPS (sizeof(sfloat) == sizeof(float) ? FLT_EPSILON : DBL_EPSILON)
+
+static inline bool IsNull(Matrix A) { return A.data == NULL; }
+
+static void SwapColumns(int n, sfloat* x, sfloat* y) {
+  for (int i = 0; i < n; ++i) {
+    sfloat tmp = x[i];
+    x[i] = y[i];
+    y[i] = tmp;
+  }
+}
+
+// One-sided Jacobi on the k columns of the m x k matrix G, with column stride ldg. The
+// rotations are accumulated into the columns of the k x k matrix W, if it isn't NULL.
+// Stores the squared norms of the columns of G in norms.
+static enum slap_ErrorCode JacobiSweeps(int m, int k, sfloat* G, int ldg, sfloat* W,
+                                        int ldw, sfloat tol, sfloat* norms) {
+  const slap_Kernels* kernels = slap_GetKernels();
+  sfloat negligible = 0;
+  for (int sweep = 0; sweep < SLAP_SVD_MAX_SWEEPS; ++sweep) {
+    // Refresh the norms, which are only updated approximately by the rotations
+    for (int j = 0; j < k; ++j) {
+      norms[j] = kernels->dot(m, G + j * ldg, G + j * ldg);
+    }
+
+    // Columns that are zero to within rounding error (e.g. from a rank-deficient matrix)
+    // can't be made orthogonal to the others to a relative tolerance, so they're skipped.
+    // The rotations don't change the Frobenius norm.
+    if (sweep == 0) {
+      for (int j = 0; j < k; ++j) {
+        negligible += norms[j];
+      }
+      negligible *= tol * tol;
+    }
+    bool rotated = false;
+    for (int p = 0; p < k - 1; ++p) {
+      sfloat* Gp = G + p * ldg;
+      for (int q = p + 1; q < k; ++q) {
+        sfloat* Gq = G + q * ldg;
+        sfloat alpha = norms[p];
+        sfloat beta = norms[q];
+        if (alpha <= negligible || beta <= negligible) {
+          continue;
+        }
+        sfloat gamma = kernels->dot(m, Gp, Gq);
+        if (fabs(gamma) <= tol * sqrt(alpha) * sqrt(beta)) {
+          continue;
+        }
+        rotated = true;
+
+        // Rotation that makes columns p and q orthogonal, using the smaller root of
+        // t^2 + 2 zeta t - 1 = 0
+        sfloat zeta = (beta - alpha) / (2 * gamma);
+        sfloat root = fabs(zeta) > 1 / EPS ? fabs(zeta) : sqrt(1 + zeta * zeta);
+        sfloat t = (zeta >= 0 ? 1 : -1) / (fabs(zeta) + root);
+        sfloat c = 1 / sqrt(1 + t * t);
+        sfloat s = c * t;
+        kernels->rot(m, c, -s, Gp, Gq);
+        if (W) {
+          kernels->rot(k, c, -s, W + p * ldw, W + q * ldw);
+        }
+        norms[p] = alpha - t * gamma;
+        norms[q] = beta + t * gamma;
+      }
+    }
+    if (!rotated) {
+      return SLAP_NO_ERROR;
+    }
+  }
+  return SLAP_ERROR(SLAP_NOT_CONVERGED, "SVD: Jacobi didn't converge in %d sweeps",
+                    SLAP_SVD_MAX_SWEEPS);
+}
+
+enum slap_ErrorCode slap_SVD(Matrix A, Matrix s, Matrix U, Matrix V, sfloat tol,
+                             Matrix work) {
+  SLAP_ASSERT_VALID(A, SLAP_INVALID_MATRIX, "SVD: A matrix invalid");
+  SLAP_ASSERT(A.mattype == slap_DENSE, SLAP_MATRIX_NOT_DENSE, SLAP_MATRIX_NOT_DENSE,
+              "SVD: A must be a dense or strided matrix");
+  int m = slap_NumRows(A);
+  int n = slap_NumCols(A);
+  int k = m < n ? m : n;
+  SLAP_ASSERT_DENSE(s, SLAP_MATRIX_NOT_DENSE, "SVD: s must be a dense vector");
+  SLAP_ASSERT(slap_NumElements(s) == k, SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS, "SVD: s must have length %d", k);
+  SLAP_ASSERT(IsNull(U) || (slap_NumRows(U) == m && slap_NumCols(U) == k),
+              SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS, SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              "SVD: U must be %d x %d", m, k);
+  SLAP_ASSERT(IsNull(V) || (slap_NumRows(V) == n && slap_NumCols(V) == k),
+              SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS, SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              "SVD: V must be %d x %d", n, k);
+
+  // Work on the columns of the taller of A and A'. If G = W S Y', the rotations are
+  // accumulated into the k x k factor W, and the other factor comes from normalizing the
+  // columns of G.
+  bool wide = m < n;
+  Matrix G = wide ? slap_Transpose(A) : A;
+  Matrix W = wide ? U : V;
+  Matrix Y = wide ? V : U;
+  int mg = wide ? n : m;
+  SLAP_ASSERT(IsNull(W) || (W.mattype == slap_DENSE && !slap_IsTransposed(W)),
+              SLAP_INVALID_MATRIX, SLAP_INVALID_MATRIX,
+              "SVD: the square factor (%s) can't be transposed", wide ? "U" : "V");
+  SLAP_ASSERT_DENSE(work, SLAP_MATRIX_NOT_DENSE, "SVD: work must be dense");
+  SLAP_ASSERT(slap_NumElements(work) >= k + (slap_IsTransposed(G) ? m * n : 0),
+              SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS, SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              "SVD: work must have at least %d elements",
+              k + (slap_IsTransposed(G) ? m * n : 0));
+  if (k == 0) {
+    return SLAP_NO_ERROR;
+  }
+  if (tol <= 0) {
+    tol = mg * EPS;
+  }
+
+  // The rotations need contiguous columns
+  sfloat* norms = work.data;
+  if (slap_IsTransposed(G)) {
+    Matrix Gc = slap_MatrixFromArray(mg, k, work.data + k);
+    slap_Copy(Gc, G);
+    G = Gc;
+  }
+  sfloat* w = NULL;
+  if (!IsNull(W)) {
+    slap_SetIdentity(W, 1);
+    w = W.data;
+  }
+  enum slap_ErrorCode err = JacobiSweeps(mg, k, G.data, G.sy, w, W.sy, tol, norms);
+
+  // Sort the singular values in descending order, along with the columns of G and W
+  sfloat* sv = s.data;
+  for (int j = 0; j < k; ++j) {
+    sv[j] = sqrt(norms[j] > 0 ? norms[j] : 0);
+  }
+  for (int i = 0; i < k - 1; ++i) {
+    int imax = i;
+    for (int j = i + 1; j < k; ++j) {
+      if (sv[j] > sv[imax]) {
+        imax = j;
+      }
+    }
+    if (imax == i) {
+      continue;
+    }
+    sfloat tmp = sv[i];
+    sv[i] = sv[imax];
+    sv[imax] = tmp;
+    SwapColumns(mg, G.data + i * G.sy, G.data + imax * G.sy);
+    if (w) {
+      SwapColumns(k, w + i * W.sy, w + imax * W.sy);
+    }
+  }
+
+  if (!IsNull(Y)) {
+    for (int j = 0; j < k; ++j) {
+      sfloat scale = sv[j] > 0 ? 1 / sv[j] : 0;
+      sfloat* Gj = G.data + j * G.sy;
+      for (int i = 0; i < mg; ++i) {
+        Gj[i] *= scale;
+      }
+    }
+    slap_Copy(Y, G);
+  }
+  return err;
+}
+
+size_t slap_SVDWorkspaceSize(int m, int n) {
+  int k = m < n ? m : n;
+  return slap_ArenaMatrixSize(k + (m < n ? m * n : 0), 1);
+}
+
+enum slap_ErrorCode slap_SVDSolve(Matrix x, Matrix U, Matrix s, Matrix V, Matrix b,
+                                  sfloat damping, sfloat rcond, Matrix temp) {
+  SLAP_ASSERT_VALID(U, SLAP_INVALID_MATRIX, "SVDSolve: U matrix invalid");
+  SLAP_ASSERT_VALID(V, SLAP_INVALID_MATRIX, "SVDSolve: V matrix invalid");
+  int m = slap_NumRows(U);
+  int n = slap_NumRows(V);
+  int k = slap_NumCols(U);
+  int p = slap_NumCols(b);
+  SLAP_ASSERT(slap_NumCols(V) == k, SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS, "SVDSolve: V must have %d columns", k);
+  SLAP_ASSERT_DENSE(s, SLAP_MATRIX_NOT_DENSE, "SVDSolve: s must be a dense vector");
+  SLAP_ASSERT(slap_NumElements(s) == k, SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS, "SVDSolve: s must have length %d", k);
+  SLAP_ASSERT(slap_NumRows(b) == m && slap_NumRows(x) == n && slap_NumCols(x) == p,
+              SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS, SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              "SVDSolve: x must be %d x %d and b must have %d rows", n, p, m);
+  SLAP_ASSERT(slap_NumRows(temp) == k && slap_NumCols(temp) == p,
+              SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS, SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
+              "SVDSolve: temp must be %d x %d", k, p);
+
+  // x = V * diag(s / (s^2 + damping^2)) * U' b
+  slap_MatMulAdd(temp, slap_Transpose(U), b, 1, 0);
+  sfloat lambda2 = damping * damping;
+  if (rcond <= 0) {
+    rcond = (m > n ? m : n) * EPS;
+  }
+  sfloat cutoff = k > 0 ? rcond * s.data[0] : 0;
+  for (int i = 0; i < k; ++i) {
+    sfloat si = s.data[i];
+    sfloat scale = si > cutoff ? si / (si * si + lambda2) : 0;
+    for (int j = 0; j < p; ++j) {
+      *slap_GetElement(temp, i, j) *= scale;
+    }
+  }
+  slap_MatMulAdd(x, V, temp, 1, 0);
+  return SLAP_NO_ERROR;
+}
@@ -0,0 +1,94 @@
+//
+// Created by Brian Jackson on 10/18/26.
+// Copyright (c) 2026 Robotic Exploration Lab. All rights reserved.
+//
+
+#pragma once
+
+#include <stddef.h>
+
+#include "matrix.h"
+
+// Maximum number of sweeps over all pairs of columns before slap_SVD() gives up
+#ifndef SLAP_SVD_MAX_SWEEPS
+#define SLAP_SVD_MAX_SWEEPS 30
+#endif
+
+/**
+ * @brief Economy-size singular value decomposition
+ *
+ * Computes \f$ A = U \Sigma V^T \f$ for an m x n matrix, where \f$ k = \min(m, n) \f$,
+ * \f$ U \f$ is m x k, \f$ V \f$ is n x k, both with orthonormal columns, and
+ * \f$ \Sigma \f$ is diagonal.
+ *
+ * Uses the one-sided Jacobi method, which is accurate and fast for small matrices like
+ * the Jacobian of a manipulator. Plane rotations are applied to pairs of columns of the
+ * taller of \f$ A \f$ and \f$ A^T \f$ until all of its columns are orthogonal, and
+ * accumulated into the k x k factor. The inner loops run on contiguous columns with the
+ * `rot` and `dot` kernels from slap_GetKernels(). Two columns are treated as orthogonal
+ * once \f$ |a_p^T a_q| \leq \text{tol} \, \|a_p\| \|a_q\| \f$, and columns with a norm
+ * below \f$ \text{tol} \, \|A\|_F \f$ are treated as zero.
+ *
+ * If @p A is tall (or is a transposed wide matrix), the rotations are applied to its
+ * columns in place. Otherwise its transpose is copied into @p work first.
+ *
+ * Nothing is allocated, so this can be called inside a real-time loop with a workspace
+ * created up front, e.g. from an arena with slap_SVDWorkspaceSize() bytes.
+ *
+ * See also: slap_SVDSolve()
+ *
+ * **Header File:** `slap/svd.h`
+ * @param[inout] A An m x n matrix. Overwritten.
+ * @param[out] s Dense vector of length k. Stores the singular values in descending order,
+ *               so the 2-norm condition number of @p A is `s[0] / s[k-1]`.
+ * @param[out] U m x k matrix of left singular vectors, or a null matrix to skip them. Can
+ *               be @p A itself when @p A is tall. Columns for zero singular values are
+ *               set to zero.
+ * @param[out] V n x k matrix of right singular vectors, or a null matrix to skip them.
+ *               Columns for zero singular values are set to zero if @p A is wide.
+ * @param tol Relative orthogonality tolerance for stopping early. Values `<= 0` use
+ *            `max(m, n)` times the machine epsilon.
+ * @param work A dense workspace with at least `k` elements, plus `m * n` if @p A is wide
+ *             and not transposed, or tall and transposed.
+ * @return SLAP_NO_ERROR, or SLAP_NOT_CONVERGED if the columns weren't orthogonal after
+ *         `SLAP_SVD_MAX_SWEEPS` sweeps.
+ */
+enum slap_ErrorCode slap_SVD(Matrix A, Matrix s, Matrix U, Matrix V, sfloat tol,
+                             Matrix work);
+
+/**
+ * @brief Arena bytes needed for the workspace of slap_SVD()
+ *
+ * Covers the @p work vector, allocated with slap_ArenaNewMatrix(), for an m x n matrix
+ * that isn't transposed.
+ *
+ * **Header File:** `slap/svd.h`
+ * @param m Number of rows in the matrix
+ * @param n Number of columns in the matrix
+ */
+size_t slap_SVDWorkspaceSize(int m, int n);
+
+/**
+ * @brief Damped least-squares solve using a singular value decomposition
+ *
+ * Computes
+ * \f[ x = V (\Sigma^2 + \lambda^2 I)^{-1} \Sigma U^T b \f]
+ * which minimizes \f$ \|A x - b\|^2 + \lambda^2 \|x\|^2 \f$. With \f$ \lambda = 0 \f$
+ * this is the pseudoinverse solution \f$ x = A^+ b \f$. Singular values no larger than
+ * `rcond * s[0]` are treated as zero, so that rounding errors in the singular values of a
+ * rank-deficient matrix aren't amplified.
+ *
+ * **Header File:** `slap/svd.h`
+ * @param[out] x n x p solution
+ * @param U Left singular vectors from slap_SVD()
+ * @param s Singular values from slap_SVD()
+ * @param V Right singular vectors from slap_SVD()
+ * @param b m x p right-hand side
+ * @param damping Damping factor \f$ \lambda \f$
+ * @param rcond Relative cutoff for small singular values. Values `<= 0` use `max(m, n)`
+ *              times the machine epsilon.
+ * @param temp Workspace of size k x p. Can't share data with @p x or @p b.
+ * @return slap error code
+ */
+enum slap_ErrorCode slap_SVDSolve(Matrix x, Matrix U, Matrix s, Matrix V, Matrix b,
+                                  sfloat damping, sfloat rcond, Matrix temp);
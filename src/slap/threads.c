@@ -0,0 +1,210 @@
+//
+// Created by Brian Jackson on 10/18/26.
+// Copyright (c) 2026 Robotic Exploration Lab. All rights reserved.
+//
+
+#if defined(SLAP_HAS_PTHREADS) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L  // sysconf
+#endif
+
+#include "threads.h"
+
+#include <stdlib.h>
+
+#include "kernels.h"
+
+#ifdef SLAP_HAS_PTHREADS
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#ifdef SLAP_HAS_PTHREADS
+
+typedef struct {
+  slap_ThreadPool* pool;
+  int id;
+} Worker;
+
+struct slap_ThreadPool {
+  int num_threads;
+  pthread_t* threads;  // num_threads - 1 workers
+  Worker* workers;
+  pthread_mutex_t mutex;
+  pthread_cond_t start;  // signalled when a new job is submitted
+  pthread_cond_t done;   // signalled when the last worker finishes a job
+
+  // Current job, protected by the mutex
+  unsigned long generation;
+  int pending;
+  bool shutdown;
+  slap_TaskFunction task;
+  void* context;
+  int num_tasks;
+};
+
+#else
+
+struct slap_ThreadPool {
+  int num_threads;
+};
+
+#endif
+
+// Run the tasks statically assigned to thread `id`
+static void RunTasks(slap_TaskFunction task, void* context, int num_tasks, int id,
+                     int num_threads) {
+  for (int t = id; t < num_tasks; t += num_threads) {
+    task(context, t);
+  }
+}
+
+#ifdef SLAP_HAS_PTHREADS
+
+static void* WorkerMain(void* arg) {
+  Worker* worker = (Worker*)arg;
+  slap_ThreadPool* pool = worker->pool;
+  unsigned long generation = 0;
+  pthread_mutex_lock(&pool->mutex);
+  for (;;) {
+    while (pool->generation == generation && !pool->shutdown) {
+      pthread_cond_wait(&pool->start, &pool->mutex);
+    }
+    if (pool->shutdown) {
+      break;
+    }
+    generation = pool->generation;
+    slap_TaskFunction task = pool->task;
+    void* context = pool->context;
+    int num_tasks = pool->num_tasks;
+    pthread_mutex_unlock(&pool->mutex);
+
+    RunTasks(task, context, num_tasks, worker->id, pool->num_threads);
+
+    pthread_mutex_lock(&pool->mutex);
+    if (--pool->pending == 0) {
+      pthread_cond_signal(&pool->done);
+    }
+  }
+  pthread_mutex_unlock(&pool->mutex);
+  return NULL;
+}
+
+static int NumProcessors(void) {
+  long n = sysconf(_SC_NPROCESSORS_ONLN);
+  return n > 0 ? (int)n : 1;
+}
+
+slap_ThreadPool* slap_ThreadPoolCreate(int num_threads) {
+  if (num_threads <= 0) {
+    num_threads = NumProcessors();
+  }
+
+  // Select the kernels now, instead of racing to do it from the workers
+  slap_GetKernels();
+
+  slap_ThreadPool* pool = (slap_ThreadPool*)calloc(1, sizeof(slap_ThreadPool));
+  if (!pool) {
+    return NULL;
+  }
+  pool->num_threads = num_threads;
+  int num_workers = num_threads - 1;
+  if (num_workers > 0) {
+    pool->threads = (pthread_t*)malloc(num_workers * sizeof(pthread_t));
+    pool->workers = (Worker*)malloc(num_workers * sizeof(Worker));
+    if (!pool->threads || !pool->workers) {
+      free(pool->threads);
+      free(pool->workers);
+      free(pool);
+      return NULL;
+    }
+  }
+  pthread_mutex_init(&pool->mutex, NULL);
+  pthread_cond_init(&pool->start, NULL);
+  pthread_cond_init(&pool->done, NULL);
+
+  for (int i = 0; i < num_workers; ++i) {
+    pool->workers[i].pool = pool;
+    pool->workers[i].id = i + 1;  // the calling thread is 0
+    if (pthread_create(&pool->threads[i], NULL, WorkerMain, &pool->workers[i]) != 0) {
+      // Run with the threads that did start
+      pool->num_threads = i + 1;
+      break;
+    }
+  }
+  return pool;
+}
+
+void slap_ThreadPoolDestroy(slap_ThreadPool* pool) {
+  if (!pool) {
+    return;
+  }
+  pthread_mutex_lock(&pool->mutex);
+  pool->shutdown = true;
+  pthread_cond_broadcast(&pool->start);
+  pthread_mutex_unlock(&pool->mutex);
+  for (int i = 0; i < pool->num_threads - 1; ++i) {
+    pthread_join(pool->threads[i], NULL);
+  }
+  pthread_mutex_destroy(&pool->mutex);
+  pthread_cond_destroy(&pool->start);
+  pthread_cond_destroy(&pool->done);
+  free(pool->threads);
+  free(pool->workers);
+  free(pool);
+}
+
+enum slap_ErrorCode slap_ThreadPoolRun(slap_ThreadPool* pool, int num_tasks,
+                                       slap_TaskFunction task, void* context) {
+  SLAP_ASSERT(task != NULL, SLAP_BAD_POINTER, SLAP_BAD_POINTER,
+              "ThreadPoolRun: task function is NULL");
+  if (!pool || pool->num_threads == 1 || num_tasks <= 1) {
+    RunTasks(task, context, num_tasks, 0, 1);
+    return SLAP_NO_ERROR;
+  }
+
+  pthread_mutex_lock(&pool->mutex);
+  pool->task = task;
+  pool->context = context;
+  pool->num_tasks = num_tasks;
+  pool->pending = pool->num_threads - 1;
+  ++pool->generation;
+  pthread_cond_broadcast(&pool->start);
+  pthread_mutex_unlock(&pool->mutex);
+
+  RunTasks(task, context, num_tasks, 0, pool->num_threads);
+
+  pthread_mutex_lock(&pool->mutex);
+  while (pool->pending > 0) {
+    pthread_cond_wait(&pool->done, &pool->mutex);
+  }
+  pthread_mutex_unlock(&pool->mutex);
+  return SLAP_NO_ERROR;
+}
+
+#else
+
+slap_ThreadPool* slap_ThreadPoolCreate(int num_threads) {
+  (void)num_threads;
+  slap_ThreadPool* pool = (slap_ThreadPool*)malloc(sizeof(slap_ThreadPool));
+  if (pool) {
+    pool->num_threads = 1;
+  }
+  return pool;
+}
+
+void slap_ThreadPoolDestroy(slap_ThreadPool* pool) { free(pool); }
+
+enum slap_ErrorCode slap_ThreadPoolRun(slap_ThreadPool* pool, int num_tasks,
+                                       slap_TaskFunction task, void* context) {
+  (void)pool;
+  SLAP_ASSERT(task != NULL, SLAP_BAD_POINTER, SLAP_BAD_POINTER,
+              "ThreadPoolRun: task function is NULL");
+  RunTasks(task, context, num_tasks, 0, 1);
+  return SLAP_NO_ERROR;
+}
+
+#endif
+
+int slap_ThreadPoolNumThreads(const slap_ThreadPool* pool) {
+  return pool ? pool->num_threads : 1;
+}
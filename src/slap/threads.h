@@ -0,0 +1,87 @@
+//
+// Created by Brian Jackson on 10/18/26.
+// Copyright (c) 2026 Robotic Exploration Lab. All rights reserved.
+//
+
+#pragma once
+
+#include "matrix.h"
+
+// Steps of a computation with fewer multiply-adds than this are run on the calling
+// thread, since waking up the pool costs more than it saves
+#ifndef SLAP_PARALLEL_THRESHOLD
+#define SLAP_PARALLEL_THRESHOLD 65536
+#endif
+
+/**
+ * @brief A persistent pool of worker threads
+ *
+ * The workers are started once by slap_ThreadPoolCreate() and sleep until work is
+ * submitted, so the `*Parallel` methods never create threads.
+ *
+ * Work is split into tasks that are statically assigned to threads, and every task
+ * writes to its own part of the output, so the results are deterministic: they don't
+ * depend on scheduling or on the number of threads.
+ *
+ * Threads are only available when slap is built with the `SLAP_THREADS` CMake option on
+ * a platform with POSIX threads. Otherwise the pool has a single thread, and everything
+ * runs on the calling thread.
+ *
+ * A pool must not be used from more than one thread at a time, and a task must not submit
+ * more work to the pool that is running it.
+ */
+typedef struct slap_ThreadPool slap_ThreadPool;
+
+/**
+ * @brief Function run for each task
+ *
+ * @param context User data passed to slap_ThreadPoolRun()
+ * @param task Index of the task, from 0 to `num_tasks - 1`
+ */
+typedef void (*slap_TaskFunction)(void* context, int task);
+
+/**
+ * @brief Start a new thread pool
+ *
+ * Allocates memory and starts `num_threads - 1` worker threads, since the thread calling
+ * slap_ThreadPoolRun() also does work. Must be freed with slap_ThreadPoolDestroy().
+ *
+ * **Header File:** `slap/threads.h`
+ * @param num_threads Total number of threads, including the caller. If zero or negative,
+ *                    uses the number of processors.
+ * @return The new pool, or NULL if it couldn't be created
+ */
+slap_ThreadPool* slap_ThreadPoolCreate(int num_threads);
+
+/**
+ * @brief Stop the worker threads and free the pool
+ *
+ * **Header File:** `slap/threads.h`
+ * @param pool Pool to destroy. Can be NULL.
+ */
+void slap_ThreadPoolDestroy(slap_ThreadPool* pool);
+
+/**
+ * @brief Number of threads in the pool, including the calling thread
+ *
+ * Returns 1 for a NULL pool.
+ *
+ * **Header File:** `slap/threads.h`
+ */
+int slap_ThreadPoolNumThreads(const slap_ThreadPool* pool);
+
+/**
+ * @brief Run tasks on the pool and wait for all of them to finish
+ *
+ * Task `t` always runs on thread `t % num_threads`. With a NULL pool, all of the tasks
+ * are run on the calling thread.
+ *
+ * **Header File:** `slap/threads.h`
+ * @param pool Pool to run the tasks on. Can be NULL.
+ * @param num_tasks Number of tasks
+ * @param task Function to call for each task
+ * @param context Passed to each call of @p task
+ * @return slap error code
+ */
+enum slap_ErrorCode slap_ThreadPoolRun(slap_ThreadPool* pool, int num_tasks,
+                                       slap_TaskFunction task, void* context);
@@ -7,6 +7,12 @@
 
 #include <math.h>
 
+#include "band.h"
+#include "diagonal.h"
+#include "fixed_size.h"
+#include "kernels.h"
+#include "packed.h"
+
 enum slap_ErrorCode slap_UpperTriMulAdd(Matrix C, const Matrix U, const Matrix B,
                                         double alpha, double beta) {
   SLAP_ASSERT_VALID(C, SLAP_INVALID_MATRIX, "Error in UpperTriMulAdd: Invalid C matrix");
@@ -148,28 +154,62 @@ enum slap_ErrorCode slap_MakeLowerTri(Matrix A) {
 }
 
 enum slap_ErrorCode slap_TriSolve(Matrix L, Matrix b) {
+  if (slap_GetType(L) == slap_BANDED) {
+    return slap_BandTriSolve(L, b);
+  }
+  if (slap_GetType(L) == slap_DIAGONAL) {
+    return slap_DiagonalTriSolve(L, b);
+  }
+  if (slap_IsPacked(L)) {
+    return slap_PackedTriSolve(L, b);
+  }
   SLAP_ASSERT_VALID(L, SLAP_INVALID_MATRIX, "LowerTriBackSub: L matrix invalid");
   SLAP_ASSERT_VALID(b, SLAP_INVALID_MATRIX, "LowerTriBackSub: b matrix invalid");
   SLAP_ASSERT(slap_NumCols(L) == slap_NumRows(b), SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
               SLAP_INCOMPATIBLE_MATRIX_DIMENSIONS,
               "LowerTriBackSub: L has %d columns but b has %d rows", slap_NumCols(L),
               slap_NumRows(b));
-  int n = b.rows;
-  int m = b.cols;
-  bool tL = L.mattype == slap_TRIANGULAR_UPPER || slap_IsTransposed(L);
+  if (slap_TriSolveFixedSize(L, b)) {
+    return SLAP_NO_ERROR;
+  }
+  int n = slap_NumRows(b);
+  int m = slap_NumCols(b);
+
+  bool upper = L.mattype == slap_TRIANGULAR_UPPER || slap_IsTransposed(L);
+  int rs_L = slap_RowStride(L);
+  int cs_L = slap_ColStride(L);
+  int rs_b = slap_RowStride(b);
+  int cs_b = slap_ColStride(b);
+  const slap_Kernels* kernels = slap_GetKernels();
 
-  for (int j_ = 0; j_ < n; ++j_) {
-    int j = tL ? n - j_ - 1 : j_;
-    for (int k = 0; k < m; ++k) {
-      sfloat* xjk = slap_GetElement(b, j, k);
-      sfloat Ljj = *slap_GetElement(L, j, j);
-      *xjk /= Ljj;
+  // If the rows of L are contiguous (e.g. the transposed factor in slap_CholeskySolve()),
+  // compute each x[j] with a dot product against the entries already solved.
+  // Otherwise eliminate x[j] from the remaining entries by walking down column j of L.
+  bool row_oriented = cs_L == 1 && rs_L != 1 && rs_b == 1;
 
-      for (int i_ = j_ + 1; i_ < n; ++i_) {
-        int i = tL ? i_ - (j_ + 1) : i_;
-        sfloat* xik = slap_GetElement(b, i, k);
-        sfloat Lij = *slap_GetElement(L, i, j);
-        *xik -= Lij * (*xjk);
+  for (int k = 0; k < m; ++k) {
+    sfloat* x = b.data + k * cs_b;
+    for (int j_ = 0; j_ < n; ++j_) {
+      int j = upper ? n - j_ - 1 : j_;
+      sfloat Ljj = L.data[j * rs_L + j * cs_L];
+      if (row_oriented) {
+        int start = upper ? j + 1 : 0;
+        int len = upper ? n - j - 1 : j;
+        const sfloat* Lrow = L.data + j * rs_L + start;
+        x[j] = (x[j] - kernels->dot(len, Lrow, x + start)) / Ljj;
+      } else {
+        int start = upper ? 0 : j + 1;
+        int len = upper ? j : n - j - 1;
+        const sfloat* Lcol = L.data + j * cs_L + start * rs_L;
+        x[j * rs_b] /= Ljj;
+        sfloat xj = x[j * rs_b];
+        if (rs_L == 1 && rs_b == 1) {
+          kernels->axpy(len, -xj, Lcol, x + start);
+        } else {
+          for (int i = 0; i < len; ++i) {
+            x[(start + i) * rs_b] -= Lcol[i * rs_L] * xj;
+          }
+        }
       }
     }
   }
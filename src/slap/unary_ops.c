@@ -5,21 +5,48 @@
 
 #include "unary_ops.h"
 
+#include "band.h"
 #include "iterator.h"
 #include "matrix_checks.h"
+#include "packed.h"
+
+// Pointer to diagonal element (k,k), for any type of matrix
+static sfloat* DiagonalElement(Matrix mat, int k) {
+  switch (slap_GetType(mat)) {
+    case slap_DIAGONAL:
+      return mat.data + k;
+    case slap_BANDED:
+      return slap_BandElement(mat, k, k);
+    case slap_PACKED:
+    case slap_PACKED_LOWER:
+      return slap_PackedElement(mat, k, k);
+    default:
+      return slap_GetElement(mat, k, k);
+  }
+}
 
 enum slap_ErrorCode slap_SetConst(Matrix mat, sfloat val) {
   SLAP_ASSERT_VALID(mat, SLAP_INVALID_MATRIX, "SetConst: invalid matrix");
-  for (MatrixIterator it = slap_Iterator(mat); !slap_IsFinished(&it); slap_Step(&it)) {
-    mat.data[it.index] = val;
+  int rows = slap_StoredRows(mat);
+  int cols = slap_StoredCols(mat);
+  for (int j = 0; j < cols; ++j) {
+    sfloat* col = mat.data + j * mat.sy;
+    for (int i = 0; i < rows; ++i) {
+      col[i] = val;
+    }
   }
   return SLAP_NO_ERROR;
 }
 
 enum slap_ErrorCode slap_ScaleByConst(Matrix mat, sfloat alpha) {
   SLAP_ASSERT_VALID(mat, SLAP_INVALID_MATRIX, "ScaleByConst: invalid matrix");
-  for (MatrixIterator it = slap_Iterator(mat); !slap_IsFinished(&it); slap_Step(&it)) {
-    mat.data[it.index] *= alpha;
+  int rows = slap_StoredRows(mat);
+  int cols = slap_StoredCols(mat);
+  for (int j = 0; j < cols; ++j) {
+    sfloat* col = mat.data + j * mat.sy;
+    for (int i = 0; i < rows; ++i) {
+      col[i] *= alpha;
+    }
   }
   return 0;
 }
@@ -28,7 +55,7 @@ enum slap_ErrorCode slap_SetIdentity(Matrix mat, sfloat val) {
   SLAP_ASSERT_VALID(mat, SLAP_INVALID_MATRIX, "SetIdentity: invalid matrix");
   slap_SetConst(mat, 0.0);
   for (int k = 0; k < slap_MinDim(mat); ++k) {
-    slap_SetElement(mat, k, k, val);
+    *DiagonalElement(mat, k) = val;
   }
   return 0;
 }
@@ -40,7 +67,7 @@ enum slap_ErrorCode slap_SetDiagonal(Matrix mat, const sfloat* diag, int len) {
   int n = slap_MinDim(mat);
   n = n <= len ? n : len;
   for (int k = 0; k < n; ++k) {
-    slap_SetElement(mat, k, k, diag[k]);
+    *DiagonalElement(mat, k) = diag[k];
   }
   return SLAP_NO_ERROR;
 }
@@ -49,14 +76,15 @@ enum slap_ErrorCode slap_AddIdentity(Matrix mat, sfloat alpha) {
   SLAP_ASSERT_VALID(mat, SLAP_INVALID_MATRIX, "AddIdentity: invalid matrix");
   int n = slap_MinDim(mat);
   for (int i = 0; i < n; ++i) {
-    sfloat diag = *slap_GetElement(mat, i, i);
-    slap_SetElement(mat, i, i, diag + alpha);
+    *DiagonalElement(mat, i) += alpha;
   }
   return SLAP_NO_ERROR;
 }
 
 
 enum slap_ErrorCode slap_SetRange(Matrix mat, sfloat start, sfloat stop) {
+  SLAP_ASSERT(!slap_IsStructured(mat), SLAP_INVALID_MATRIX, SLAP_INVALID_MATRIX,
+              "SetRange: band, diagonal and packed matrices aren't supported");
   SLAP_CHECK_MATRIX(mat);
   sfloat range = stop - start;
   int num_el = slap_NumElements(mat) - 1;
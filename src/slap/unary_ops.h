@@ -17,6 +17,8 @@
 /**
  * @brief Sets all of the elements in a matrix to a single value
  *
+ * For band, diagonal and packed matrices, only the stored elements are set.
+ *
  * **Header File:** `"slap/unary_ops.h"`
  * @param mat Matrix to be modified
  * @param val Value to which each element will be set
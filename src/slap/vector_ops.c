@@ -11,6 +11,8 @@
 
 MatrixIterator slap_ArgMax(Matrix mat, sfloat* max_value) {
   MatrixIterator max_index = slap_Iterator(mat);
+  SLAP_ASSERT(!slap_IsStructured(mat), SLAP_INVALID_MATRIX, max_index,
+              "ArgMax: band, diagonal and packed matrices aren't supported");
   sfloat value = -INFINITY;
   sfloat value_i;
   for (MatrixIterator it = slap_Iterator(mat); !slap_IsFinished(&it); slap_Step(&it)) {
@@ -32,6 +34,8 @@ sfloat slap_Max(Matrix mat) {
 
 MatrixIterator slap_ArgMin(Matrix mat, sfloat* min_value) {
   MatrixIterator min_index = slap_Iterator(mat);
+  SLAP_ASSERT(!slap_IsStructured(mat), SLAP_INVALID_MATRIX, min_index,
+              "ArgMin: band, diagonal and packed matrices aren't supported");
   sfloat value = +INFINITY;
   sfloat value_i;
   for (MatrixIterator it = slap_Iterator(mat); !slap_IsFinished(&it); slap_Step(&it)) {
@@ -52,48 +56,72 @@ sfloat slap_Min(Matrix mat) {
 }
 
 sfloat slap_NormTwoSquared(Matrix mat) {
-  SLAP_ASSERT_DENSE(mat, NAN, "NormTwoSquared must be called on a dense matrix");
+  SLAP_ASSERT_VALID(mat, NAN, "NormTwoSquared: invalid matrix");
+  SLAP_ASSERT(!slap_IsStructured(mat) || slap_GetType(mat) == slap_DIAGONAL,
+              SLAP_INVALID_MATRIX, NAN,
+              "NormTwoSquared: band and packed matrices aren't supported");
   sfloat value = 0;
-  sfloat value_i;
-  for (int i = 0; i < slap_NumElements(mat); ++i) {
-    value_i = mat.data[i];
-    value += value_i * value_i;
+  int rows = slap_StoredRows(mat);
+  for (int j = 0; j < mat.cols; ++j) {
+    const sfloat* col = mat.data + j * mat.sy;
+    for (int i = 0; i < rows; ++i) {
+      value += col[i] * col[i];
+    }
   }
   return value;
 }
 
 sfloat slap_NormTwo(Matrix mat) {
-  SLAP_ASSERT_DENSE(mat, NAN, "NormTwo must be called on a dense matrix");
+  SLAP_ASSERT_VALID(mat, NAN, "NormTwo: invalid matrix");
   sfloat norm_squared = slap_NormTwoSquared(mat);
   return sqrt(norm_squared);
 }
 
 sfloat slap_NormInf(Matrix mat) {
-  SLAP_ASSERT_DENSE(mat, NAN, "NormInf must be called on a dense matrix");
+  SLAP_ASSERT_VALID(mat, NAN, "NormInf: invalid matrix");
+  SLAP_ASSERT(!slap_IsStructured(mat) || slap_GetType(mat) == slap_DIAGONAL,
+              SLAP_INVALID_MATRIX, NAN,
+              "NormInf: band and packed matrices aren't supported");
   sfloat value = 0;
-  sfloat value_i;
-  for (int i = 0; i < slap_NumElements(mat); ++i) {
-    value_i = fabs(mat.data[i]);
-    if (value_i > value) {
-      value = value_i;
+  int rows = slap_StoredRows(mat);
+  for (int j = 0; j < mat.cols; ++j) {
+    const sfloat* col = mat.data + j * mat.sy;
+    for (int i = 0; i < rows; ++i) {
+      sfloat value_i = fabs(col[i]);
+      if (value_i > value) {
+        value = value_i;
+      }
     }
   }
   return value;
 }
 
 sfloat slap_NormOne(Matrix mat) {
-  SLAP_ASSERT_DENSE(mat, NAN, "NormOne must be called on a dense matrix");
+  SLAP_ASSERT_VALID(mat, NAN, "NormOne: invalid matrix");
+  SLAP_ASSERT(!slap_IsStructured(mat) || slap_GetType(mat) == slap_DIAGONAL,
+              SLAP_INVALID_MATRIX, NAN,
+              "NormOne: band and packed matrices aren't supported");
   sfloat value = 0;
-  sfloat value_i;
-  for (int i = 0; i < slap_NumElements(mat); ++i) {
-    value_i = fabs(mat.data[i]);
-    value += value_i;
+  int rows = slap_StoredRows(mat);
+  for (int j = 0; j < mat.cols; ++j) {
+    const sfloat* col = mat.data + j * mat.sy;
+    for (int i = 0; i < rows; ++i) {
+      value += fabs(col[i]);
+    }
   }
   return value;
 }
 
 sfloat slap_Sum(Matrix mat) {
   sfloat sum = 0;
+  if (slap_GetType(mat) == slap_DIAGONAL) {
+    for (int k = 0; k < slap_NumRows(mat); ++k) {
+      sum += mat.data[k];
+    }
+    return sum;
+  }
+  SLAP_ASSERT(!slap_IsStructured(mat), SLAP_INVALID_MATRIX, NAN,
+              "Sum: band and packed matrices aren't supported");
   for (MatrixIterator it = slap_Iterator(mat); !slap_IsFinished(&it); slap_Step(&it)) {
     sfloat value_i = mat.data[it.index];
     sum += value_i;
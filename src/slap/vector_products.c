@@ -7,19 +7,19 @@
 
 #include <math.h>
 
+#include "diagonal.h"
+#include "fixed_size.h"
+#include "kernels.h"
 #include "matrix_checks.h"
+#include "packed.h"
 
 sfloat slap_InnerProduct(const Matrix x, const Matrix y) {
   SLAP_ASSERT_DENSE(x, NAN, "InnerProduct: x vector must be dense");
   SLAP_ASSERT_DENSE(y, NAN, "InnerProduct: x vector must be dense");
   int nx = slap_NumElements(x);
-  int ny = slap_NumElements(x);
+  int ny = slap_NumElements(y);
   int n = nx < ny ? nx : ny;
-  sfloat dot = 0;
-  for (int i = 0; i < n; ++i) {
-    dot += x.data[i] * y.data[i];
-  }
-  return dot;
+  return slap_GetKernels()->dot(n, x.data, y.data);
 }
 
 sfloat slap_QuadraticForm(const Matrix y, const Matrix Q, const Matrix x) {
@@ -28,6 +28,12 @@ sfloat slap_QuadraticForm(const Matrix y, const Matrix Q, const Matrix x) {
   SLAP_ASSERT_VALID(x, NAN, "QuadraticForm: x vector not valid");
   SLAP_ASSERT_DENSE(y, NAN, "QuadraticForm: y matrix must be dense");
   SLAP_ASSERT_DENSE(x, NAN, "QuadraticForm: x matrix must be dense");
+  if (slap_GetType(Q) == slap_DIAGONAL) {
+    return slap_DiagonalQuadraticForm(y, Q, x);
+  }
+  if (slap_IsPacked(Q)) {
+    return slap_PackedQuadraticForm(y, Q, x);
+  }
 
   enum slap_ErrorCode err;
   err = slap_CheckMatrix(y);
@@ -54,6 +60,9 @@ sfloat slap_QuadraticForm(const Matrix y, const Matrix Q, const Matrix x) {
     return NAN;
   }
   sfloat out = 0.0;
+  if (slap_QuadraticFormFixedSize(y, Q, x, &out)) {
+    return out;
+  }
   for (int j = 0; j < m; ++j) {
     for (int i = 0; i < n; ++i) {
       sfloat xj = x.data[j];
@@ -0,0 +1,88 @@
+//
+// Created by Brian Jackson on 10/18/26.
+// Copyright (c) 2026 Robotic Exploration Lab. All rights reserved.
+//
+
+#include <cstdint>
+
+#include "gtest/gtest.h"
+#include "slap/slap.h"
+
+bool IsAligned(const void* ptr) {
+  return reinterpret_cast<uintptr_t>(ptr) % SLAP_ARENA_ALIGNMENT == 0;
+}
+
+TEST(Arena, PushPop) {
+  alignas(SLAP_ARENA_ALIGNMENT) static char buffer[1024];
+  // Start off of an aligned address
+  slap_Arena arena = slap_NewArena(buffer + 1, sizeof(buffer) - 1);
+  EXPECT_TRUE(IsAligned(arena.data));
+  EXPECT_EQ(slap_ArenaBytesRemaining(&arena), sizeof(buffer) - SLAP_ARENA_ALIGNMENT);
+
+  void* a = slap_ArenaPush(&arena, 1);
+  size_t mark = slap_ArenaMark(&arena);
+  void* b = slap_ArenaPush(&arena, 100);
+  void* c = slap_ArenaPush(&arena, SLAP_ARENA_ALIGNMENT);
+  EXPECT_TRUE(IsAligned(a));
+  EXPECT_TRUE(IsAligned(b));
+  EXPECT_TRUE(IsAligned(c));
+  EXPECT_EQ(static_cast<char*>(b) - static_cast<char*>(a), SLAP_ARENA_ALIGNMENT);
+  EXPECT_EQ(static_cast<char*>(c) - static_cast<char*>(b), 2 * SLAP_ARENA_ALIGNMENT);
+
+  // Popping releases b and c, but not a
+  EXPECT_EQ(slap_ArenaPop(&arena, mark), SLAP_NO_ERROR);
+  EXPECT_EQ(slap_ArenaPush(&arena, 8), b);
+
+  // Too large
+  EXPECT_EQ(slap_ArenaPush(&arena, sizeof(buffer)), nullptr);
+  EXPECT_EQ(slap_ArenaPush(&arena, SIZE_MAX), nullptr);
+
+  slap_ArenaReset(&arena);
+  EXPECT_EQ(slap_ArenaPush(&arena, 8), a);
+}
+
+TEST(Arena, Matrices) {
+  alignas(SLAP_ARENA_ALIGNMENT) static char buffer[1024];
+  slap_Arena arena = slap_NewArena(buffer, sizeof(buffer));
+  Matrix A = slap_ArenaNewMatrixZeros(&arena, 3, 5);
+  EXPECT_EQ(slap_NumRows(A), 3);
+  EXPECT_EQ(slap_NumCols(A), 5);
+  EXPECT_TRUE(slap_IsDense(A));
+  EXPECT_TRUE(IsAligned(A.data));
+  EXPECT_DOUBLE_EQ(slap_NormOne(A), 0);
+  EXPECT_EQ(slap_ArenaMark(&arena), slap_ArenaMatrixSize(3, 5));
+
+  // Out of space
+  Matrix B = slap_ArenaNewMatrix(&arena, 100, 100);
+  EXPECT_EQ(B.data, nullptr);
+}
+
+TEST(Arena, QRWorkspace) {
+  const int m = 12;
+  const int n = 5;
+  alignas(SLAP_ARENA_ALIGNMENT) static char buffer[4096];
+  slap_Arena arena = slap_NewArena(buffer, sizeof(buffer));
+  Matrix A = slap_ArenaNewMatrix(&arena, m, n);
+  Matrix b = slap_ArenaNewMatrix(&arena, m, 1);
+  Matrix x = slap_ArenaNewMatrix(&arena, n, 1);
+  slap_SetRange(A, -1, 1);
+  for (int i = 0; i < n; ++i) {
+    *slap_GetElement(A, i, i) += 3;
+  }
+  slap_SetRange(x, 1, 2);
+  slap_MatMulAdd(b, A, x, 1, 0);
+
+  // The workspace query covers exactly what the solver needs
+  size_t mark = slap_ArenaMark(&arena);
+  Matrix betas = slap_ArenaNewMatrix(&arena, m, 1);
+  Matrix temp = slap_ArenaNewMatrix(&arena, m, 1);
+  EXPECT_EQ(slap_ArenaMark(&arena) - mark, slap_LeastSquaresWorkspaceSize(m, n));
+  EXPECT_EQ(slap_QRWorkspaceSize(m, n), slap_LeastSquaresWorkspaceSize(m, n));
+  EXPECT_EQ(slap_LeastSquares(A, b, betas, temp), SLAP_NO_ERROR);
+  EXPECT_LT(slap_NormedDifference(slap_CreateSubMatrix(b, 0, 0, n, 1), x), 1e-4);
+  slap_ArenaPop(&arena, mark);
+  EXPECT_EQ(slap_ArenaMark(&arena), mark);
+
+  EXPECT_EQ(slap_CholeskyWorkspaceSize(m), 0u);
+  EXPECT_EQ(slap_ComputeQWorkspaceSize(m, n), 0u);
+}
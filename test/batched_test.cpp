@@ -0,0 +1,193 @@
+//
+// Created by Brian Jackson on 10/18/26.
+// Copyright (c) 2026 Robotic Exploration Lab. All rights reserved.
+//
+
+#include <cmath>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "slap/slap.h"
+
+// A batch of matrices, with independent data for each problem
+class Batch {
+ public:
+  Batch(int batch_size, int rows, int cols) {
+    for (int k = 0; k < batch_size; ++k) {
+      Matrix mat = slap_NewMatrix(rows, cols);
+      slap_SetRange(mat, -1 + 0.1 * k, 1 + 0.2 * k);
+      mats.push_back(mat);
+    }
+  }
+  ~Batch() {
+    for (Matrix& mat : mats) {
+      slap_FreeMatrix(&mat);
+    }
+  }
+  Matrix& operator[](int k) { return mats[k]; }
+  const Matrix* data() const { return mats.data(); }
+  std::vector<Matrix> mats;
+};
+
+// Positive-definite matrices: A = G'G + I
+void MakePosDef(Batch& A, int n) {
+  Matrix G = slap_NewMatrix(n, n);
+  for (size_t k = 0; k < A.mats.size(); ++k) {
+    slap_SetRange(G, -1 - 0.05 * k, 1 + 0.1 * k);
+    slap_MatMulAdd(A[k], slap_Transpose(G), G, 1, 0);
+    slap_AddIdentity(A[k], 1);
+  }
+  slap_FreeMatrix(&G);
+}
+
+TEST(Batched, MatMulAdd) {
+  // Not a multiple of the batch width, so the last group is partially filled
+  const int batch_size = 2 * SLAP_BATCH_WIDTH + 3;
+  const int m = 7;
+  const int k = 5;
+  const int n = 6;
+  Batch A(batch_size, m, k);
+  Batch Bt(batch_size, n, k);
+  Batch C(batch_size, m, n);
+  Batch C_ans(batch_size, m, n);
+  std::vector<Matrix> B;
+  for (int i = 0; i < batch_size; ++i) {
+    B.push_back(slap_Transpose(Bt[i]));
+    slap_MatMulAdd(C_ans[i], A[i], B[i], 0.5, -1);
+  }
+  EXPECT_EQ(slap_BatchedMatMulAdd(batch_size, C.data(), A.data(), B.data(), 0.5, -1),
+            SLAP_NO_ERROR);
+  for (int i = 0; i < batch_size; ++i) {
+    EXPECT_LT(slap_NormedDifference(C[i], C_ans[i]), 1e-4);
+  }
+}
+
+TEST(Batched, MatMulMixedSizes) {
+  // Problems of different sizes end up in different groups
+  std::vector<Matrix> A, B, C, C_ans;
+  for (int i = 0; i < 3 * SLAP_BATCH_WIDTH; ++i) {
+    int n = i < SLAP_BATCH_WIDTH / 2 ? 3 : (i % 5 == 0 ? SLAP_BATCH_MAX_DIM + 1 : 4);
+    A.push_back(slap_NewMatrix(n, n));
+    B.push_back(slap_NewMatrix(n, 2));
+    C.push_back(slap_NewMatrix(n, 2));
+    C_ans.push_back(slap_NewMatrix(n, 2));
+    slap_SetRange(A.back(), -i, i + 1);
+    slap_SetRange(B.back(), 1, 2);
+    slap_MatMulAdd(C_ans.back(), A.back(), B.back(), 1, 0);
+  }
+  EXPECT_EQ(slap_BatchedMatMulAdd(A.size(), C.data(), A.data(), B.data(), 1, 0),
+            SLAP_NO_ERROR);
+  for (size_t i = 0; i < A.size(); ++i) {
+    EXPECT_LT(slap_NormedDifference(C[i], C_ans[i]), 1e-3);
+    slap_FreeMatrix(&A[i]);
+    slap_FreeMatrix(&B[i]);
+    slap_FreeMatrix(&C[i]);
+    slap_FreeMatrix(&C_ans[i]);
+  }
+}
+
+TEST(Batched, CholeskySolve) {
+  const int batch_size = 3 * SLAP_BATCH_WIDTH - 1;
+  const int n = 13;
+  Batch A(batch_size, n, n);
+  Batch L(batch_size, n, n);
+  Batch L_ans(batch_size, n, n);
+  Batch b(batch_size, n, 2);
+  Batch x(batch_size, n, 2);
+  Batch Ax(batch_size, n, 2);
+  MakePosDef(A, n);
+  for (int i = 0; i < batch_size; ++i) {
+    slap_Copy(L[i], A[i]);
+    slap_Copy(L_ans[i], A[i]);
+    slap_Cholesky(L_ans[i]);
+    slap_Copy(x[i], b[i]);
+  }
+
+  std::vector<slap_ErrorCode> status(batch_size, SLAP_INVALID_MATRIX);
+  EXPECT_EQ(slap_BatchedCholesky(batch_size, L.data(), status.data()), SLAP_NO_ERROR);
+  EXPECT_EQ(slap_BatchedCholeskySolve(batch_size, L.data(), x.data(), NULL),
+            SLAP_NO_ERROR);
+  for (int i = 0; i < batch_size; ++i) {
+    EXPECT_EQ(status[i], SLAP_NO_ERROR);
+    // Includes the upper triangle, which shouldn't be modified
+    EXPECT_LT(slap_NormedDifference(L[i], L_ans[i]), 1e-4);
+    slap_MatMulAdd(Ax[i], A[i], x[i], 1, 0);
+    EXPECT_LT(slap_NormedDifference(Ax[i], b[i]), 1e-3);
+  }
+}
+
+TEST(Batched, CholeskyFailure) {
+  const int batch_size = SLAP_BATCH_WIDTH;
+  const int n = 4;
+  Batch A(batch_size, n, n);
+  MakePosDef(A, n);
+  slap_SetElement(A[1], 2, 2, -10);
+  std::vector<slap_ErrorCode> status(batch_size);
+  EXPECT_EQ(slap_BatchedCholesky(batch_size, A.data(), status.data()), SLAP_CHOLESKY_FAIL);
+  for (int i = 0; i < batch_size; ++i) {
+    EXPECT_EQ(status[i], i == 1 ? SLAP_CHOLESKY_FAIL : SLAP_NO_ERROR);
+  }
+}
+
+TEST(Batched, TriSolve) {
+  const int batch_size = 2 * SLAP_BATCH_WIDTH;
+  const int n = 9;
+  Batch A(batch_size, n, n);
+  Batch b(batch_size, n, 3);
+  Batch x(batch_size, n, 3);
+  Batch Lx(batch_size, n, 3);
+  MakePosDef(A, n);
+  std::vector<Matrix> L;
+  for (int i = 0; i < batch_size; ++i) {
+    slap_Cholesky(A[i]);
+    slap_MakeLowerTri(A[i]);
+    // Half lower and half (transposed) upper triangular systems
+    L.push_back(i < batch_size / 2 ? A[i] : slap_Transpose(A[i]));
+    slap_Copy(x[i], b[i]);
+  }
+  EXPECT_EQ(slap_BatchedTriSolve(batch_size, L.data(), x.data(), NULL), SLAP_NO_ERROR);
+  for (int i = 0; i < batch_size; ++i) {
+    slap_MatMulAdd(Lx[i], L[i], x[i], 1, 0);
+    EXPECT_LT(slap_NormedDifference(Lx[i], b[i]), 1e-3);
+  }
+}
+
+TEST(Batched, DiagonalFallback) {
+  // Structured matrices don't store every element, so they're solved one at a time
+  const int batch_size = 4;
+  const int n = 3;
+  sfloat diag[n] = {2, 3, 4};
+  Batch A(batch_size, n, n);
+  Batch C(batch_size, n, n);
+  Batch b(batch_size, n, 1);
+  std::vector<Matrix> D(batch_size, slap_DiagonalFromArray(n, diag));
+  for (int i = 0; i < batch_size; ++i) {
+    slap_SetConst(A[i], 1);
+    slap_SetConst(b[i], 12);
+  }
+  EXPECT_EQ(slap_BatchedMatMulAdd(batch_size, C.data(), A.data(), D.data(), 1, 0),
+            SLAP_NO_ERROR);
+  EXPECT_EQ(slap_BatchedTriSolve(batch_size, D.data(), b.data(), NULL), SLAP_NO_ERROR);
+  for (int i = 0; i < batch_size; ++i) {
+    for (int j = 0; j < n; ++j) {
+      EXPECT_DOUBLE_EQ(*slap_GetElement(C[i], 0, j), diag[j]);
+      EXPECT_DOUBLE_EQ(*slap_GetElement(b[i], j, 0), 12 / diag[j]);
+    }
+  }
+
+  // Factoring the diagonal takes the square root of each element in place
+  sfloat diags[batch_size][n];
+  std::vector<Matrix> Dk;
+  for (int i = 0; i < batch_size; ++i) {
+    for (int j = 0; j < n; ++j) {
+      diags[i][j] = diag[j] * diag[j];
+    }
+    Dk.push_back(slap_DiagonalFromArray(n, diags[i]));
+  }
+  EXPECT_EQ(slap_BatchedCholesky(batch_size, Dk.data(), NULL), SLAP_NO_ERROR);
+  for (int i = 0; i < batch_size; ++i) {
+    for (int j = 0; j < n; ++j) {
+      EXPECT_DOUBLE_EQ(diags[i][j], diag[j]);
+    }
+  }
+}
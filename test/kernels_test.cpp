@@ -0,0 +1,217 @@
+//
+// Created by Brian Jackson on 10/18/26.
+// Copyright (c) 2026 Robotic Exploration Lab. All rights reserved.
+//
+
+#include <cmath>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "slap/slap.h"
+
+// Runs the body of each test once for every instruction set available on this machine
+class KernelTest : public ::testing::TestWithParam<slap_ISA> {
+ protected:
+  void SetUp() override {
+    if (!slap_ISASupported(GetParam())) {
+      GTEST_SKIP() << slap_ISAName(GetParam()) << " kernels not available";
+    }
+    default_isa = slap_GetISA();
+    slap_SetISA(GetParam());
+  }
+  void TearDown() override { slap_SetISA(default_isa); }
+  slap_ISA default_isa = SLAP_ISA_SCALAR;
+};
+
+TEST(Kernels, ScalarAlwaysSupported) {
+  EXPECT_TRUE(slap_ISASupported(SLAP_ISA_SCALAR));
+  EXPECT_TRUE(slap_ISASupported(slap_GetISA()));
+  EXPECT_NE(slap_GetKernels(), nullptr);
+}
+
+TEST_P(KernelTest, Dot) {
+  for (int n : {0, 1, 3, 7, 8, 9, 16, 31, 100}) {
+    std::vector<sfloat> x(n);
+    std::vector<sfloat> y(n);
+    sfloat expected = 0;
+    for (int i = 0; i < n; ++i) {
+      x[i] = std::sin(i);
+      y[i] = 0.5 * i - 3;
+      expected += x[i] * y[i];
+    }
+    sfloat dot = slap_GetKernels()->dot(n, x.data(), y.data());
+    EXPECT_NEAR(dot, expected, 1e-4 * (1 + std::abs(expected)));
+  }
+}
+
+TEST_P(KernelTest, Axpy) {
+  for (int n : {0, 1, 5, 8, 13, 16, 33}) {
+    std::vector<sfloat> x(n);
+    std::vector<sfloat> y(n);
+    std::vector<sfloat> expected(n);
+    for (int i = 0; i < n; ++i) {
+      x[i] = std::cos(i);
+      y[i] = i;
+      expected[i] = y[i] - 1.5 * x[i];
+    }
+    slap_GetKernels()->axpy(n, -1.5, x.data(), y.data());
+    for (int i = 0; i < n; ++i) {
+      EXPECT_NEAR(y[i], expected[i], 1e-5);
+    }
+  }
+}
+
+TEST_P(KernelTest, Strided) {
+  const slap_Kernels* kernels = slap_GetKernels();
+  const int n = 9;
+  for (int incx : {1, 3}) {
+    for (int incy : {1, 2}) {
+      std::vector<sfloat> x(n * incx);
+      std::vector<sfloat> y(n * incy, 100);
+      sfloat expected = 0;
+      for (int i = 0; i < n; ++i) {
+        x[i * incx] = std::sin(i);
+        y[i * incy] = 0.5 * i - 3;
+        expected += x[i * incx] * y[i * incy];
+      }
+      sfloat dot = slap_DotStrided(kernels, n, x.data(), incx, y.data(), incy);
+      EXPECT_NEAR(dot, expected, 1e-4 * (1 + std::abs(expected)));
+
+      slap_AxpyStrided(kernels, n, 2, x.data(), incx, y.data(), incy);
+      for (int i = 0; i < n * incy; ++i) {
+        if (i % incy == 0) {
+          int k = i / incy;
+          EXPECT_NEAR(y[i], 0.5 * k - 3 + 2 * std::sin(k), 1e-5);
+        } else {
+          EXPECT_EQ(y[i], 100);
+        }
+      }
+    }
+  }
+}
+
+TEST_P(KernelTest, Rot) {
+  const sfloat c = std::cos(0.3);
+  const sfloat s = std::sin(0.3);
+  for (int n : {0, 1, 3, 4, 7, 8, 9, 17, 40}) {
+    std::vector<sfloat> x(n);
+    std::vector<sfloat> y(n);
+    std::vector<sfloat> x_ans(n);
+    std::vector<sfloat> y_ans(n);
+    for (int i = 0; i < n; ++i) {
+      x[i] = std::sin(i);
+      y[i] = 2 - i;
+      x_ans[i] = c * x[i] + s * y[i];
+      y_ans[i] = c * y[i] - s * x[i];
+    }
+    slap_GetKernels()->rot(n, c, s, x.data(), y.data());
+    for (int i = 0; i < n; ++i) {
+      EXPECT_NEAR(x[i], x_ans[i], 1e-5);
+      EXPECT_NEAR(y[i], y_ans[i], 1e-5);
+    }
+  }
+}
+
+TEST_P(KernelTest, MatMul) {
+  const int m = 45;
+  const int k = 33;
+  const int n = 27;
+  Matrix A = slap_NewMatrix(m, k);
+  Matrix B = slap_NewMatrix(k, n);
+  Matrix C = slap_NewMatrix(m, n);
+  Matrix C_ans = slap_NewMatrix(m, n);
+  slap_SetRange(A, -1, 1);
+  slap_SetRange(B, 1, -2);
+  slap_SetConst(C, 1);
+  slap_SetConst(C_ans, 1);
+
+  slap_MatMulBlocked(C, A, B, 0.5, 2);
+  for (int i = 0; i < m; ++i) {
+    for (int j = 0; j < n; ++j) {
+      sfloat Cij = 0;
+      for (int p = 0; p < k; ++p) {
+        Cij += *slap_GetElement(A, i, p) * *slap_GetElement(B, p, j);
+      }
+      slap_SetElement(C_ans, i, j, 2 + 0.5 * Cij);
+    }
+  }
+  EXPECT_LT(slap_NormedDifference(C, C_ans), 1e-3);
+
+  slap_FreeMatrix(&A);
+  slap_FreeMatrix(&B);
+  slap_FreeMatrix(&C);
+  slap_FreeMatrix(&C_ans);
+}
+
+TEST_P(KernelTest, MatrixAdditionStrided) {
+  Matrix A = slap_NewMatrix(20, 10);
+  Matrix B = slap_NewMatrix(20, 10);
+  slap_SetRange(A, 0, 1);
+  slap_SetRange(B, 1, 2);
+  Matrix A_sub = slap_CreateSubMatrix(A, 1, 2, 15, 7);
+  Matrix B_sub = slap_CreateSubMatrix(B, 3, 1, 15, 7);
+  Matrix C = slap_NewMatrix(15, 7);
+
+  slap_MatrixAddition(C, A_sub, B_sub, -2);
+  for (int i = 0; i < 15; ++i) {
+    for (int j = 0; j < 7; ++j) {
+      sfloat expected = *slap_GetElement(A_sub, i, j) - 2 * *slap_GetElement(B_sub, i, j);
+      EXPECT_NEAR(*slap_GetElement(C, i, j), expected, 1e-5);
+    }
+  }
+
+  // Aliased with the second argument
+  slap_Copy(C, B_sub);
+  slap_MatrixAddition(C, A_sub, C, 3);
+  for (int i = 0; i < 15; ++i) {
+    for (int j = 0; j < 7; ++j) {
+      sfloat expected = *slap_GetElement(A_sub, i, j) + 3 * *slap_GetElement(B_sub, i, j);
+      EXPECT_NEAR(*slap_GetElement(C, i, j), expected, 1e-5);
+    }
+  }
+
+  slap_FreeMatrix(&A);
+  slap_FreeMatrix(&B);
+  slap_FreeMatrix(&C);
+}
+
+TEST_P(KernelTest, CholeskySolve) {
+  const int n = 23;
+  Matrix A = slap_NewMatrix(n, n);
+  Matrix G = slap_NewMatrix(n, n);
+  Matrix L = slap_NewMatrix(n, n);
+  Matrix b = slap_NewMatrix(n, 2);
+  Matrix x = slap_NewMatrix(n, 2);
+  Matrix Ax = slap_NewMatrix(n, 2);
+  slap_SetRange(G, -1, 1);
+  slap_MatMulAdd(A, slap_Transpose(G), G, 1, 0);
+  slap_AddIdentity(A, 1);
+  slap_SetRange(b, -3, 4);
+
+  slap_Copy(L, A);
+  EXPECT_EQ(slap_Cholesky(L), SLAP_NO_ERROR);
+  slap_Copy(x, b);
+  EXPECT_EQ(slap_CholeskySolve(L, x), SLAP_NO_ERROR);
+  slap_MatMulAdd(Ax, A, x, 1, 0);
+  EXPECT_LT(slap_NormedDifference(Ax, b), 1e-2);
+
+  slap_FreeMatrix(&A);
+  slap_FreeMatrix(&G);
+  slap_FreeMatrix(&L);
+  slap_FreeMatrix(&b);
+  slap_FreeMatrix(&x);
+  slap_FreeMatrix(&Ax);
+}
+
+INSTANTIATE_TEST_SUITE_P(AllISAs, KernelTest,
+                         ::testing::Values(SLAP_ISA_SCALAR, SLAP_ISA_AVX2, SLAP_ISA_AVX512),
+                         [](const ::testing::TestParamInfo<slap_ISA>& info) {
+                           switch (info.param) {
+                             case SLAP_ISA_AVX2:
+                               return std::string("AVX2");
+                             case SLAP_ISA_AVX512:
+                               return std::string("AVX512");
+                             default:
+                               return std::string("Scalar");
+                           }
+                         });
@@ -4,7 +4,9 @@
 //
 
 #include <cmath>
+#include <cstdlib>
 #include <limits>
+#include <vector>
 
 #include "gtest/gtest.h"
 #include "slap/slap.h"
@@ -93,6 +95,264 @@ TEST_F(LinearAlgebraTest, MatMul_AtB) {
   EXPECT_LT(slap_NormedDifference(B, B_ans), std::sqrt(EPS));
 }
 
+// Reference implementation of C = beta * C + alpha * A * B using element access
+void MatMulAddReference(Matrix C, Matrix A, Matrix B, sfloat alpha, sfloat beta) {
+  for (int i = 0; i < slap_NumRows(C); ++i) {
+    for (int j = 0; j < slap_NumCols(C); ++j) {
+      sfloat Cij = 0;
+      for (int k = 0; k < slap_NumCols(A); ++k) {
+        Cij += *slap_GetElement(A, i, k) * *slap_GetElement(B, k, j);
+      }
+      slap_SetElement(C, i, j, beta * *slap_GetElement(C, i, j) + alpha * Cij);
+    }
+  }
+}
+
+TEST(MatMulBlocked, AllTransposes) {
+  const int m = 37;
+  const int k = 53;
+  const int n = 29;
+  Matrix A = slap_NewMatrix(m, k);
+  Matrix At = slap_NewMatrix(k, m);
+  Matrix B = slap_NewMatrix(k, n);
+  Matrix Bt = slap_NewMatrix(n, k);
+  Matrix C = slap_NewMatrix(m, n);
+  Matrix C_ans = slap_NewMatrix(m, n);
+  slap_SetRange(A, -1, 1);
+  slap_SetRange(B, 2, -3);
+  slap_CopyTranspose(At, A);
+  slap_CopyTranspose(Bt, B);
+
+  const sfloat alpha = 1.5;
+  const sfloat beta = -0.5;
+  Matrix lhs[2] = {A, slap_Transpose(At)};
+  Matrix rhs[2] = {B, slap_Transpose(Bt)};
+  for (Matrix Ai : lhs) {
+    for (Matrix Bi : rhs) {
+      slap_SetRange(C, 0, 1);
+      slap_SetRange(C_ans, 0, 1);
+      MatMulAddReference(C_ans, A, B, alpha, beta);
+      EXPECT_EQ(slap_MatMulBlocked(C, Ai, Bi, alpha, beta), SLAP_NO_ERROR);
+      EXPECT_LT(slap_NormedDifference(C, C_ans), 1e-4);
+
+      // Through the generic interface
+      slap_SetRange(C, 0, 1);
+      slap_MatMulAdd(C, Ai, Bi, alpha, beta);
+      EXPECT_LT(slap_NormedDifference(C, C_ans), 1e-4);
+    }
+  }
+
+  // Transposed output
+  Matrix Ct = slap_NewMatrix(n, m);
+  slap_SetConst(Ct, NAN);
+  slap_SetRange(C_ans, 0, 1);
+  MatMulAddReference(C_ans, A, B, alpha, 0);
+  slap_MatMulBlocked(slap_Transpose(Ct), A, B, alpha, 0);
+  slap_CopyTranspose(C, Ct);
+  EXPECT_LT(slap_NormedDifference(C, C_ans), 1e-4);
+
+  slap_FreeMatrix(&A);
+  slap_FreeMatrix(&At);
+  slap_FreeMatrix(&B);
+  slap_FreeMatrix(&Bt);
+  slap_FreeMatrix(&C);
+  slap_FreeMatrix(&Ct);
+  slap_FreeMatrix(&C_ans);
+}
+
+TEST(MatMulBlocked, Strided) {
+  // Multiply sub-blocks of larger matrices, spanning several cache blocks
+  const int m = 150;
+  const int k = 140;
+  const int n = 70;
+  Matrix A = slap_NewMatrix(m + 5, k + 3);
+  Matrix B = slap_NewMatrix(k + 2, n + 4);
+  Matrix C = slap_NewMatrix(m + 1, n + 1);
+  Matrix C_ans = slap_NewMatrix(m + 1, n + 1);
+  slap_SetRange(A, -1, 1);
+  slap_SetRange(B, 1, -1);
+  slap_SetRange(C, 0, 1);
+  slap_SetRange(C_ans, 0, 1);
+
+  Matrix A_sub = slap_CreateSubMatrix(A, 2, 1, m, k);
+  Matrix B_sub = slap_CreateSubMatrix(B, 1, 3, k, n);
+  Matrix C_sub = slap_CreateSubMatrix(C, 1, 0, m, n);
+  Matrix C_ans_sub = slap_CreateSubMatrix(C_ans, 1, 0, m, n);
+  MatMulAddReference(C_ans_sub, A_sub, B_sub, -2.0, 1.0);
+  slap_MatMulAdd(C_sub, A_sub, B_sub, -2.0, 1.0);
+  EXPECT_LT(slap_NormedDifference(C, C_ans), 1e-3);
+
+  slap_FreeMatrix(&A);
+  slap_FreeMatrix(&B);
+  slap_FreeMatrix(&C);
+  slap_FreeMatrix(&C_ans);
+}
+
+#ifdef SLAP_WIDE_INDEX
+TEST(MatMulBlocked, WideDesignMatrix) {
+  // Normal equations for a design matrix with 200k rows, which is more than INT_MAX
+  // multiply-adds. The small integer entries keep the sums exact.
+  const int rows = 200000;
+  const int n = 104;
+  EXPECT_GT((double)rows * n * n, (double)std::numeric_limits<int>::max());
+  Matrix X = slap_NewMatrix(rows, n);
+  Matrix G = slap_NewMatrix(n, n);
+  for (int j = 0; j < n; ++j) {
+    for (int i = 0; i < rows; ++i) {
+      slap_SetElement(X, i, j, (sfloat)((i + j) % 7 - 3));
+    }
+  }
+  slap_SetConst(G, NAN);
+  EXPECT_EQ(slap_MatMulAdd(G, slap_Transpose(X), X, 1, 0), SLAP_NO_ERROR);
+
+  const int pairs[5][2] = {{0, 0}, {n - 1, n - 1}, {5, 77}, {n - 1, 0}, {50, 51}};
+  for (const auto& pair : pairs) {
+    int a = pair[0];
+    int b = pair[1];
+    double Gab = 0;
+    for (int i = 0; i < rows; ++i) {
+      Gab += *slap_GetElement(X, i, a) * *slap_GetElement(X, i, b);
+    }
+    EXPECT_DOUBLE_EQ(*slap_GetElement(G, a, b), Gab);
+    EXPECT_DOUBLE_EQ(*slap_GetElement(G, b, a), Gab);
+  }
+  slap_FreeMatrix(&X);
+  slap_FreeMatrix(&G);
+}
+#endif
+
+TEST(FixedSize, MatMulAllSizes) {
+  for (int n = SLAP_FIXED_SIZE_MIN; n <= SLAP_FIXED_SIZE_MAX; ++n) {
+    Matrix A = slap_NewMatrix(n, n);
+    Matrix B = slap_NewMatrix(n, n);
+    Matrix C = slap_NewMatrix(n, n);
+    Matrix C_ans = slap_NewMatrix(n, n);
+    slap_SetRange(A, -1, 1);
+    slap_SetRange(B, 2, -3);
+    for (Matrix Ai : {A, slap_Transpose(A)}) {
+      for (Matrix Bi : {B, slap_Transpose(B)}) {
+        slap_SetRange(C, 0, 1);
+        slap_SetRange(C_ans, 0, 1);
+        MatMulAddReference(C_ans, Ai, Bi, 1.5, -0.5);
+        EXPECT_TRUE(slap_MatMulAddFixedSize(C, Ai, Bi, 1.5, -0.5));
+        EXPECT_LT(slap_NormedDifference(C, C_ans), 1e-4);
+      }
+    }
+
+    // Uninitialized output is overwritten when beta is zero
+    slap_SetConst(C, NAN);
+    slap_SetConst(C_ans, 0);
+    MatMulAddReference(C_ans, A, B, 1, 0);
+    EXPECT_EQ(slap_MatMulAdd(C, A, B, 1, 0), SLAP_NO_ERROR);
+    EXPECT_LT(slap_NormedDifference(C, C_ans), 1e-4);
+
+    // Not handled: transposed output
+    EXPECT_FALSE(slap_MatMulAddFixedSize(slap_Transpose(C), A, B, 1, 0));
+
+    slap_FreeMatrix(&A);
+    slap_FreeMatrix(&B);
+    slap_FreeMatrix(&C);
+    slap_FreeMatrix(&C_ans);
+  }
+  EXPECT_FALSE(slap_HasFixedSizeKernels(SLAP_FIXED_SIZE_MIN - 1));
+  EXPECT_FALSE(slap_HasFixedSizeKernels(SLAP_FIXED_SIZE_MAX + 1));
+}
+
+TEST(FixedSize, CholeskyAllSizes) {
+  for (int n = SLAP_FIXED_SIZE_MIN; n <= SLAP_FIXED_SIZE_MAX; ++n) {
+    Matrix G = slap_NewMatrix(n, n);
+    Matrix A = slap_NewMatrix(n, n);
+    Matrix L = slap_NewMatrix(n, n);
+    Matrix A_chol = slap_NewMatrix(n, n);
+    Matrix b = slap_NewMatrix(n, 2);
+    Matrix x = slap_NewMatrix(n, 2);
+    Matrix Ax = slap_NewMatrix(n, 2);
+    slap_SetRange(G, -1, 1);
+    slap_MatMulAdd(A, slap_Transpose(G), G, 1, 0);
+    slap_AddIdentity(A, 1);
+    slap_SetRange(b, -2, 3);
+
+    // Compare against the generic factorization on a strided copy
+    Matrix S = slap_NewMatrix(n + 1, n);
+    Matrix L_ans = slap_CreateSubMatrix(S, 1, 0, n, n);
+    slap_Copy(L, A);
+    slap_Copy(L_ans, A);
+    int fail_col = 0;
+    EXPECT_TRUE(slap_CholeskyFixedSize(L, &fail_col));
+    EXPECT_EQ(fail_col, -1);
+    EXPECT_EQ(slap_Cholesky(L_ans), SLAP_NO_ERROR);
+    slap_MakeLowerTri(L);
+    slap_MakeLowerTri(L_ans);
+    slap_Copy(A_chol, L_ans);
+    EXPECT_LT(slap_NormedDifference(L, A_chol), 1e-4);
+
+    // Upper triangle is untouched
+    slap_Copy(L, A);
+    slap_Cholesky(L);
+    EXPECT_DOUBLE_EQ(*slap_GetElement(L, 0, n - 1), *slap_GetElement(A, 0, n - 1));
+
+    slap_Copy(x, b);
+    EXPECT_EQ(slap_CholeskySolve(L, x), SLAP_NO_ERROR);
+    slap_MatMulAdd(Ax, A, x, 1, 0);
+    EXPECT_LT(slap_NormedDifference(Ax, b), 1e-3);
+
+    // Triangular solves with each orientation
+    slap_Copy(x, b);
+    EXPECT_EQ(slap_TriSolve(L, x), SLAP_NO_ERROR);
+    EXPECT_EQ(slap_TriSolve(slap_Transpose(L), x), SLAP_NO_ERROR);
+    slap_MatMulAdd(Ax, A, x, 1, 0);
+    EXPECT_LT(slap_NormedDifference(Ax, b), 1e-3);
+
+    Matrix U = slap_NewMatrix(n, n);
+    slap_MakeLowerTri(L);
+    slap_CopyTranspose(U, L);
+    U.mattype = slap_TRIANGULAR_UPPER;
+    slap_Copy(x, b);
+    EXPECT_TRUE(slap_TriSolveFixedSize(U, x));
+    U.mattype = slap_DENSE;
+    slap_MatMulAdd(Ax, U, x, 1, 0);
+    EXPECT_LT(slap_NormedDifference(Ax, b), 1e-3);
+
+    // Failure is reported for indefinite matrices
+    slap_Copy(L, A);
+    slap_SetElement(L, n - 1, n - 1, -1);
+    EXPECT_EQ(slap_Cholesky(L), SLAP_CHOLESKY_FAIL);
+
+    slap_FreeMatrix(&G);
+    slap_FreeMatrix(&A);
+    slap_FreeMatrix(&L);
+    slap_FreeMatrix(&A_chol);
+    slap_FreeMatrix(&U);
+    slap_FreeMatrix(&S);
+    slap_FreeMatrix(&b);
+    slap_FreeMatrix(&x);
+    slap_FreeMatrix(&Ax);
+  }
+}
+
+TEST(FixedSize, QuadraticFormAllSizes) {
+  for (int n = SLAP_FIXED_SIZE_MIN; n <= SLAP_FIXED_SIZE_MAX; ++n) {
+    Matrix Q = slap_NewMatrix(n, n);
+    Matrix x = slap_NewMatrix(n, 1);
+    Matrix y = slap_NewMatrix(n, 1);
+    slap_SetRange(Q, -1, 2);
+    slap_SetRange(x, 1, 2);
+    slap_SetRange(y, -3, 1);
+    for (Matrix Qi : {Q, slap_Transpose(Q)}) {
+      sfloat expected = 0;
+      for (int i = 0; i < n; ++i) {
+        for (int j = 0; j < n; ++j) {
+          expected += y.data[i] * *slap_GetElement(Qi, i, j) * x.data[j];
+        }
+      }
+      EXPECT_NEAR(slap_QuadraticForm(y, Qi, x), expected, 1e-4 * (1 + std::abs(expected)));
+    }
+    slap_FreeMatrix(&Q);
+    slap_FreeMatrix(&x);
+    slap_FreeMatrix(&y);
+  }
+}
+
 TEST_F(LinearAlgebraTest, CholeskyFactorization) {
   enum slap_ErrorCode err;
   int n = chol_dim;
@@ -122,6 +382,552 @@ TEST_F(LinearAlgebraTest, CholeskyFactorization) {
   slap_FreeMatrix(&A);
 }
 
+TEST(FixedSize, PaddedStride) {
+  // Matrices from slap_NewMatrixAligned use the same kernels as dense ones
+  for (int n = SLAP_FIXED_SIZE_MIN; n <= SLAP_FIXED_SIZE_MAX; ++n) {
+    Matrix A = slap_NewMatrixAligned(n, n);
+    Matrix B = slap_NewMatrixAligned(n, n);
+    Matrix C = slap_NewMatrixAligned(n, n);
+    Matrix C_ans = slap_NewMatrix(n, n);
+    Matrix L = slap_NewMatrixAligned(n, n);
+    Matrix L_ans = slap_NewMatrix(n, n);
+    Matrix b = slap_NewMatrixAligned(n, 2);
+    Matrix x_ans = slap_NewMatrix(n, 2);
+    EXPECT_EQ(A.sy, slap_AlignedStride(n));
+    slap_SetRange(A, -1, 1);
+    slap_SetRange(B, 2, -3);
+    slap_SetRange(C, 0, 1);
+    slap_SetRange(C_ans, 0, 1);
+    MatMulAddReference(C_ans, A, slap_Transpose(B), 1.5, -0.5);
+    EXPECT_TRUE(slap_MatMulAddFixedSize(C, A, slap_Transpose(B), 1.5, -0.5));
+    EXPECT_LT(slap_NormedDifference(C, C_ans), 1e-4);
+
+    // Can't mix dense and padded strides
+    if (A.sy != n) {
+      EXPECT_FALSE(slap_MatMulAddFixedSize(C_ans, A, B, 1, 0));
+    }
+
+    // L = A'A + I
+    slap_MatMulAdd(L, slap_Transpose(A), A, 1, 0);
+    slap_AddIdentity(L, 1);
+    slap_Copy(L_ans, L);
+    int fail_col = 0;
+    EXPECT_TRUE(slap_CholeskyFixedSize(L, &fail_col));
+    EXPECT_EQ(fail_col, -1);
+    slap_Cholesky(L_ans);
+    EXPECT_LT(slap_NormedDifference(L, L_ans), 1e-4);
+
+    slap_SetRange(b, -1, 2);
+    slap_Copy(x_ans, b);
+    slap_MakeLowerTri(L_ans);
+    slap_MakeLowerTri(L);
+    slap_CholeskySolve(L_ans, x_ans);
+    EXPECT_TRUE(slap_CholeskySolveFixedSize(L, b));
+    EXPECT_LT(slap_NormedDifference(b, x_ans), 1e-4);
+
+    slap_FreeMatrix(&A);
+    slap_FreeMatrix(&B);
+    slap_FreeMatrix(&C);
+    slap_FreeMatrix(&C_ans);
+    slap_FreeMatrix(&L);
+    slap_FreeMatrix(&L_ans);
+    slap_FreeMatrix(&b);
+    slap_FreeMatrix(&x_ans);
+  }
+}
+
+TEST(CholeskyBlocked, LargeMatrix) {
+  // Spans several blocks, with a partial block at the end
+  const int n = SLAP_CHOLESKY_THRESHOLD + SLAP_CHOLESKY_BLOCK_SIZE + 5;
+  Matrix G = slap_NewMatrix(n, n);
+  Matrix A = slap_NewMatrix(n, n);
+  Matrix L = slap_NewMatrix(n, n);
+  Matrix LLt = slap_NewMatrix(n, n);
+  slap_SetRange(G, -1, 1);
+  slap_MatMulAdd(A, slap_Transpose(G), G, 1.0 / n, 0);
+  slap_AddIdentity(A, 1);
+
+  slap_Copy(L, A);
+  int fail_col = 0;
+  EXPECT_EQ(slap_CholeskyInfo(L, &fail_col), SLAP_NO_ERROR);
+  EXPECT_EQ(fail_col, -1);
+
+  // The strict upper triangle is untouched
+  for (int j = 1; j < n; ++j) {
+    for (int i = 0; i < j; ++i) {
+      EXPECT_EQ(*slap_GetElement(L, i, j), *slap_GetElement(A, i, j));
+    }
+  }
+  slap_MakeLowerTri(L);
+  slap_MatMulAdd(LLt, L, slap_Transpose(L), 1, 0);
+  EXPECT_LT(slap_NormedDifference(LLt, A), 1e-3);
+
+  // Solve through the blocked factor
+  Matrix b = slap_NewMatrix(n, 1);
+  Matrix x = slap_NewMatrix(n, 1);
+  slap_SetRange(b, -1, 1);
+  slap_Copy(x, b);
+  EXPECT_EQ(slap_CholeskySolve(L, x), SLAP_NO_ERROR);
+  slap_MatMulAdd(b, A, x, 1, -1);
+  EXPECT_LT(slap_NormOne(b), 1e-2);
+
+  slap_FreeMatrix(&G);
+  slap_FreeMatrix(&A);
+  slap_FreeMatrix(&L);
+  slap_FreeMatrix(&LLt);
+  slap_FreeMatrix(&b);
+  slap_FreeMatrix(&x);
+}
+
+TEST(CholeskyBlocked, FailurePosition) {
+  const int n = SLAP_CHOLESKY_THRESHOLD + SLAP_CHOLESKY_BLOCK_SIZE + 5;
+  Matrix A = slap_NewMatrixZeros(n, n);
+  Matrix L = slap_NewMatrix(n, n);
+  slap_AddIdentity(A, 2);
+  for (int col : {0, 5, SLAP_CHOLESKY_BLOCK_SIZE + 3, n - 1}) {
+    slap_Copy(L, A);
+    slap_SetElement(L, col, col, -1);
+    int fail_col = -1;
+    EXPECT_EQ(slap_CholeskyInfo(L, &fail_col), SLAP_CHOLESKY_FAIL);
+    EXPECT_EQ(fail_col, col);
+  }
+
+  // Small matrices, including the size-specialized ones
+  for (int m : {2, 6, 20}) {
+    Matrix As = slap_NewMatrix(m, m);
+    slap_SetIdentity(As, 1);
+    slap_SetElement(As, m - 1, m - 1, 0);
+    int fail_col = -1;
+    EXPECT_EQ(slap_CholeskyInfo(As, &fail_col), SLAP_CHOLESKY_FAIL);
+    EXPECT_EQ(fail_col, m - 1);
+    slap_FreeMatrix(&As);
+  }
+
+  slap_FreeMatrix(&A);
+  slap_FreeMatrix(&L);
+}
+
+TEST(CholeskyUpdate, RankK) {
+  const int n = 25;
+  const int k = 3;
+  Matrix G = slap_NewMatrix(n, n);
+  Matrix A = slap_NewMatrix(n, n);
+  Matrix A2 = slap_NewMatrix(n, n);
+  Matrix L = slap_NewMatrix(n, n);
+  Matrix L2 = slap_NewMatrix(n, n);
+  Matrix X = slap_NewMatrix(n, k);
+  Matrix Xwork = slap_NewMatrix(n, k);
+  srand(5);
+  for (int i = 0; i < n * n; ++i) {
+    G.data[i] = (sfloat)rand() / RAND_MAX - 0.5;
+  }
+  for (int i = 0; i < n * k; ++i) {
+    X.data[i] = (sfloat)rand() / RAND_MAX - 0.5;
+  }
+  slap_MatMulAdd(A, slap_Transpose(G), G, 1, 0);
+  slap_AddIdentity(A, 1);
+  slap_Copy(A2, A);
+  slap_MatMulAdd(A2, X, slap_Transpose(X), 1, 1);
+
+  // Matches the factorization of A + X X'
+  slap_Copy(L, A);
+  slap_Cholesky(L);
+  slap_Copy(L2, A2);
+  slap_Cholesky(L2);
+  slap_Copy(Xwork, X);
+  EXPECT_EQ(slap_CholeskyUpdate(L, Xwork), SLAP_NO_ERROR);
+  slap_MakeLowerTri(L);
+  slap_MakeLowerTri(L2);
+  EXPECT_LT(slap_NormedDifference(L, L2), 1e-4);
+
+  // Downdating gets back to the factorization of A
+  slap_Copy(Xwork, X);
+  int fail_col = 0;
+  EXPECT_EQ(slap_CholeskyDowndate(L, Xwork, &fail_col), SLAP_NO_ERROR);
+  EXPECT_EQ(fail_col, -1);
+  slap_Copy(L2, A);
+  slap_Cholesky(L2);
+  slap_MakeLowerTri(L2);
+  EXPECT_LT(slap_NormedDifference(L, L2), 1e-4);
+
+  // A - X X' isn't positive definite if X is too big
+  slap_ScaleByConst(X, 100);
+  EXPECT_EQ(slap_CholeskyDowndate(L, X, &fail_col), SLAP_CHOLESKY_FAIL);
+  EXPECT_GE(fail_col, 0);
+
+  slap_FreeMatrix(&G);
+  slap_FreeMatrix(&A);
+  slap_FreeMatrix(&A2);
+  slap_FreeMatrix(&L);
+  slap_FreeMatrix(&L2);
+  slap_FreeMatrix(&X);
+  slap_FreeMatrix(&Xwork);
+}
+
+TEST(BlockTriCholesky, VariableBlockSizes) {
+  const int sizes[] = {3, 4, 4, 2, 5, 4};
+  const int N = sizeof(sizes) / sizeof(sizes[0]);
+  const int nrhs = 2;
+  int offsets[N + 1] = {0};
+  for (int k = 0; k < N; ++k) {
+    offsets[k + 1] = offsets[k] + sizes[k];
+  }
+  const int n = offsets[N];
+
+  // Block-tridiagonal positive-definite matrix: A = G G' + I, with G block-bidiagonal
+  Matrix G = slap_NewMatrixZeros(n, n);
+  Matrix A = slap_NewMatrix(n, n);
+  srand(7);
+  for (int k = 0; k < N; ++k) {
+    int r0 = offsets[k];
+    int c0 = k > 0 ? offsets[k - 1] : 0;
+    for (int i = r0; i < offsets[k + 1]; ++i) {
+      for (int j = c0; j < offsets[k + 1]; ++j) {
+        slap_SetElement(G, i, j, (sfloat)rand() / RAND_MAX - 0.5);
+      }
+    }
+  }
+  slap_MatMulAdd(A, G, slap_Transpose(G), 1, 0);
+  slap_AddIdentity(A, 1);
+
+  // The blocks are views into a copy of A
+  Matrix F = slap_NewMatrix(n, n);
+  slap_Copy(F, A);
+  std::vector<Matrix> D, C, b;
+  Matrix x = slap_NewMatrix(n, nrhs);
+  for (int k = 0; k < N; ++k) {
+    D.push_back(slap_CreateSubMatrix(F, offsets[k], offsets[k], sizes[k], sizes[k]));
+    if (k > 0) {
+      C.push_back(
+          slap_CreateSubMatrix(F, offsets[k], offsets[k - 1], sizes[k], sizes[k - 1]));
+    }
+    b.push_back(slap_CreateSubMatrix(x, offsets[k], 0, sizes[k], nrhs));
+  }
+  int fail_block = 0;
+  EXPECT_EQ(slap_BlockTriCholesky(N, D.data(), C.data(), &fail_block), SLAP_NO_ERROR);
+  EXPECT_EQ(fail_block, -1);
+
+  // Reuse the factorization for several solves
+  Matrix rhs = slap_NewMatrix(n, nrhs);
+  for (int trial = 0; trial < 2; ++trial) {
+    slap_SetRange(rhs, -1 - trial, 1);
+    slap_Copy(x, rhs);
+    EXPECT_EQ(slap_BlockTriCholeskySolve(N, D.data(), C.data(), b.data()), SLAP_NO_ERROR);
+    slap_MatMulAdd(rhs, A, x, 1, -1);
+    EXPECT_LT(slap_NormInf(rhs), 1e-4);
+  }
+
+  // The factor of the first block column matches the dense factorization
+  Matrix L = slap_NewMatrix(n, n);
+  slap_Copy(L, A);
+  slap_Cholesky(L);
+  for (int j = 0; j < sizes[0]; ++j) {
+    for (int i = j; i < offsets[2]; ++i) {
+      EXPECT_NEAR(*slap_GetElement(F, i, j), *slap_GetElement(L, i, j), 1e-4);
+    }
+  }
+
+  // Reports the block that isn't positive definite
+  slap_Copy(F, A);
+  slap_SetElement(F, offsets[3] + 1, offsets[3] + 1, -1);
+  EXPECT_EQ(slap_BlockTriCholesky(N, D.data(), C.data(), &fail_block),
+            SLAP_CHOLESKY_FAIL);
+  EXPECT_EQ(fail_block, 3);
+
+  slap_FreeMatrix(&G);
+  slap_FreeMatrix(&A);
+  slap_FreeMatrix(&F);
+  slap_FreeMatrix(&x);
+  slap_FreeMatrix(&rhs);
+  slap_FreeMatrix(&L);
+}
+
+// Check P A = L U for the output of slap_LU()
+static double LUResidual(Matrix A, Matrix LU, const int* piv) {
+  int n = slap_NumRows(A);
+  Matrix L = slap_NewMatrix(n, n);
+  Matrix U = slap_NewMatrix(n, n);
+  Matrix PA = slap_NewMatrix(n, n);
+  slap_Copy(L, LU);
+  slap_MakeLowerTri(L);
+  for (int i = 0; i < n; ++i) {
+    slap_SetElement(L, i, i, 1);
+  }
+  slap_Copy(U, LU);
+  slap_MakeUpperTri(U);
+  slap_Copy(PA, A);
+  for (int k = 0; k < n; ++k) {
+    for (int j = 0; j < n; ++j) {
+      sfloat tmp = *slap_GetElement(PA, k, j);
+      slap_SetElement(PA, k, j, *slap_GetElement(PA, piv[k], j));
+      slap_SetElement(PA, piv[k], j, tmp);
+    }
+  }
+  slap_MatMulAdd(PA, L, U, 1, -1);
+  double err = slap_NormInf(PA);
+  slap_FreeMatrix(&L);
+  slap_FreeMatrix(&U);
+  slap_FreeMatrix(&PA);
+  return err;
+}
+
+TEST(LU, SolveMultipleRHS) {
+  const int n = 9;
+  const int k = 3;
+  Matrix A = slap_NewMatrix(n, n);
+  Matrix LU = slap_NewMatrix(n, n);
+  Matrix b = slap_NewMatrix(n, k);
+  Matrix x = slap_NewMatrix(n, k);
+  srand(2);
+  for (int i = 0; i < n * n; ++i) {
+    A.data[i] = (sfloat)rand() / RAND_MAX - 0.5;
+  }
+  slap_SetRange(b, -1, 1);
+  int piv[n];
+
+  // Regular, and transposed storage
+  for (Matrix Ai : {A, slap_Transpose(A)}) {
+    Matrix LUi = slap_IsTransposed(Ai) ? slap_Transpose(LU) : LU;
+    slap_Copy(LUi, Ai);
+    EXPECT_EQ(slap_LU(LUi, piv), SLAP_NO_ERROR);
+    EXPECT_LT(LUResidual(Ai, LUi, piv), 1e-4);
+    slap_Copy(x, b);
+    EXPECT_EQ(slap_LUSolve(LUi, piv, x), SLAP_NO_ERROR);
+    Matrix r = slap_NewMatrix(n, k);
+    slap_Copy(r, b);
+    slap_MatMulAdd(r, Ai, x, 1, -1);
+    EXPECT_LT(slap_NormInf(r), 1e-4);
+    slap_FreeMatrix(&r);
+  }
+
+  // Strided and transposed right-hand side
+  Matrix parent = slap_NewMatrix(k + 2, n);
+  Matrix xt = slap_Transpose(slap_CreateSubMatrix(parent, 1, 0, k, n));
+  slap_Copy(LU, A);
+  slap_LU(LU, piv);
+  slap_Copy(xt, b);
+  EXPECT_EQ(slap_LUSolve(LU, piv, xt), SLAP_NO_ERROR);
+  slap_MatMulAdd(b, A, xt, 1, -1);
+  EXPECT_LT(slap_NormInf(b), 1e-4);
+
+  slap_FreeMatrix(&A);
+  slap_FreeMatrix(&LU);
+  slap_FreeMatrix(&b);
+  slap_FreeMatrix(&x);
+  slap_FreeMatrix(&parent);
+}
+
+TEST(LU, Singular) {
+  const int n = 5;
+  Matrix A = slap_NewMatrixZeros(n, n);
+  slap_SetIdentity(A, 1);
+  slap_SetElement(A, 2, 2, 0);
+  int piv[n];
+  EXPECT_EQ(slap_LU(A, piv), SLAP_SINGULAR_MATRIX);
+  for (int k = 0; k < n; ++k) {
+    EXPECT_EQ(piv[k], k);
+  }
+  slap_FreeMatrix(&A);
+}
+
+TEST(LUBlocked, LargeMatrix) {
+  // Spans several blocks, with a partial block at the end
+  const int n = SLAP_LU_THRESHOLD + SLAP_LU_BLOCK_SIZE + 5;
+  Matrix A = slap_NewMatrix(n, n);
+  Matrix LU = slap_NewMatrix(n, n);
+  Matrix b = slap_NewMatrix(n, 2);
+  Matrix x = slap_NewMatrix(n, 2);
+  srand(1);
+  for (int i = 0; i < n * n; ++i) {
+    A.data[i] = (sfloat)rand() / RAND_MAX - 0.5;
+  }
+  std::vector<int> piv(n);
+  slap_Copy(LU, A);
+  EXPECT_EQ(slap_LU(LU, piv.data()), SLAP_NO_ERROR);
+  EXPECT_LT(LUResidual(A, LU, piv.data()), 1e-3);
+
+  // Partial pivoting keeps the multipliers bounded
+  for (int j = 0; j < n; ++j) {
+    for (int i = j + 1; i < n; ++i) {
+      EXPECT_LE(std::abs(*slap_GetElement(LU, i, j)), 1);
+    }
+  }
+
+  slap_SetRange(b, -1, 1);
+  slap_Copy(x, b);
+  EXPECT_EQ(slap_LUSolve(LU, piv.data(), x), SLAP_NO_ERROR);
+  slap_MatMulAdd(b, A, x, 1, -1);
+  EXPECT_LT(slap_NormInf(b), 1e-2);
+
+  // Transposed storage is factored without blocking
+  slap_Copy(slap_Transpose(LU), A);
+  std::vector<int> piv_t(n);
+  EXPECT_EQ(slap_LU(slap_Transpose(LU), piv_t.data()), SLAP_NO_ERROR);
+  EXPECT_LT(LUResidual(A, slap_Transpose(LU), piv_t.data()), 1e-3);
+
+  slap_FreeMatrix(&A);
+  slap_FreeMatrix(&LU);
+  slap_FreeMatrix(&b);
+  slap_FreeMatrix(&x);
+}
+
+// Random symmetric matrix with entries in [-0.5, 0.5]
+static void SetRandomSymmetric(Matrix A) {
+  int n = slap_NumRows(A);
+  for (int j = 0; j < n; ++j) {
+    for (int i = j; i < n; ++i) {
+      sfloat Aij = (sfloat)rand() / RAND_MAX - 0.5;
+      slap_SetElement(A, i, j, Aij);
+      slap_SetElement(A, j, i, Aij);
+    }
+  }
+}
+
+// KKT matrix [H A'; A -reg I] with H positive definite
+static void SetKKT(Matrix K, int nx, int nc, sfloat reg) {
+  Matrix H = slap_CreateSubMatrix(K, 0, 0, nx, nx);
+  Matrix A = slap_CreateSubMatrix(K, nx, 0, nc, nx);
+  Matrix At = slap_CreateSubMatrix(K, 0, nx, nx, nc);
+  Matrix R = slap_CreateSubMatrix(K, nx, nx, nc, nc);
+  Matrix G = slap_NewMatrix(nx, nx);
+  for (int i = 0; i < nx * nx; ++i) {
+    G.data[i] = (sfloat)rand() / RAND_MAX - 0.5;
+  }
+  slap_MatMulAdd(H, slap_Transpose(G), G, 1, 0);
+  slap_AddIdentity(H, 0.1);
+  for (int j = 0; j < nx; ++j) {
+    for (int i = 0; i < nc; ++i) {
+      slap_SetElement(A, i, j, (sfloat)rand() / RAND_MAX - 0.5);
+    }
+  }
+  slap_Copy(At, slap_Transpose(A));
+  slap_SetIdentity(R, -reg);
+  slap_FreeMatrix(&G);
+}
+
+// Solve K x = b with an LDLT factorization and return the residual
+static double LDLTResidual(Matrix K, int* piv, sfloat delta) {
+  int n = slap_NumRows(K);
+  Matrix LDL = slap_NewMatrix(n, n);
+  Matrix b = slap_NewMatrix(n, 2);
+  Matrix x = slap_NewMatrix(n, 2);
+  slap_Copy(LDL, K);
+  slap_SetRange(b, -1, 1);
+  slap_Copy(x, b);
+  EXPECT_EQ(slap_LDLT(LDL, piv, delta), SLAP_NO_ERROR);
+  EXPECT_EQ(slap_LDLTSolve(LDL, piv, x), SLAP_NO_ERROR);
+  slap_MatMulAdd(b, K, x, 1, -1);
+  double err = slap_NormInf(b);
+  slap_FreeMatrix(&LDL);
+  slap_FreeMatrix(&b);
+  slap_FreeMatrix(&x);
+  return err;
+}
+
+TEST(LDLT, Indefinite) {
+  const int n = 40;
+  Matrix A = slap_NewMatrix(n, n);
+  Matrix LDL = slap_NewMatrix(n, n);
+  srand(3);
+  SetRandomSymmetric(A);
+  std::vector<int> piv(n);
+  EXPECT_LT(LDLTResidual(A, piv.data(), 0), 1e-3);
+
+  // The strict upper triangle is untouched
+  slap_Copy(LDL, A);
+  slap_LDLT(LDL, piv.data(), 0);
+  for (int j = 1; j < n; ++j) {
+    for (int i = 0; i < j; ++i) {
+      EXPECT_EQ(*slap_GetElement(LDL, i, j), *slap_GetElement(A, i, j));
+    }
+  }
+
+  // Only reads the lower triangle, so transposed storage factors the upper triangle
+  Matrix b = slap_NewMatrix(n, 1);
+  Matrix x = slap_NewMatrix(n, 1);
+  slap_Copy(LDL, A);
+  slap_LDLT(slap_Transpose(LDL), piv.data(), 0);
+  slap_SetRange(b, -1, 1);
+  slap_Copy(x, b);
+  EXPECT_EQ(slap_LDLTSolve(slap_Transpose(LDL), piv.data(), x), SLAP_NO_ERROR);
+  slap_MatMulAdd(b, A, x, 1, -1);
+  EXPECT_LT(slap_NormInf(b), 1e-3);
+
+  slap_FreeMatrix(&A);
+  slap_FreeMatrix(&LDL);
+  slap_FreeMatrix(&b);
+  slap_FreeMatrix(&x);
+}
+
+TEST(LDLT, TwoByTwoPivots) {
+  // Zero diagonal, so every pivot is a 2x2 block
+  const int n = 6;
+  Matrix A = slap_NewMatrixZeros(n, n);
+  for (int i = 0; i < n - 1; ++i) {
+    slap_SetElement(A, i + 1, i, i + 1);
+    slap_SetElement(A, i, i + 1, i + 1);
+  }
+  int piv[n];
+  EXPECT_LT(LDLTResidual(A, piv, 0), 1e-4);
+  for (int k = 0; k < n; ++k) {
+    EXPECT_LT(piv[k], 0);
+  }
+
+  // Can't be factored without pivoting
+  Matrix LDL = slap_NewMatrix(n, n);
+  slap_Copy(LDL, A);
+  EXPECT_EQ(slap_LDLT(LDL, NULL, 0), SLAP_SINGULAR_MATRIX);
+  slap_FreeMatrix(&A);
+  slap_FreeMatrix(&LDL);
+}
+
+TEST(LDLT, QuasiDefiniteKKT) {
+  const int nx = 12;
+  const int nc = 5;
+  const int n = nx + nc;
+  Matrix K = slap_NewMatrix(n, n);
+  srand(4);
+  SetKKT(K, nx, nc, 1e-2);
+
+  // Quasi-definite, so it can be factored without pivoting
+  EXPECT_LT(LDLTResidual(K, NULL, 0), 1e-3);
+  Matrix LDL = slap_NewMatrix(n, n);
+  slap_Copy(LDL, K);
+  slap_LDLT(LDL, NULL, 0);
+  for (int k = 0; k < n; ++k) {
+    EXPECT_EQ(*slap_GetElement(LDL, k, k) > 0, k < nx);
+  }
+
+  // Matches Cholesky on the positive-definite block
+  Matrix H = slap_NewMatrix(nx, nx);
+  slap_Copy(H, slap_CreateSubMatrix(K, 0, 0, nx, nx));
+  slap_Cholesky(H);
+  for (int j = 0; j < nx; ++j) {
+    sfloat Ljj = *slap_GetElement(H, j, j);
+    EXPECT_NEAR(*slap_GetElement(LDL, j, j), Ljj * Ljj, 1e-4);
+    for (int i = j + 1; i < nx; ++i) {
+      EXPECT_NEAR(*slap_GetElement(LDL, i, j), *slap_GetElement(H, i, j) / Ljj, 1e-4);
+    }
+  }
+
+  // Without the regularization the (2,2) block is zero, and an empty constraint makes
+  // the matrix singular
+  SetKKT(K, nx, nc, 0);
+  for (int j = 0; j < nx; ++j) {
+    slap_SetElement(K, nx + 1, j, 0);
+    slap_SetElement(K, j, nx + 1, 0);
+  }
+  slap_Copy(LDL, K);
+  EXPECT_EQ(slap_LDLT(LDL, NULL, 0), SLAP_SINGULAR_MATRIX);
+  slap_Copy(LDL, K);
+  EXPECT_EQ(slap_LDLT(LDL, NULL, 1e-6), SLAP_NO_ERROR);
+  EXPECT_NEAR(*slap_GetElement(LDL, nx + 1, nx + 1), 1e-6, 1e-12);
+
+  slap_FreeMatrix(&K);
+  slap_FreeMatrix(&LDL);
+  slap_FreeMatrix(&H);
+}
+
 TEST_F(LinearAlgebraTest, TriBackSub) {
   enum slap_ErrorCode err;
   constexpr int n = 3;
@@ -145,6 +951,33 @@ TEST_F(LinearAlgebraTest, TriBackSub) {
   (void)x;
 }
 
+TEST_F(LinearAlgebraTest, TriSolveUpperAndTransposed) {
+  constexpr int n = 3;
+  sfloat Udata[n * n] = {2, 0, 0, 1, 3, 0, -1, 4, 5};
+  sfloat xdata[n] = {1, -2, 3};
+  sfloat bdata[n];
+  Matrix U = slap_UpperTri(slap_MatrixFromArray(n, n, Udata));
+  Matrix x = slap_MatrixFromArray(n, 1, xdata);
+  Matrix b = slap_MatrixFromArray(n, 1, bdata);
+
+  // U x = b
+  slap_MatMulAdd(b, U, x, 1, 0);
+  EXPECT_EQ(slap_TriSolve(U, b), SLAP_NO_ERROR);
+  EXPECT_LT(slap_NormedDifference(b, x), std::sqrt(EPS));
+
+  // L' x = b, as in slap_CholeskySolve()
+  sfloat Ldata[n * n] = {2, 1, -1, 0, 3, 4, 0, 0, 5};
+  Matrix Lt = slap_Transpose(slap_MatrixFromArray(n, n, Ldata));
+  slap_MatMulAdd(b, U, x, 1, 0);
+  EXPECT_EQ(slap_TriSolve(Lt, b), SLAP_NO_ERROR);
+  EXPECT_LT(slap_NormedDifference(b, x), std::sqrt(EPS));
+
+  // Transposed right-hand side
+  slap_MatMulAdd(b, U, x, 1, 0);
+  EXPECT_EQ(slap_TriSolve(U, slap_Transpose(slap_Reshape(b, 1, n))), SLAP_NO_ERROR);
+  EXPECT_LT(slap_NormedDifference(b, x), std::sqrt(EPS));
+}
+
 TEST_F(LinearAlgebraTest, CholeskySolve) {
   // Factorize a PSD matrix
   enum slap_ErrorCode err;
@@ -485,7 +1318,7 @@ TEST_F(QRDecompTest, QRDecomp_Square) {
   Matrix QR = slap_NewMatrix(m1, n1);
   slap_SetIdentity(I_m, 1.0);
 
-  slap_ComputeQ(Q, R1, beta1, Q_work);
+  slap_ComputeQ(Q, R1, beta1);
 
   // Check Q orthogonality (Q'Q = I)
   slap_MatMulAtB(Q_work, Q, Q);
@@ -518,7 +1351,7 @@ TEST_F(QRDecompTest, QRDecomp_Skinny) {
   Matrix QR = slap_NewMatrix(m2, n2);
   slap_SetIdentity(I_m, 1.0);
 
-  slap_ComputeQ(Q, R2, beta2, Q_work);
+  slap_ComputeQ(Q, R2, beta2);
 
   // Check Q orthogonality (Q'Q = I)
   slap_MatMulAtB(Q_work, Q, Q);
@@ -569,3 +1402,1598 @@ TEST_F(QRDecompTest, QRDecomp_LeastSquaresFunction) {
   sfloat err = slap_NormedDifference(x, x_ans);
   EXPECT_LT(err, std::sqrt(EPS));
 }
+
+TEST(QRBlocked, LargeMatrix) {
+  // Spans several panels, with a partial panel at the end
+  const int m = 2 * SLAP_QR_THRESHOLD + 11;
+  const int n = SLAP_QR_THRESHOLD + SLAP_QR_BLOCK_SIZE + 3;
+  Matrix A = slap_NewMatrix(m, n);
+  Matrix R = slap_NewMatrix(m, n);
+  Matrix betas = slap_NewMatrix(m, 1);
+  Matrix temp = slap_NewMatrix(m, 1);
+  Matrix Q = slap_NewMatrix(m, m);
+  Matrix QtQ = slap_NewMatrix(m, m);
+  Matrix QR = slap_NewMatrix(m, n);
+  slap_SetRange(A, -1, 1);
+  for (int i = 0; i < n; ++i) {
+    *slap_GetElement(A, i, i) += 2;
+  }
+  slap_Copy(R, A);
+  EXPECT_EQ(slap_QR(R, betas, temp), SLAP_NO_ERROR);
+
+  // Q is orthogonal
+  EXPECT_EQ(slap_ComputeQ(Q, R, betas), SLAP_NO_ERROR);
+  slap_MatMulAdd(QtQ, slap_Transpose(Q), Q, 1, 0);
+  slap_AddIdentity(QtQ, -1);
+  EXPECT_LT(slap_NormOne(QtQ), 1e-3);
+
+  // Q' A = R, computed with and without forming Q
+  slap_Copy(QR, A);
+  EXPECT_EQ(slap_ApplyQt(R, betas, QR), SLAP_NO_ERROR);
+  Matrix Rtri = slap_NewMatrix(m, n);
+  slap_Copy(Rtri, R);
+  for (int j = 0; j < n; ++j) {
+    for (int i = j + 1; i < m; ++i) {
+      slap_SetElement(Rtri, i, j, 0);
+    }
+  }
+  EXPECT_LT(slap_NormedDifference(QR, Rtri), 1e-3);
+
+  // Q R = A, with a transposed output
+  Matrix RtriT = slap_NewMatrix(n, m);
+  slap_Copy(slap_Transpose(RtriT), Rtri);
+  EXPECT_EQ(slap_ApplyQ(R, betas, slap_Transpose(RtriT)), SLAP_NO_ERROR);
+  slap_Copy(QR, slap_Transpose(RtriT));
+  EXPECT_LT(slap_NormedDifference(QR, A), 1e-3);
+
+  // Thin Q
+  Matrix Q1 = slap_NewMatrix(m, n);
+  EXPECT_EQ(slap_ComputeQ(Q1, R, betas), SLAP_NO_ERROR);
+  EXPECT_LT(slap_NormedDifference(Q1, slap_CreateSubMatrix(Q, 0, 0, m, n)), 1e-6);
+
+  // Single right-hand side takes the unblocked path
+  Matrix b = slap_NewMatrix(m, 1);
+  Matrix x = slap_NewMatrix(m, 1);
+  slap_SetRange(b, -1, 2);
+  slap_Copy(x, b);
+  slap_ApplyQt(R, betas, x);
+  slap_ApplyQ(R, betas, x);
+  EXPECT_LT(slap_NormedDifference(x, b), 1e-3);
+
+  slap_FreeMatrix(&A);
+  slap_FreeMatrix(&R);
+  slap_FreeMatrix(&betas);
+  slap_FreeMatrix(&temp);
+  slap_FreeMatrix(&Q);
+  slap_FreeMatrix(&QtQ);
+  slap_FreeMatrix(&QR);
+  slap_FreeMatrix(&Rtri);
+  slap_FreeMatrix(&RtriT);
+  slap_FreeMatrix(&Q1);
+  slap_FreeMatrix(&b);
+  slap_FreeMatrix(&x);
+}
+
+// Least squares solution using rows [r0, r1) of A and b
+static void SolveRows(Matrix A, Matrix b, int r0, int r1, Matrix x) {
+  int n = slap_NumCols(A);
+  Matrix Ai = slap_NewMatrix(r1 - r0, n);
+  Matrix bi = slap_NewMatrix(r1 - r0, 1);
+  Matrix betas = slap_NewMatrix(r1 - r0, 1);
+  Matrix temp = slap_NewMatrix(r1 - r0, 1);
+  slap_Copy(Ai, slap_CreateSubMatrix(A, r0, 0, r1 - r0, n));
+  slap_Copy(bi, slap_CreateSubMatrix(b, r0, 0, r1 - r0, 1));
+  slap_LeastSquares(Ai, bi, betas, temp);
+  slap_Copy(x, slap_CreateSubMatrix(bi, 0, 0, n, 1));
+  slap_FreeMatrix(&Ai);
+  slap_FreeMatrix(&bi);
+  slap_FreeMatrix(&betas);
+  slap_FreeMatrix(&temp);
+}
+
+TEST(QRUpdate, SlidingWindow) {
+  const int m = 40;
+  const int n = 6;
+  const int window = 15;
+  Matrix A = slap_NewMatrix(m, n);
+  Matrix b = slap_NewMatrix(m, 1);
+  srand(6);
+  for (int i = 0; i < m * n; ++i) {
+    A.data[i] = (sfloat)rand() / RAND_MAX - 0.5;
+  }
+  for (int i = 0; i < m; ++i) {
+    b.data[i] = (sfloat)rand() / RAND_MAX - 0.5;
+  }
+
+  // Factor the first window
+  Matrix R = slap_NewMatrix(window, n);
+  Matrix Qtb = slap_NewMatrix(window, 1);
+  Matrix betas = slap_NewMatrix(window, 1);
+  Matrix temp = slap_NewMatrix(window, 1);
+  slap_Copy(R, slap_CreateSubMatrix(A, 0, 0, window, n));
+  slap_Copy(Qtb, slap_CreateSubMatrix(b, 0, 0, window, 1));
+  slap_QR(R, betas, temp);
+  slap_Qtb(R, betas, Qtb);
+
+  // Slide it to the end, one row at a time
+  Matrix row = slap_NewMatrix(1, n);
+  Matrix b_row = slap_NewMatrix(1, 1);
+  Matrix x = slap_NewMatrix(n, 1);
+  Matrix x_ans = slap_NewMatrix(n, 1);
+  for (int i = window; i < m; ++i) {
+    slap_Copy(row, slap_CreateSubMatrix(A, i, 0, 1, n));
+    slap_Copy(b_row, slap_CreateSubMatrix(b, i, 0, 1, 1));
+    EXPECT_EQ(slap_QRAddRow(R, Qtb, row, b_row), SLAP_NO_ERROR);
+
+    // The row can also be a column vector
+    Matrix row_t = slap_NewMatrix(n, 1);
+    slap_Copy(row_t, slap_Transpose(slap_CreateSubMatrix(A, i - window, 0, 1, n)));
+    slap_Copy(b_row, slap_CreateSubMatrix(b, i - window, 0, 1, 1));
+    EXPECT_EQ(slap_QRDeleteRow(R, Qtb, row_t, b_row), SLAP_NO_ERROR);
+    slap_FreeMatrix(&row_t);
+
+    slap_Copy(x, slap_CreateSubMatrix(Qtb, 0, 0, n, 1));
+    slap_TriSolve(slap_UpperTri(slap_CreateSubMatrix(R, 0, 0, n, n)), x);
+    SolveRows(A, b, i - window + 1, i + 1, x_ans);
+    EXPECT_LT(slap_NormedDifference(x, x_ans), 1e-3);
+  }
+
+  // Deleting rows until the problem is underdetermined
+  Matrix Rn = slap_CreateSubMatrix(R, 0, 0, n, n);
+  enum slap_ErrorCode err = SLAP_NO_ERROR;
+  for (int i = m - window; i < m && err == SLAP_NO_ERROR; ++i) {
+    slap_Copy(row, slap_CreateSubMatrix(A, i, 0, 1, n));
+    err = slap_QRDeleteRow(Rn, slap_NullMatrix(), row, slap_NullMatrix());
+  }
+  EXPECT_EQ(err, SLAP_SINGULAR_MATRIX);
+
+  slap_FreeMatrix(&A);
+  slap_FreeMatrix(&b);
+  slap_FreeMatrix(&R);
+  slap_FreeMatrix(&Qtb);
+  slap_FreeMatrix(&betas);
+  slap_FreeMatrix(&temp);
+  slap_FreeMatrix(&row);
+  slap_FreeMatrix(&b_row);
+  slap_FreeMatrix(&x);
+  slap_FreeMatrix(&x_ans);
+}
+
+TEST(QRUpdate, FromZero) {
+  // Streaming least squares, starting from an empty problem
+  const int m = 12;
+  const int n = 4;
+  Matrix A = slap_NewMatrix(m, n);
+  Matrix b = slap_NewMatrix(m, 1);
+  srand(13);
+  for (int i = 0; i < m * n; ++i) {
+    A.data[i] = (sfloat)rand() / RAND_MAX - 0.5;
+  }
+  for (int i = 0; i < m; ++i) {
+    b.data[i] = (sfloat)rand() / RAND_MAX - 0.5;
+  }
+  Matrix R = slap_NewMatrix(n, n);
+  Matrix Qtb = slap_NewMatrix(n, 1);
+  Matrix row = slap_NewMatrix(1, n);
+  Matrix b_row = slap_NewMatrix(1, 1);
+  slap_SetConst(R, 0);
+  slap_SetConst(Qtb, 0);
+  for (int i = 0; i < m; ++i) {
+    slap_Copy(row, slap_CreateSubMatrix(A, i, 0, 1, n));
+    slap_Copy(b_row, slap_CreateSubMatrix(b, i, 0, 1, 1));
+    EXPECT_EQ(slap_QRAddRow(R, Qtb, row, b_row), SLAP_NO_ERROR);
+  }
+
+  // Same as factoring all of the rows at once, up to the sign of each row of R
+  Matrix QR = slap_NewMatrix(m, n);
+  Matrix Qtb_ans = slap_NewMatrix(m, 1);
+  Matrix betas = slap_NewMatrix(m, 1);
+  Matrix temp = slap_NewMatrix(m, 1);
+  slap_Copy(QR, A);
+  slap_Copy(Qtb_ans, b);
+  slap_QR(QR, betas, temp);
+  slap_Qtb(QR, betas, Qtb_ans);
+  for (int i = 0; i < n; ++i) {
+    sfloat sign = *slap_GetElement(QR, i, i) * *slap_GetElement(R, i, i) < 0 ? -1 : 1;
+    for (int j = i; j < n; ++j) {
+      EXPECT_NEAR(*slap_GetElement(R, i, j), sign * *slap_GetElement(QR, i, j), 1e-4);
+    }
+    EXPECT_NEAR(Qtb.data[i], sign * Qtb_ans.data[i], 1e-4);
+  }
+
+  slap_FreeMatrix(&A);
+  slap_FreeMatrix(&b);
+  slap_FreeMatrix(&R);
+  slap_FreeMatrix(&Qtb);
+  slap_FreeMatrix(&row);
+  slap_FreeMatrix(&b_row);
+  slap_FreeMatrix(&QR);
+  slap_FreeMatrix(&Qtb_ans);
+  slap_FreeMatrix(&betas);
+  slap_FreeMatrix(&temp);
+}
+
+TEST(QRBlocked, LeastSquares) {
+  const int m = 3 * SLAP_QR_THRESHOLD;
+  const int n = SLAP_QR_THRESHOLD + 1;
+  Matrix A = slap_NewMatrix(m, n);
+  Matrix QR = slap_NewMatrix(m, n);
+  Matrix x = slap_NewMatrix(n, 2);
+  Matrix b = slap_NewMatrix(m, 2);
+  Matrix betas = slap_NewMatrix(m, 1);
+  Matrix temp = slap_NewMatrix(m, 1);
+  slap_SetRange(A, -1, 1);
+  for (int i = 0; i < n; ++i) {
+    *slap_GetElement(A, i, i) += 5;
+  }
+  slap_SetRange(x, 1, 2);
+  slap_MatMulAdd(b, A, x, 1, 0);
+  slap_Copy(QR, A);
+  EXPECT_EQ(slap_LeastSquares(QR, b, betas, temp), SLAP_NO_ERROR);
+  Matrix x_ls = slap_CreateSubMatrix(b, 0, 0, n, 2);
+  for (int j = 0; j < 2; ++j) {
+    for (int i = 0; i < n; ++i) {
+      EXPECT_NEAR(*slap_GetElement(x_ls, i, j), *slap_GetElement(x, i, j), 1e-3);
+    }
+  }
+
+  slap_FreeMatrix(&A);
+  slap_FreeMatrix(&QR);
+  slap_FreeMatrix(&x);
+  slap_FreeMatrix(&b);
+  slap_FreeMatrix(&betas);
+  slap_FreeMatrix(&temp);
+}
+
+// Random values for the elements within the first ku super-diagonals of a band matrix
+static void SetRandomBand(Matrix A, int ku) {
+  for (int j = 0; j < slap_NumCols(A); ++j) {
+    for (int i = 0; i < slap_NumRows(A); ++i) {
+      sfloat* Aij = slap_BandElement(A, i, j);
+      if (Aij && j - i <= ku) {
+        *Aij = (sfloat)rand() / RAND_MAX - 0.5;
+      }
+    }
+  }
+}
+
+TEST(Band, MatMulAdd) {
+  const int m = 9;
+  const int n = 7;
+  const int p = 3;
+  Matrix A = slap_NewBandMatrix(m, n, 2, 1);
+  Matrix A_dense = slap_NewMatrix(m, n);
+  srand(3);
+  SetRandomBand(A, A.ku);
+  EXPECT_EQ(slap_BandElement(A, 3, 0), nullptr);
+  EXPECT_EQ(slap_BandElement(A, 0, 2), nullptr);
+  EXPECT_EQ(slap_BandElement(slap_Transpose(A), 1, 0), slap_BandElement(A, 0, 1));
+  slap_BandToDense(A_dense, A);
+
+  for (Matrix Ai : {A, slap_Transpose(A)}) {
+    Matrix Ai_dense = slap_IsTransposed(Ai) ? slap_Transpose(A_dense) : A_dense;
+    Matrix B = slap_NewMatrix(slap_NumCols(Ai), p);
+    Matrix C = slap_NewMatrix(slap_NumRows(Ai), p);
+    Matrix C_ans = slap_NewMatrix(slap_NumRows(Ai), p);
+    slap_SetRange(B, -1, 1);
+    slap_SetRange(C, 0, 2);
+    slap_Copy(C_ans, C);
+    EXPECT_EQ(slap_MatMulAdd(C, Ai, B, 0.5, 2), SLAP_NO_ERROR);
+    slap_MatMulAdd(C_ans, Ai_dense, B, 0.5, 2);
+    EXPECT_LT(slap_NormedDifference(C, C_ans), 1e-4);
+
+    // Strided and transposed B
+    Matrix parent = slap_NewMatrix(p + 2, slap_NumCols(Ai));
+    Matrix Bt = slap_Transpose(slap_CreateSubMatrix(parent, 1, 0, p, slap_NumCols(Ai)));
+    slap_Copy(Bt, B);
+    EXPECT_EQ(slap_MatMulAdd(C, Ai, Bt, 1, 0), SLAP_NO_ERROR);
+    slap_MatMulAdd(C_ans, Ai_dense, B, 1, 0);
+    EXPECT_LT(slap_NormedDifference(C, C_ans), 1e-4);
+
+    slap_FreeMatrix(&B);
+    slap_FreeMatrix(&C);
+    slap_FreeMatrix(&C_ans);
+    slap_FreeMatrix(&parent);
+  }
+
+  // Band matrices are only supported as the first factor, or in sums with the same band
+  Matrix D = slap_NewMatrix(n, n);
+  Matrix sum_dense = slap_NewMatrix(m, n);
+  Matrix A2 = slap_NewBandMatrix(m, n, 2, 1);
+  Matrix A3 = slap_NewBandMatrix(m, n, 1, 1);
+  slap_Copy(A2, A);
+  EXPECT_EQ(slap_MatrixAddition(A2, A2, A, 1), SLAP_NO_ERROR);
+  slap_BandToDense(sum_dense, A2);
+  slap_ScaleByConst(A_dense, 2);
+  EXPECT_LT(slap_NormedDifference(sum_dense, A_dense), 1e-6);
+  if (slap_AssertionsEnabled()) {
+    EXPECT_EQ(slap_MatMulAdd(D, slap_Transpose(A_dense), A, 1, 0), SLAP_INVALID_MATRIX);
+    EXPECT_EQ(slap_MatMulAdd(A, A_dense, D, 1, 0), SLAP_INVALID_MATRIX);
+    EXPECT_EQ(slap_MatrixAddition(A3, A3, A, 1), SLAP_INVALID_MATRIX);
+    EXPECT_EQ(slap_MatrixAddition(A_dense, A_dense, A, 1), SLAP_INVALID_MATRIX);
+  }
+  slap_FreeMatrix(&D);
+  slap_FreeMatrix(&sum_dense);
+  slap_FreeMatrix(&A2);
+  slap_FreeMatrix(&A3);
+  slap_FreeMatrix(&A);
+  slap_FreeMatrix(&A_dense);
+}
+
+TEST(Band, TriSolve) {
+  const int n = 12;
+  Matrix L = slap_NewBandMatrix(n, n, 3, 1);
+  Matrix L_dense = slap_NewMatrix(n, n);
+  Matrix x = slap_NewMatrix(n, 2);
+  Matrix x_ans = slap_NewMatrix(n, 2);
+  srand(4);
+  SetRandomBand(L, L.ku);
+  for (int i = 0; i < n; ++i) {
+    *slap_BandElement(L, i, i) += 2;
+  }
+  // The super-diagonal is ignored
+  slap_BandToDense(L_dense, L);
+  slap_MakeLowerTri(L_dense);
+
+  for (bool transpose : {false, true}) {
+    Matrix Li = transpose ? slap_Transpose(L) : L;
+    Matrix Li_dense = transpose ? slap_Transpose(L_dense) : L_dense;
+    slap_SetRange(x, -1, 1);
+    slap_Copy(x_ans, x);
+    EXPECT_EQ(slap_TriSolve(Li, x), SLAP_NO_ERROR);
+    slap_TriSolve(Li_dense, x_ans);
+    EXPECT_LT(slap_NormedDifference(x, x_ans), 1e-4);
+  }
+
+  slap_FreeMatrix(&L);
+  slap_FreeMatrix(&L_dense);
+  slap_FreeMatrix(&x);
+  slap_FreeMatrix(&x_ans);
+}
+
+TEST(Band, CholeskySolve) {
+  const int n = 40;
+  const int kd = 3;
+  Matrix A = slap_NewBandMatrix(n, n, kd, 0);
+  Matrix A_dense = slap_NewMatrix(n, n);
+  Matrix b = slap_NewMatrix(n, 2);
+  Matrix x = slap_NewMatrix(n, 2);
+  srand(5);
+  SetRandomBand(A, 0);
+  for (int i = 0; i < n; ++i) {
+    *slap_BandElement(A, i, i) = 2 * kd;
+  }
+  slap_BandToDense(A_dense, A);
+  for (int j = 0; j < n; ++j) {
+    for (int i = j + 1; i < n; ++i) {
+      slap_SetElement(A_dense, j, i, *slap_GetElement(A_dense, i, j));
+    }
+  }
+
+  int fail_col = 0;
+  EXPECT_EQ(slap_CholeskyInfo(A, &fail_col), SLAP_NO_ERROR);
+  EXPECT_EQ(fail_col, -1);
+  slap_SetRange(b, -1, 1);
+  slap_Copy(x, b);
+  EXPECT_EQ(slap_CholeskySolve(A, x), SLAP_NO_ERROR);
+  slap_MatMulAdd(b, A_dense, x, 1, -1);
+  EXPECT_LT(slap_NormInf(b), 1e-4);
+
+  // Not positive definite
+  slap_SetConst(A, 0);
+  for (int i = 0; i < n; ++i) {
+    *slap_BandElement(A, i, i) = i == 17 ? -1 : 1;
+  }
+  EXPECT_EQ(slap_CholeskyInfo(A, &fail_col), SLAP_CHOLESKY_FAIL);
+  EXPECT_EQ(fail_col, 17);
+
+  slap_FreeMatrix(&A);
+  slap_FreeMatrix(&A_dense);
+  slap_FreeMatrix(&b);
+  slap_FreeMatrix(&x);
+}
+
+TEST(Band, LUSolve) {
+  const int n = 30;
+  const int kl = 2;
+  const int ku = 1;
+  // Room for the fill-in from the row swaps
+  Matrix A = slap_NewBandMatrix(n, n, kl, kl + ku);
+  Matrix A_dense = slap_NewMatrix(n, n);
+  Matrix b = slap_NewMatrix(n, 3);
+  Matrix x = slap_NewMatrix(n, 3);
+  srand(6);
+  SetRandomBand(A, ku);
+  slap_BandToDense(A_dense, A);
+
+  int piv[n];
+  EXPECT_EQ(slap_LU(A, piv), SLAP_NO_ERROR);
+  int num_swaps = 0;
+  for (int k = 0; k < n; ++k) {
+    EXPECT_GE(piv[k], k);
+    EXPECT_LE(piv[k], k + kl);
+    num_swaps += piv[k] != k;
+  }
+  EXPECT_GT(num_swaps, 0);
+  slap_SetRange(b, -1, 1);
+  slap_Copy(x, b);
+  EXPECT_EQ(slap_LUSolve(A, piv, x), SLAP_NO_ERROR);
+  slap_MatMulAdd(b, A_dense, x, 1, -1);
+  EXPECT_LT(slap_NormInf(b), 1e-4);
+
+  // Zero column
+  slap_SetConst(A, 0);
+  SetRandomBand(A, ku);
+  for (int i = 0; i < n; ++i) {
+    sfloat* Ai5 = slap_BandElement(A, i, 5);
+    if (Ai5) {
+      *Ai5 = 0;
+    }
+  }
+  EXPECT_EQ(slap_LU(A, piv), SLAP_SINGULAR_MATRIX);
+
+  slap_FreeMatrix(&A);
+  slap_FreeMatrix(&A_dense);
+  slap_FreeMatrix(&b);
+  slap_FreeMatrix(&x);
+}
+
+static void DiagonalToDense(Matrix dense, Matrix D) {
+  slap_SetConst(dense, 0);
+  slap_SetDiagonal(dense, D.data, slap_NumRows(D));
+}
+
+TEST(Diagonal, MatMulAdd) {
+  const int n = 6;
+  const int m = 4;
+  sfloat d[n] = {1.5, -2, 3, 0.5, 4, -1};
+  Matrix D = slap_DiagonalFromArray(n, d);
+  Matrix D_dense = slap_NewMatrix(n, n);
+  DiagonalToDense(D_dense, D);
+  Matrix B = slap_NewMatrix(n, m);
+  Matrix C = slap_NewMatrix(n, m);
+  Matrix C_ans = slap_NewMatrix(n, m);
+  slap_SetRange(B, -1, 1);
+
+  // Scale the rows, with a regular and transposed diagonal
+  for (Matrix Di : {D, slap_Transpose(D)}) {
+    slap_SetRange(C, 0, 2);
+    slap_Copy(C_ans, C);
+    EXPECT_EQ(slap_MatMulAdd(C, Di, B, 0.5, 2), SLAP_NO_ERROR);
+    slap_MatMulAdd(C_ans, D_dense, B, 0.5, 2);
+    EXPECT_LT(slap_NormedDifference(C, C_ans), 1e-6);
+  }
+
+  // Scale the columns of a transposed matrix
+  Matrix Ct = slap_NewMatrix(m, n);
+  Matrix Ct_ans = slap_NewMatrix(m, n);
+  slap_SetRange(Ct, 0, 2);
+  slap_Copy(Ct_ans, Ct);
+  EXPECT_EQ(slap_MatMulAdd(Ct, slap_Transpose(B), D, -1, 1), SLAP_NO_ERROR);
+  slap_MatMulAdd(Ct_ans, slap_Transpose(B), D_dense, -1, 1);
+  EXPECT_LT(slap_NormedDifference(Ct, Ct_ans), 1e-6);
+
+  // Product of diagonals, into a dense and a diagonal matrix
+  Matrix DD = slap_NewMatrix(n, n);
+  Matrix DD_ans = slap_NewMatrix(n, n);
+  EXPECT_EQ(slap_MatMulAdd(DD, D, D, 1, 0), SLAP_NO_ERROR);
+  slap_MatMulAdd(DD_ans, D_dense, D_dense, 1, 0);
+  EXPECT_LT(slap_NormedDifference(DD, DD_ans), 1e-6);
+  sfloat e[n] = {1, 1, 1, 1, 1, 1};
+  Matrix E = slap_DiagonalFromArray(n, e);
+  EXPECT_EQ(slap_MatMulAdd(E, D, D, 2, -1), SLAP_NO_ERROR);
+  for (int k = 0; k < n; ++k) {
+    EXPECT_DOUBLE_EQ(e[k], 2 * d[k] * d[k] - 1);
+  }
+
+  slap_FreeMatrix(&D_dense);
+  slap_FreeMatrix(&B);
+  slap_FreeMatrix(&C);
+  slap_FreeMatrix(&C_ans);
+  slap_FreeMatrix(&Ct);
+  slap_FreeMatrix(&Ct_ans);
+  slap_FreeMatrix(&DD);
+  slap_FreeMatrix(&DD_ans);
+}
+
+TEST(Diagonal, Addition) {
+  const int n = 5;
+  Matrix D = slap_NewDiagonalMatrix(n);
+  Matrix D_dense = slap_NewMatrix(n, n);
+  Matrix A = slap_NewMatrix(n, n);
+  Matrix C = slap_NewMatrix(n, n);
+  Matrix C_ans = slap_NewMatrix(n, n);
+  for (int k = 0; k < n; ++k) {
+    D.data[k] = 1 + k;
+  }
+  DiagonalToDense(D_dense, D);
+  slap_SetRange(A, -1, 1);
+
+  EXPECT_EQ(slap_MatrixAddition(C, A, D, -2), SLAP_NO_ERROR);
+  slap_MatrixAddition(C_ans, A, D_dense, -2);
+  EXPECT_LT(slap_NormedDifference(C, C_ans), 1e-6);
+
+  // Aliased with the dense input
+  slap_Copy(C, A);
+  EXPECT_EQ(slap_MatrixAddition(C, D, C, 3), SLAP_NO_ERROR);
+  slap_MatrixAddition(C_ans, D_dense, A, 3);
+  EXPECT_LT(slap_NormedDifference(C, C_ans), 1e-6);
+
+  // Sum of diagonals
+  Matrix D2 = slap_NewDiagonalMatrix(n);
+  slap_Copy(D2, D);
+  EXPECT_EQ(slap_MatrixAddition(C, D, D2, 1), SLAP_NO_ERROR);
+  slap_MatrixAddition(C_ans, D_dense, D_dense, 1);
+  EXPECT_LT(slap_NormedDifference(C, C_ans), 1e-6);
+  EXPECT_EQ(slap_MatrixAddition(D2, D2, D, -1), SLAP_NO_ERROR);
+  for (int k = 0; k < n; ++k) {
+    EXPECT_DOUBLE_EQ(D2.data[k], 0);
+  }
+
+  slap_FreeMatrix(&D);
+  slap_FreeMatrix(&D2);
+  slap_FreeMatrix(&D_dense);
+  slap_FreeMatrix(&A);
+  slap_FreeMatrix(&C);
+  slap_FreeMatrix(&C_ans);
+}
+
+TEST(Diagonal, NormsAndIdentity) {
+  const int n = 8;
+  Matrix A = slap_NewDiagonalMatrix(n);
+  Matrix B = slap_NewDiagonalMatrix(n);
+  Matrix A_dense = slap_NewMatrix(n, n);
+  Matrix B_dense = slap_NewMatrix(n, n);
+  for (int k = 0; k < n; ++k) {
+    A.data[k] = k - 2.5;
+    B.data[k] = 0.5 * k;
+  }
+  DiagonalToDense(A_dense, A);
+  DiagonalToDense(B_dense, B);
+
+  // Only the stored diagonals are read
+  EXPECT_NEAR(slap_NormedDifference(A, B), slap_NormedDifference(A_dense, B_dense), 1e-5);
+  EXPECT_NEAR(slap_NormTwo(A), slap_NormTwo(A_dense), 1e-5);
+  EXPECT_NEAR(slap_NormOne(A), slap_NormOne(A_dense), 1e-5);
+  EXPECT_NEAR(slap_NormInf(A), slap_NormInf(A_dense), 1e-5);
+  EXPECT_NEAR(slap_Sum(A), slap_Sum(A_dense), 1e-5);
+
+  slap_AddIdentity(A, 2);
+  slap_AddIdentity(A_dense, 2);
+  EXPECT_NEAR(slap_NormTwo(A), slap_NormTwo(A_dense), 1e-5);
+  slap_SetIdentity(B, 3);
+  for (int k = 0; k < n; ++k) {
+    EXPECT_EQ(B.data[k], 3);
+  }
+  if (slap_AssertionsEnabled()) {
+    EXPECT_TRUE(std::isnan(slap_NormedDifference(A, A_dense)));
+    EXPECT_EQ(slap_SetRange(A, 0, 1), SLAP_INVALID_MATRIX);
+  }
+
+  slap_FreeMatrix(&A);
+  slap_FreeMatrix(&B);
+  slap_FreeMatrix(&A_dense);
+  slap_FreeMatrix(&B_dense);
+}
+
+TEST(Diagonal, QuadraticFormAndCholesky) {
+  const int n = 7;
+  Matrix D = slap_NewDiagonalMatrix(n);
+  Matrix D_dense = slap_NewMatrix(n, n);
+  Matrix x = slap_NewMatrix(n, 2);
+  Matrix b = slap_NewMatrix(n, 2);
+  for (int k = 0; k < n; ++k) {
+    D.data[k] = 0.5 + k;
+  }
+  DiagonalToDense(D_dense, D);
+  slap_SetRange(b, -1, 1);
+
+  Matrix x0 = slap_CreateSubMatrix(b, 0, 0, n, 1);
+  Matrix y0 = slap_CreateSubMatrix(b, 0, 1, n, 1);
+  EXPECT_NEAR(slap_QuadraticForm(y0, D, x0), slap_QuadraticForm(y0, D_dense, x0), 1e-6);
+
+  int fail_col = 0;
+  EXPECT_EQ(slap_CholeskyInfo(D, &fail_col), SLAP_NO_ERROR);
+  EXPECT_EQ(fail_col, -1);
+  slap_Copy(x, b);
+  EXPECT_EQ(slap_CholeskySolve(D, x), SLAP_NO_ERROR);
+  slap_MatMulAdd(b, D_dense, x, 1, -1);
+  EXPECT_LT(slap_NormInf(b), 1e-6);
+
+  D.data[3] = -1;
+  EXPECT_EQ(slap_CholeskyInfo(D, &fail_col), SLAP_CHOLESKY_FAIL);
+  EXPECT_EQ(fail_col, 3);
+
+  slap_FreeMatrix(&D);
+  slap_FreeMatrix(&D_dense);
+  slap_FreeMatrix(&x);
+  slap_FreeMatrix(&b);
+}
+
+static void SetRandomSPD(Matrix A) {
+  int n = slap_NumRows(A);
+  Matrix G = slap_NewMatrix(n, n);
+  for (int i = 0; i < n * n; ++i) {
+    G.data[i] = (sfloat)rand() / RAND_MAX - 0.5;
+  }
+  slap_MatMulAdd(A, G, slap_Transpose(G), 1, 0);
+  slap_AddIdentity(A, 0.5);
+  slap_FreeMatrix(&G);
+}
+
+TEST(Packed, MatMulAddAndQuadraticForm) {
+  const int n = 11;
+  const int m = 3;
+  Matrix A = slap_NewMatrix(n, n);
+  Matrix P = slap_NewPackedMatrix(n);
+  Matrix A_dense = slap_NewMatrix(n, n);
+  srand(7);
+  SetRandomSymmetric(A);
+  EXPECT_EQ(slap_PackedFromDense(P, A), SLAP_NO_ERROR);
+  EXPECT_EQ(slap_PackedToDense(A_dense, P), SLAP_NO_ERROR);
+  EXPECT_LT(slap_NormedDifference(A, A_dense), 1e-6);
+  EXPECT_EQ(slap_PackedElement(P, 2, 5), slap_PackedElement(P, 5, 2));
+  EXPECT_EQ(slap_PackedElement(P, n, 0), nullptr);
+  EXPECT_EQ(*slap_PackedElement(P, 1, 0), P.data[1]);
+  EXPECT_EQ(*slap_PackedElement(P, 1, 1), P.data[n]);
+
+  Matrix B = slap_NewMatrix(n, m);
+  Matrix C = slap_NewMatrix(n, m);
+  Matrix C_ans = slap_NewMatrix(n, m);
+  slap_SetRange(B, -1, 1);
+  slap_SetRange(C, 0, 2);
+  slap_Copy(C_ans, C);
+  EXPECT_EQ(slap_MatMulAdd(C, P, B, 0.5, -1), SLAP_NO_ERROR);
+  slap_MatMulAdd(C_ans, A, B, 0.5, -1);
+  EXPECT_LT(slap_NormedDifference(C, C_ans), 1e-4);
+
+  // Strided and transposed B and C
+  Matrix parent = slap_NewMatrix(2 * m + 1, n);
+  Matrix Bt = slap_Transpose(slap_CreateSubMatrix(parent, 0, 0, m, n));
+  Matrix Ct = slap_Transpose(slap_CreateSubMatrix(parent, m + 1, 0, m, n));
+  slap_Copy(Bt, B);
+  EXPECT_EQ(slap_MatMulAdd(Ct, slap_Transpose(P), Bt, 1, 0), SLAP_NO_ERROR);
+  slap_MatMulAdd(C_ans, A, B, 1, 0);
+  EXPECT_LT(slap_NormedDifference(Ct, C_ans), 1e-4);
+
+  Matrix x = slap_CreateSubMatrix(B, 0, 0, n, 1);
+  Matrix y = slap_CreateSubMatrix(B, 0, 1, n, 1);
+  EXPECT_NEAR(slap_QuadraticForm(y, P, x), slap_QuadraticForm(y, A, x), 1e-4);
+
+  // Sums of packed matrices, which can't be the second factor of a product
+  Matrix P2 = slap_NewPackedMatrix(n);
+  Matrix A2 = slap_NewMatrix(n, n);
+  slap_Copy(P2, P);
+  EXPECT_EQ(slap_MatrixAddition(P2, P2, P, -3), SLAP_NO_ERROR);
+  slap_PackedToDense(A2, P2);
+  slap_MatrixAddition(A_dense, A, A, -3);
+  EXPECT_LT(slap_NormedDifference(A2, A_dense), 1e-4);
+  if (slap_AssertionsEnabled()) {
+    EXPECT_EQ(slap_MatMulAdd(A2, A, P, 1, 0), SLAP_INVALID_MATRIX);
+    EXPECT_EQ(slap_MatMulAdd(P2, A, A, 1, 0), SLAP_INVALID_MATRIX);
+    EXPECT_EQ(slap_MatrixAddition(A2, A, P, 1), SLAP_INVALID_MATRIX);
+  }
+  slap_FreeMatrix(&P2);
+  slap_FreeMatrix(&A2);
+
+  slap_FreeMatrix(&A);
+  slap_FreeMatrix(&P);
+  slap_FreeMatrix(&A_dense);
+  slap_FreeMatrix(&B);
+  slap_FreeMatrix(&C);
+  slap_FreeMatrix(&C_ans);
+  slap_FreeMatrix(&parent);
+}
+
+TEST(Packed, CholeskySolve) {
+  const int n = 20;
+  Matrix A = slap_NewMatrix(n, n);
+  Matrix L = slap_NewMatrix(n, n);
+  Matrix P = slap_NewPackedMatrix(n);
+  Matrix L_packed = slap_NewMatrix(n, n);
+  Matrix b = slap_NewMatrix(n, 2);
+  Matrix x = slap_NewMatrix(n, 2);
+  srand(8);
+  SetRandomSPD(A);
+  slap_PackedFromDense(P, A);
+  slap_Copy(L, A);
+  slap_Cholesky(L);
+  slap_MakeLowerTri(L);
+
+  int fail_col = 0;
+  EXPECT_EQ(slap_CholeskyInfo(P, &fail_col), SLAP_NO_ERROR);
+  EXPECT_EQ(fail_col, -1);
+  slap_PackedToDense(L_packed, P);
+  slap_MakeLowerTri(L_packed);
+  EXPECT_LT(slap_NormedDifference(L, L_packed), 1e-4);
+
+  slap_SetRange(b, -1, 1);
+  slap_Copy(x, b);
+  EXPECT_EQ(slap_CholeskySolve(P, x), SLAP_NO_ERROR);
+  slap_MatMulAdd(b, A, x, 1, -1);
+  EXPECT_LT(slap_NormInf(b), 1e-4);
+
+  // Packed copies only touch the packed data
+  Matrix P2 = slap_NewPackedMatrix(n);
+  EXPECT_EQ(slap_Copy(P2, P), SLAP_NO_ERROR);
+  EXPECT_DOUBLE_EQ(P2.data[slap_PackedSize(n) - 1], P.data[slap_PackedSize(n) - 1]);
+
+  // Not positive definite
+  slap_PackedFromDense(P, A);
+  *slap_PackedElement(P, 9, 9) = -1;
+  EXPECT_EQ(slap_CholeskyInfo(P, &fail_col), SLAP_CHOLESKY_FAIL);
+  EXPECT_EQ(fail_col, 9);
+
+  slap_FreeMatrix(&A);
+  slap_FreeMatrix(&L);
+  slap_FreeMatrix(&P);
+  slap_FreeMatrix(&P2);
+  slap_FreeMatrix(&L_packed);
+  slap_FreeMatrix(&b);
+  slap_FreeMatrix(&x);
+}
+
+TEST(Packed, Triangular) {
+  const int n = 9;
+  const int m = 2;
+  Matrix A = slap_NewMatrix(n, n);
+  Matrix L = slap_NewMatrix(n, n);
+  Matrix P = slap_NewPackedMatrix(n);
+  Matrix L_dense = slap_NewMatrix(n, n);
+  srand(9);
+  SetRandomSPD(A);
+  slap_PackedFromDense(P, A);
+  slap_Copy(L, A);
+  slap_Cholesky(L);
+  slap_MakeLowerTri(L);
+  EXPECT_EQ(slap_Cholesky(P), SLAP_NO_ERROR);
+
+  // The upper triangle of a triangular view is zero
+  Matrix Lp = slap_LowerTri(P);
+  EXPECT_EQ(slap_GetType(Lp), slap_PACKED_LOWER);
+  EXPECT_EQ(slap_PackedElement(Lp, 2, 5), nullptr);
+  EXPECT_EQ(slap_PackedElement(slap_UpperTri(P), 5, 2), nullptr);
+  EXPECT_EQ(slap_PackedElement(slap_UpperTri(P), 2, 5), slap_PackedElement(Lp, 5, 2));
+  EXPECT_EQ(slap_PackedToDense(L_dense, Lp), SLAP_NO_ERROR);
+  EXPECT_LT(slap_NormedDifference(L, L_dense), 1e-4);
+  EXPECT_EQ(slap_PackedToDense(L_dense, slap_UpperTri(P)), SLAP_NO_ERROR);
+  EXPECT_LT(slap_NormedDifference(slap_Transpose(L), L_dense), 1e-4);
+
+  // Packing from the upper triangle
+  Matrix P2 = slap_NewPackedMatrix(n);
+  EXPECT_EQ(slap_PackedFromDense(slap_UpperTri(P2), slap_Transpose(L)), SLAP_NO_ERROR);
+  EXPECT_DOUBLE_EQ(*slap_PackedElement(P2, 7, 3), *slap_GetElement(L, 7, 3));
+
+  // Products with L and L' match the dense factor, and L L' gives back A
+  Matrix B = slap_NewMatrix(n, m);
+  Matrix C = slap_NewMatrix(n, m);
+  Matrix C_ans = slap_NewMatrix(n, m);
+  slap_SetRange(B, -1, 1);
+  slap_SetRange(C, 0, 2);
+  slap_Copy(C_ans, C);
+  EXPECT_EQ(slap_MatMulAdd(C, Lp, B, 0.5, -1), SLAP_NO_ERROR);
+  slap_MatMulAdd(C_ans, L, B, 0.5, -1);
+  EXPECT_LT(slap_NormedDifference(C, C_ans), 1e-4);
+  EXPECT_EQ(slap_MatMulAdd(C, slap_Transpose(Lp), B, 1, 0), SLAP_NO_ERROR);
+  slap_MatMulAdd(C_ans, slap_Transpose(L), B, 1, 0);
+  EXPECT_LT(slap_NormedDifference(C, C_ans), 1e-4);
+  Matrix LLt = slap_NewMatrix(n, m);
+  slap_MatMulAdd(LLt, Lp, C, 1, 0);
+  slap_MatMulAdd(C_ans, A, B, 1, 0);
+  EXPECT_LT(slap_NormedDifference(LLt, C_ans), 1e-4);
+
+  Matrix x = slap_CreateSubMatrix(B, 0, 0, n, 1);
+  Matrix y = slap_CreateSubMatrix(B, 0, 1, n, 1);
+  EXPECT_NEAR(slap_QuadraticForm(y, Lp, x), slap_QuadraticForm(y, L, x), 1e-4);
+  EXPECT_NEAR(slap_QuadraticForm(y, slap_UpperTri(P), x),
+              slap_QuadraticForm(y, slap_Transpose(L), x), 1e-4);
+
+  // The triangular view solves with the same factor
+  slap_Copy(C, B);
+  EXPECT_EQ(slap_CholeskySolve(Lp, C), SLAP_NO_ERROR);
+  slap_MatMulAdd(B, A, C, 1, -1);
+  EXPECT_LT(slap_NormInf(B), 1e-4);
+
+  slap_FreeMatrix(&A);
+  slap_FreeMatrix(&L);
+  slap_FreeMatrix(&P);
+  slap_FreeMatrix(&P2);
+  slap_FreeMatrix(&L_dense);
+  slap_FreeMatrix(&B);
+  slap_FreeMatrix(&C);
+  slap_FreeMatrix(&C_ans);
+  slap_FreeMatrix(&LLt);
+}
+
+// Check A V = V diag(w), V'V = I, and that the eigenvalues are sorted
+static void CheckEigen(Matrix A, Matrix w, Matrix V, double tol) {
+  int n = slap_NumRows(A);
+  Matrix AV = slap_NewMatrix(n, n);
+  Matrix VW = slap_NewMatrix(n, n);
+  Matrix VtV = slap_NewMatrix(n, n);
+  Matrix I = slap_NewMatrix(n, n);
+  slap_MatMulAdd(AV, A, V, 1, 0);
+  for (int j = 0; j < n; ++j) {
+    for (int i = 0; i < n; ++i) {
+      slap_SetElement(VW, i, j, w.data[j] * *slap_GetElement(V, i, j));
+    }
+  }
+  EXPECT_LT(slap_NormedDifference(AV, VW), tol);
+  slap_MatMulAdd(VtV, slap_Transpose(V), V, 1, 0);
+  slap_SetIdentity(I, 1);
+  EXPECT_LT(slap_NormedDifference(VtV, I), tol);
+  for (int k = 0; k + 1 < n; ++k) {
+    EXPECT_LE(w.data[k], w.data[k + 1]);
+  }
+  slap_FreeMatrix(&AV);
+  slap_FreeMatrix(&VW);
+  slap_FreeMatrix(&VtV);
+  slap_FreeMatrix(&I);
+}
+
+TEST(SymmetricEigen, Small) {
+  srand(11);
+  for (int n = 1; n <= 3; ++n) {
+    Matrix A = slap_NewMatrix(n, n);
+    Matrix A_copy = slap_NewMatrix(n, n);
+    Matrix w = slap_NewMatrix(n, 1);
+    Matrix V = slap_NewMatrix(n, n);
+    SetRandomSymmetric(A);
+    slap_Copy(A_copy, A);
+    EXPECT_EQ(slap_SymmetricEigen(A_copy, w, V, slap_NullMatrix()), SLAP_NO_ERROR);
+    CheckEigen(A, w, V, 1e-5);
+    slap_FreeMatrix(&A);
+    slap_FreeMatrix(&A_copy);
+    slap_FreeMatrix(&w);
+    slap_FreeMatrix(&V);
+  }
+
+  // Covariance with a repeated eigenvalue
+  sfloat data[9] = {2, 1, 0, 1, 2, 0, 0, 0, 3};
+  Matrix A = slap_MatrixFromArray(3, 3, data);
+  Matrix A_copy = slap_NewMatrix(3, 3);
+  Matrix w = slap_NewMatrix(3, 1);
+  Matrix V = slap_NewMatrix(3, 3);
+  slap_Copy(A_copy, A);
+  slap_SymmetricEigen(A_copy, w, V, slap_NullMatrix());
+  EXPECT_NEAR(w.data[0], 1, 1e-6);
+  EXPECT_NEAR(w.data[1], 3, 1e-6);
+  EXPECT_NEAR(w.data[2], 3, 1e-6);
+  CheckEigen(A, w, V, 1e-5);
+  slap_FreeMatrix(&A_copy);
+  slap_FreeMatrix(&w);
+  slap_FreeMatrix(&V);
+}
+
+TEST(SymmetricEigen, Tridiagonal) {
+  srand(12);
+  alignas(SLAP_ARENA_ALIGNMENT) static char buffer[1 << 16];
+  for (int n : {4, 10, 37, 70}) {
+    Matrix A = slap_NewMatrix(n, n);
+    Matrix A_copy = slap_NewMatrix(n, n);
+    Matrix w = slap_NewMatrix(n, 1);
+    Matrix w2 = slap_NewMatrix(n, 1);
+    Matrix V = slap_NewMatrix(n, n);
+    slap_Arena arena = slap_NewArena(buffer, sizeof(buffer));
+    Matrix work = slap_ArenaNewMatrix(&arena, 3 * n, 1);
+    EXPECT_LE(arena.top, slap_SymmetricEigenWorkspaceSize(n));
+    SetRandomSymmetric(A);
+
+    // Only the lower triangle is read
+    slap_Copy(A_copy, A);
+    for (int j = 1; j < n; ++j) {
+      *slap_GetElement(A_copy, 0, j) = 100;
+    }
+    EXPECT_EQ(slap_SymmetricEigen(A_copy, w, V, work), SLAP_NO_ERROR);
+    CheckEigen(A, w, V, 1e-4);
+
+    // Eigenvalues only
+    slap_Copy(A_copy, A);
+    EXPECT_EQ(slap_SymmetricEigen(A_copy, w2, slap_NullMatrix(), work), SLAP_NO_ERROR);
+    EXPECT_LT(slap_NormedDifference(w, w2), 1e-4);
+
+    slap_FreeMatrix(&A);
+    slap_FreeMatrix(&A_copy);
+    slap_FreeMatrix(&w);
+    slap_FreeMatrix(&w2);
+    slap_FreeMatrix(&V);
+  }
+}
+
+TEST(SymmetricEigen, Diagonal) {
+  // Already tridiagonal, with repeated eigenvalues
+  const int n = 6;
+  Matrix A = slap_NewMatrix(n, n);
+  Matrix A_copy = slap_NewMatrix(n, n);
+  Matrix w = slap_NewMatrix(n, 1);
+  Matrix V = slap_NewMatrix(n, n);
+  Matrix work = slap_NewMatrix(3 * n, 1);
+  slap_SetConst(A, 0);
+  for (int k = 0; k < n; ++k) {
+    slap_SetElement(A, k, k, k % 2 ? 1 : -2);
+  }
+  slap_Copy(A_copy, A);
+  EXPECT_EQ(slap_SymmetricEigen(A_copy, w, V, work), SLAP_NO_ERROR);
+  CheckEigen(A, w, V, 1e-6);
+  EXPECT_DOUBLE_EQ(w.data[0], -2);
+  EXPECT_DOUBLE_EQ(w.data[n - 1], 1);
+  slap_FreeMatrix(&A);
+  slap_FreeMatrix(&A_copy);
+  slap_FreeMatrix(&w);
+  slap_FreeMatrix(&V);
+  slap_FreeMatrix(&work);
+}
+
+static void SetRandom(Matrix A) {
+  for (int j = 0; j < slap_NumCols(A); ++j) {
+    for (int i = 0; i < slap_NumRows(A); ++i) {
+      slap_SetElement(A, i, j, (sfloat)rand() / RAND_MAX - 0.5);
+    }
+  }
+}
+
+// Check A = U diag(s) V', U'U = I, V'V = I, and that the singular values are sorted
+static void CheckSVD(Matrix A, Matrix s, Matrix U, Matrix V, double tol) {
+  int m = slap_NumRows(A);
+  int n = slap_NumCols(A);
+  int k = slap_NumElements(s);
+  Matrix US = slap_NewMatrix(m, k);
+  Matrix USVt = slap_NewMatrix(m, n);
+  Matrix I = slap_NewMatrix(k, k);
+  Matrix QtQ = slap_NewMatrix(k, k);
+  for (int j = 0; j < k; ++j) {
+    for (int i = 0; i < m; ++i) {
+      slap_SetElement(US, i, j, s.data[j] * *slap_GetElement(U, i, j));
+    }
+  }
+  slap_MatMulAdd(USVt, US, slap_Transpose(V), 1, 0);
+  EXPECT_LT(slap_NormedDifference(USVt, A), tol);
+  slap_SetIdentity(I, 1);
+  slap_MatMulAdd(QtQ, slap_Transpose(U), U, 1, 0);
+  EXPECT_LT(slap_NormedDifference(QtQ, I), tol);
+  slap_MatMulAdd(QtQ, slap_Transpose(V), V, 1, 0);
+  EXPECT_LT(slap_NormedDifference(QtQ, I), tol);
+  for (int i = 0; i + 1 < k; ++i) {
+    EXPECT_GE(s.data[i], s.data[i + 1]);
+  }
+  EXPECT_GE(s.data[k - 1], 0);
+  slap_FreeMatrix(&US);
+  slap_FreeMatrix(&USVt);
+  slap_FreeMatrix(&I);
+  slap_FreeMatrix(&QtQ);
+}
+
+TEST(SVD, Shapes) {
+  srand(13);
+  alignas(SLAP_ARENA_ALIGNMENT) static char buffer[1 << 14];
+  const int shapes[][2] = {{6, 7}, {7, 6}, {6, 6}, {1, 5}, {5, 1}, {20, 9}, {6, 30}};
+  for (auto shape : shapes) {
+    int m = shape[0];
+    int n = shape[1];
+    int k = m < n ? m : n;
+    Matrix A = slap_NewMatrix(m, n);
+    Matrix A_copy = slap_NewMatrix(m, n);
+    Matrix s = slap_NewMatrix(k, 1);
+    Matrix s2 = slap_NewMatrix(k, 1);
+    Matrix U = slap_NewMatrix(m, k);
+    Matrix V = slap_NewMatrix(n, k);
+    slap_Arena arena = slap_NewArena(buffer, sizeof(buffer));
+    Matrix work = slap_ArenaNewMatrix(&arena, k + (m < n ? m * n : 0), 1);
+    EXPECT_LE(arena.top, slap_SVDWorkspaceSize(m, n));
+    SetRandom(A);
+
+    slap_Copy(A_copy, A);
+    EXPECT_EQ(slap_SVD(A_copy, s, U, V, 0, work), SLAP_NO_ERROR);
+    CheckSVD(A, s, U, V, 1e-4);
+
+    // Singular values only
+    slap_Copy(A_copy, A);
+    EXPECT_EQ(slap_SVD(A_copy, s2, slap_NullMatrix(), slap_NullMatrix(), 0, work),
+              SLAP_NO_ERROR);
+    EXPECT_LT(slap_NormedDifference(s, s2), 1e-5);
+
+    slap_FreeMatrix(&A);
+    slap_FreeMatrix(&A_copy);
+    slap_FreeMatrix(&s);
+    slap_FreeMatrix(&s2);
+    slap_FreeMatrix(&U);
+    slap_FreeMatrix(&V);
+  }
+}
+
+TEST(SVD, InPlace) {
+  srand(14);
+  const int m = 9;
+  const int n = 6;
+  Matrix A = slap_NewMatrix(m, n);
+  Matrix A_copy = slap_NewMatrix(m, n);
+  Matrix s = slap_NewMatrix(n, 1);
+  Matrix V = slap_NewMatrix(n, n);
+  Matrix work = slap_NewMatrix(n + m * n, 1);
+  SetRandom(A);
+
+  // Tall, with U stored in A
+  slap_Copy(A_copy, A);
+  EXPECT_EQ(slap_SVD(A_copy, s, A_copy, V, 0, work), SLAP_NO_ERROR);
+  CheckSVD(A, s, A_copy, V, 1e-4);
+
+  // Wide, stored as the transpose of a tall matrix, so the rows are rotated in place
+  slap_Copy(A_copy, A);
+  Matrix At = slap_Transpose(A_copy);
+  Matrix U = slap_NewMatrix(n, n);
+  Matrix Vt = slap_NewMatrix(m, n);
+  EXPECT_EQ(slap_SVD(At, s, U, Vt, 0, slap_MatrixFromArray(n, 1, work.data)),
+            SLAP_NO_ERROR);
+  CheckSVD(slap_Transpose(A), s, U, Vt, 1e-4);
+
+  // Tall and transposed, which needs a copy
+  Matrix B = slap_Transpose(slap_NewMatrix(n, m));
+  slap_Copy(B, A);
+  EXPECT_EQ(slap_SVD(B, s, Vt, V, 0, work), SLAP_NO_ERROR);
+  CheckSVD(A, s, Vt, V, 1e-4);
+
+  slap_FreeMatrix(&A);
+  slap_FreeMatrix(&A_copy);
+  slap_FreeMatrix(&s);
+  slap_FreeMatrix(&V);
+  slap_FreeMatrix(&work);
+  slap_FreeMatrix(&U);
+  slap_FreeMatrix(&Vt);
+  slap_FreeMatrix(&B);
+}
+
+TEST(SVD, DampedLeastSquares) {
+  srand(15);
+  const int m = 6;
+  const int n = 7;
+  Matrix J = slap_NewMatrix(m, n);
+  Matrix J_copy = slap_NewMatrix(m, n);
+  Matrix s = slap_NewMatrix(m, 1);
+  Matrix U = slap_NewMatrix(m, m);
+  Matrix V = slap_NewMatrix(n, m);
+  Matrix work = slap_NewMatrix(m + m * n, 1);
+  Matrix b = slap_NewMatrix(m, 2);
+  Matrix x = slap_NewMatrix(n, 2);
+  Matrix temp = slap_NewMatrix(m, 2);
+  Matrix H = slap_NewMatrix(n, n);
+  Matrix Hx = slap_NewMatrix(n, 2);
+  Matrix Jtb = slap_NewMatrix(n, 2);
+  SetRandom(J);
+  SetRandom(b);
+  slap_MatMulAdd(Jtb, slap_Transpose(J), b, 1, 0);
+  slap_Copy(J_copy, J);
+  EXPECT_EQ(slap_SVD(J_copy, s, U, V, 0, work), SLAP_NO_ERROR);
+
+  // Full row rank, so the pseudoinverse solution satisfies J x = b
+  Matrix Jx = slap_NewMatrix(m, 2);
+  EXPECT_EQ(slap_SVDSolve(x, U, s, V, b, 0, 0, temp), SLAP_NO_ERROR);
+  slap_MatMulAdd(Jx, J, x, 1, 0);
+  EXPECT_LT(slap_NormedDifference(Jx, b), 1e-4);
+
+  // (J'J + lambda^2 I) x = J'b
+  const sfloat lambda = 0.1;
+  EXPECT_EQ(slap_SVDSolve(x, U, s, V, b, lambda, 0, temp), SLAP_NO_ERROR);
+  slap_MatMulAdd(H, slap_Transpose(J), J, 1, 0);
+  slap_AddIdentity(H, lambda * lambda);
+  slap_MatMulAdd(Hx, H, x, 1, 0);
+  EXPECT_LT(slap_NormedDifference(Hx, Jtb), 1e-4);
+
+  // Rank 2: the normal equations J'(J x - b) = 0 still hold, once the singular values
+  // that are only rounding errors are dropped
+  for (int j = 2; j < n; ++j) {
+    for (int i = 0; i < m; ++i) {
+      slap_SetElement(J, i, j, *slap_GetElement(J, i, j % 2));
+    }
+  }
+  slap_MatMulAdd(Jtb, slap_Transpose(J), b, 1, 0);
+  slap_Copy(J_copy, J);
+  EXPECT_EQ(slap_SVD(J_copy, s, U, V, 0, work), SLAP_NO_ERROR);
+  EXPECT_LT(s.data[2], 1e-5 * s.data[0]);
+  EXPECT_EQ(slap_SVDSolve(x, U, s, V, b, 0, 1e-4, temp), SLAP_NO_ERROR);
+  slap_MatMulAdd(H, slap_Transpose(J), J, 1, 0);
+  slap_MatMulAdd(Hx, H, x, 1, 0);
+  EXPECT_LT(slap_NormedDifference(Hx, Jtb), 1e-4);
+
+  slap_FreeMatrix(&J);
+  slap_FreeMatrix(&J_copy);
+  slap_FreeMatrix(&s);
+  slap_FreeMatrix(&U);
+  slap_FreeMatrix(&V);
+  slap_FreeMatrix(&work);
+  slap_FreeMatrix(&b);
+  slap_FreeMatrix(&x);
+  slap_FreeMatrix(&temp);
+  slap_FreeMatrix(&H);
+  slap_FreeMatrix(&Hx);
+  slap_FreeMatrix(&Jtb);
+  slap_FreeMatrix(&Jx);
+}
+
+TEST(Expm, KnownSolutions) {
+  Matrix E = slap_NewMatrix(2, 2);
+
+  // Diagonal
+  sfloat diag[4] = {-1, 0, 0, 2};
+  EXPECT_EQ(slap_Expm(E, slap_MatrixFromArray(2, 2, diag), slap_NullMatrix(), NULL),
+            SLAP_NO_ERROR);
+  EXPECT_NEAR(*slap_GetElement(E, 0, 0), std::exp(-1.0), 1e-6);
+  EXPECT_NEAR(*slap_GetElement(E, 1, 1), std::exp(2.0), 1e-5);
+  EXPECT_NEAR(*slap_GetElement(E, 1, 0), 0, 1e-6);
+
+  // Double integrator, which is nilpotent
+  sfloat nilpotent[4] = {0, 0, 0.1, 0};
+  slap_Expm(E, slap_MatrixFromArray(2, 2, nilpotent), slap_NullMatrix(), NULL);
+  EXPECT_NEAR(*slap_GetElement(E, 0, 0), 1, 1e-6);
+  EXPECT_NEAR(*slap_GetElement(E, 0, 1), 0.1, 1e-6);
+  EXPECT_NEAR(*slap_GetElement(E, 1, 0), 0, 1e-6);
+
+  // Rotation by a large angle, which needs scaling and squaring
+  const double t = 10;
+  for (double angle : {0.001, 0.1, 1.0, t}) {
+    sfloat rot[4] = {0, (sfloat)angle, (sfloat)-angle, 0};
+    slap_Expm(E, slap_MatrixFromArray(2, 2, rot), slap_NullMatrix(), NULL);
+    EXPECT_NEAR(*slap_GetElement(E, 0, 0), std::cos(angle), 1e-5);
+    EXPECT_NEAR(*slap_GetElement(E, 1, 0), std::sin(angle), 1e-5);
+    EXPECT_NEAR(*slap_GetElement(E, 0, 1), -std::sin(angle), 1e-5);
+  }
+  slap_FreeMatrix(&E);
+}
+
+TEST(Expm, Inverse) {
+  // e^A e^{-A} = I and A e^A = e^A A, for norms that use each Padé degree. A is
+  // skew-symmetric so that e^A is orthogonal, and the check isn't limited by its
+  // conditioning.
+  srand(16);
+  alignas(SLAP_ARENA_ALIGNMENT) static char buffer[1 << 16];
+  for (int n : {3, 12, 13, 30}) {
+    for (double norm : {1e-3, 0.2, 1.0, 4.0, 30.0}) {
+      Matrix A = slap_NewMatrix(n, n);
+      Matrix negA = slap_NewMatrix(n, n);
+      Matrix E = slap_NewMatrix(n, n);
+      Matrix Einv = slap_NewMatrix(n, n);
+      Matrix EEinv = slap_NewMatrix(n, n);
+      Matrix AE = slap_NewMatrix(n, n);
+      Matrix EA = slap_NewMatrix(n, n);
+      Matrix I = slap_NewMatrix(n, n);
+      SetRandom(negA);
+      slap_MatrixAddition(A, negA, slap_Transpose(negA), -1);
+      slap_ScaleByConst(A, norm / slap_NormOne(A) * n);
+      slap_Copy(negA, A);
+      slap_ScaleByConst(negA, -1);
+
+      slap_Arena arena = slap_NewArena(buffer, sizeof(buffer));
+      Matrix work = slap_ArenaNewMatrix(&arena, 6 * n, n);
+      EXPECT_LE(arena.top, slap_ExpmWorkspaceSize(n));
+      std::vector<int> piv(n);
+      EXPECT_EQ(slap_Expm(E, A, work, piv.data()), SLAP_NO_ERROR);
+      EXPECT_EQ(slap_Expm(Einv, negA, work, piv.data()), SLAP_NO_ERROR);
+      slap_MatMulAdd(EEinv, E, Einv, 1, 0);
+      slap_SetIdentity(I, 1);
+      EXPECT_LT(slap_NormedDifference(EEinv, I), 1e-4 * (1 + norm));
+      slap_MatMulAdd(AE, A, E, 1, 0);
+      slap_MatMulAdd(EA, E, A, 1, 0);
+      EXPECT_LT(slap_NormedDifference(AE, EA), 1e-4 * slap_NormTwo(AE));
+
+      // In place
+      slap_Expm(A, A, work, piv.data());
+      EXPECT_LT(slap_NormedDifference(A, E), 1e-5 * slap_NormTwo(E));
+
+      slap_FreeMatrix(&A);
+      slap_FreeMatrix(&negA);
+      slap_FreeMatrix(&E);
+      slap_FreeMatrix(&Einv);
+      slap_FreeMatrix(&EEinv);
+      slap_FreeMatrix(&AE);
+      slap_FreeMatrix(&EA);
+      slap_FreeMatrix(&I);
+    }
+  }
+}
+
+TEST(Expm, Discretization) {
+  // Zero-order hold for a double integrator: expm([A B; 0 0] h)
+  const sfloat h = 0.01;
+  const int n = 3;
+  sfloat Mdata[9] = {0, 0, 0, h, 0, 0, 0, h, 0};
+  Matrix M = slap_MatrixFromArray(n, n, Mdata);
+  Matrix E = slap_NewMatrix(n, n);
+  EXPECT_EQ(slap_Expm(E, M, slap_NullMatrix(), NULL), SLAP_NO_ERROR);
+  sfloat ans[9] = {1, 0, 0, h, 1, 0, h * h / 2, h, 1};
+  EXPECT_LT(slap_NormedDifference(E, slap_MatrixFromArray(n, n, ans)), 1e-6);
+  slap_FreeMatrix(&E);
+}
+
+// K = (R + B'P+B) \ B'P+A and P = Q + A'P+A - A'P+B K, formed one product at a time
+static void RiccatiReference(Matrix K, Matrix P, Matrix A, Matrix B, Matrix Q, Matrix R,
+                             Matrix P_next) {
+  int n_next = slap_NumRows(A);
+  int n = slap_NumCols(A);
+  int m = slap_NumCols(B);
+  Matrix PA = slap_NewMatrix(n_next, n);
+  Matrix PB = slap_NewMatrix(n_next, m);
+  Matrix Quu = slap_NewMatrix(m, m);
+  slap_MatMulAdd(PA, P_next, A, 1, 0);
+  slap_MatMulAdd(PB, P_next, B, 1, 0);
+  slap_Copy(Quu, R);
+  slap_MatMulAdd(Quu, slap_Transpose(B), PB, 1, 1);
+  slap_MatMulAdd(K, slap_Transpose(B), PA, 1, 0);
+  slap_Copy(P, Q);
+  slap_MatMulAdd(P, slap_Transpose(A), PA, 1, 1);
+  slap_Cholesky(Quu);
+  Matrix Qxu = slap_NewMatrix(n, m);
+  slap_Copy(Qxu, slap_Transpose(K));
+  slap_CholeskySolve(Quu, K);
+  slap_MatMulAdd(P, Qxu, K, -1, 1);
+  slap_FreeMatrix(&PA);
+  slap_FreeMatrix(&PB);
+  slap_FreeMatrix(&Quu);
+  slap_FreeMatrix(&Qxu);
+}
+
+TEST(Riccati, Step) {
+  srand(17);
+  const int n = 6;
+  const int m = 3;
+  for (int n_next : {n, 8}) {
+    Matrix A = slap_NewMatrix(n_next, n);
+    Matrix B = slap_NewMatrix(n_next, m);
+    Matrix Q = slap_NewMatrix(n, n);
+    Matrix R = slap_NewMatrix(m, m);
+    Matrix P_next = slap_NewMatrix(n_next, n_next);
+    Matrix K = slap_NewMatrix(m, n);
+    Matrix P = slap_NewMatrix(n, n);
+    Matrix K_ans = slap_NewMatrix(m, n);
+    Matrix P_ans = slap_NewMatrix(n, n);
+    SetRandom(A);
+    SetRandom(B);
+    SetRandomSPD(Q);
+    SetRandomSPD(R);
+    SetRandomSPD(P_next);
+    Matrix work = slap_NewMatrix((n_next + m) * (n + m), 1);
+
+    EXPECT_EQ(slap_RiccatiStep(K, P, A, B, Q, R, P_next, work), SLAP_NO_ERROR);
+    RiccatiReference(K_ans, P_ans, A, B, Q, R, P_next);
+    EXPECT_LT(slap_NormedDifference(K, K_ans), 1e-4);
+    EXPECT_LT(slap_NormedDifference(P, P_ans), 1e-4);
+    for (int j = 0; j < n; ++j) {
+      for (int i = 0; i < n; ++i) {
+        EXPECT_EQ(*slap_GetElement(P, i, j), *slap_GetElement(P, j, i));
+      }
+    }
+
+    // Updating the cost-to-go in place
+    if (n_next == n) {
+      slap_Copy(P, P_next);
+      EXPECT_EQ(slap_RiccatiStep(K, P, A, B, Q, R, P, work), SLAP_NO_ERROR);
+      EXPECT_LT(slap_NormedDifference(P, P_ans), 1e-4);
+    }
+
+    // A stored as a transpose
+    Matrix At = slap_NewMatrix(n, n_next);
+    slap_Copy(slap_Transpose(At), A);
+    EXPECT_EQ(slap_RiccatiStep(K, P, slap_Transpose(At), B, Q, R, P_next, work),
+              SLAP_NO_ERROR);
+    EXPECT_LT(slap_NormedDifference(K, K_ans), 1e-4);
+    EXPECT_LT(slap_NormedDifference(P, P_ans), 1e-4);
+    slap_FreeMatrix(&At);
+
+    // Diagonal costs, through both the dot-product path and the one for a transposed A
+    Matrix Qd = slap_NewDiagonalMatrix(n);
+    Matrix Rd = slap_NewDiagonalMatrix(m);
+    slap_SetConst(Q, 0);
+    slap_SetConst(R, 0);
+    for (int i = 0; i < n; ++i) {
+      Qd.data[i] = i + 1;
+      slap_SetElement(Q, i, i, Qd.data[i]);
+    }
+    for (int i = 0; i < m; ++i) {
+      Rd.data[i] = 0.5 * (i + 1);
+      slap_SetElement(R, i, i, Rd.data[i]);
+    }
+    RiccatiReference(K_ans, P_ans, A, B, Q, R, P_next);
+    EXPECT_EQ(slap_RiccatiStep(K, P, A, B, Qd, Rd, P_next, work), SLAP_NO_ERROR);
+    EXPECT_LT(slap_NormedDifference(K, K_ans), 1e-4);
+    EXPECT_LT(slap_NormedDifference(P, P_ans), 1e-4);
+    At = slap_NewMatrix(n, n_next);
+    slap_Copy(slap_Transpose(At), A);
+    EXPECT_EQ(slap_RiccatiStep(K, P, slap_Transpose(At), B, Qd, Rd, P_next, work),
+              SLAP_NO_ERROR);
+    EXPECT_LT(slap_NormedDifference(K, K_ans), 1e-4);
+    EXPECT_LT(slap_NormedDifference(P, P_ans), 1e-4);
+    slap_FreeMatrix(&At);
+    slap_FreeMatrix(&Qd);
+    slap_FreeMatrix(&Rd);
+
+    slap_FreeMatrix(&A);
+    slap_FreeMatrix(&B);
+    slap_FreeMatrix(&Q);
+    slap_FreeMatrix(&R);
+    slap_FreeMatrix(&P_next);
+    slap_FreeMatrix(&K);
+    slap_FreeMatrix(&P);
+    slap_FreeMatrix(&K_ans);
+    slap_FreeMatrix(&P_ans);
+    slap_FreeMatrix(&work);
+  }
+}
+
+TEST(Riccati, Recursion) {
+  // Double integrator in 2D, which converges to the infinite-horizon solution
+  const int n = 4;
+  const int m = 2;
+  const int N = 200;
+  const sfloat h = 0.1;
+  Matrix A = slap_NewMatrix(n, n);
+  Matrix B = slap_NewMatrix(n, m);
+  Matrix Q = slap_NewMatrix(n, n);
+  Matrix R = slap_NewMatrix(m, m);
+  slap_SetIdentity(A, 1);
+  slap_SetConst(B, 0);
+  for (int i = 0; i < m; ++i) {
+    slap_SetElement(A, i, m + i, h);
+    slap_SetElement(B, i, i, h * h / 2);
+    slap_SetElement(B, m + i, i, h);
+  }
+  slap_SetIdentity(Q, 1);
+  slap_SetIdentity(R, 0.1);
+
+  std::vector<Matrix> As(N - 1, A);
+  std::vector<Matrix> Bs(N - 1, B);
+  std::vector<Matrix> Qs(N - 1, Q);
+  std::vector<Matrix> Rs(N - 1, R);
+  std::vector<Matrix> K(N - 1);
+  std::vector<Matrix> P(N);
+  for (int k = 0; k < N; ++k) {
+    P[k] = slap_NewMatrix(n, n);
+    if (k < N - 1) {
+      K[k] = slap_NewMatrix(m, n);
+    }
+  }
+  slap_SetIdentity(P[N - 1], 10);
+  alignas(SLAP_ARENA_ALIGNMENT) static char buffer[1 << 12];
+  slap_Arena arena = slap_NewArena(buffer, sizeof(buffer));
+  Matrix work = slap_ArenaNewMatrix(&arena, (n + m) * (n + m), 1);
+  EXPECT_LE(arena.top, slap_RiccatiWorkspaceSize(n, m));
+
+  int fail = 0;
+  EXPECT_EQ(slap_RiccatiRecursion(N, K.data(), P.data(), As.data(), Bs.data(), Qs.data(),
+                                  Rs.data(), work, &fail),
+            SLAP_NO_ERROR);
+  EXPECT_EQ(fail, -1);
+
+  // The first steps satisfy the discrete algebraic Riccati equation
+  Matrix K_ans = slap_NewMatrix(m, n);
+  Matrix P_ans = slap_NewMatrix(n, n);
+  RiccatiReference(K_ans, P_ans, A, B, Q, R, P[0]);
+  EXPECT_LT(slap_NormedDifference(P_ans, P[0]), 1e-3 * slap_NormTwo(P[0]));
+  EXPECT_LT(slap_NormedDifference(K_ans, K[0]), 1e-3 * slap_NormTwo(K[0]));
+
+  // Indefinite control cost
+  slap_SetIdentity(R, -1);
+  EXPECT_EQ(slap_RiccatiRecursion(N, K.data(), P.data(), As.data(), Bs.data(), Qs.data(),
+                                  Rs.data(), work, &fail),
+            SLAP_CHOLESKY_FAIL);
+  EXPECT_EQ(fail, N - 2);
+
+  for (int k = 0; k < N; ++k) {
+    slap_FreeMatrix(&P[k]);
+    if (k < N - 1) {
+      slap_FreeMatrix(&K[k]);
+    }
+  }
+  slap_FreeMatrix(&A);
+  slap_FreeMatrix(&B);
+  slap_FreeMatrix(&Q);
+  slap_FreeMatrix(&R);
+  slap_FreeMatrix(&K_ans);
+  slap_FreeMatrix(&P_ans);
+}
+
+// Textbook update with an explicit gain and the Joseph form of the covariance update
+static void KalmanReference(Matrix x, Matrix P, Matrix z, Matrix H, Matrix R) {
+  int n = slap_NumRows(P);
+  int p = slap_NumRows(H);
+  Matrix PHt = slap_NewMatrix(n, p);
+  Matrix S = slap_NewMatrix(p, p);
+  Matrix K = slap_NewMatrix(n, p);
+  Matrix Kt = slap_NewMatrix(p, n);
+  Matrix y = slap_NewMatrix(p, 1);
+  Matrix IKH = slap_NewMatrix(n, n);
+  Matrix tmp = slap_NewMatrix(n, n);
+  Matrix KR = slap_NewMatrix(n, p);
+  slap_MatMulAdd(PHt, P, slap_Transpose(H), 1, 0);
+  slap_Copy(S, R);
+  slap_MatMulAdd(S, H, PHt, 1, 1);
+  slap_Cholesky(S);
+  slap_Copy(Kt, slap_Transpose(PHt));
+  slap_CholeskySolve(S, Kt);
+  slap_Copy(K, slap_Transpose(Kt));
+  slap_Copy(y, z);
+  slap_MatMulAdd(y, H, x, -1, 1);
+  slap_MatMulAdd(x, K, y, 1, 1);
+  slap_SetIdentity(IKH, 1);
+  slap_MatMulAdd(IKH, K, H, -1, 1);
+  slap_MatMulAdd(tmp, IKH, P, 1, 0);
+  slap_MatMulAdd(P, tmp, slap_Transpose(IKH), 1, 0);
+  slap_MatMulAdd(KR, K, R, 1, 0);
+  slap_MatMulAdd(P, KR, slap_Transpose(K), 1, 1);
+  slap_FreeMatrix(&PHt);
+  slap_FreeMatrix(&S);
+  slap_FreeMatrix(&K);
+  slap_FreeMatrix(&Kt);
+  slap_FreeMatrix(&y);
+  slap_FreeMatrix(&IKH);
+  slap_FreeMatrix(&tmp);
+  slap_FreeMatrix(&KR);
+}
+
+static void ExpectSymmetric(Matrix P) {
+  for (int j = 0; j < slap_NumCols(P); ++j) {
+    for (int i = 0; i < slap_NumRows(P); ++i) {
+      EXPECT_EQ(*slap_GetElement(P, i, j), *slap_GetElement(P, j, i));
+    }
+  }
+}
+
+TEST(Kalman, Predict) {
+  srand(3);
+  const int n = 7;
+  Matrix x = slap_NewMatrix(n, 1);
+  Matrix P = slap_NewMatrix(n, n);
+  Matrix F = slap_NewMatrix(n, n);
+  Matrix Q = slap_NewMatrix(n, n);
+  Matrix x_ans = slap_NewMatrix(n, 1);
+  Matrix P_ans = slap_NewMatrix(n, n);
+  Matrix FP = slap_NewMatrix(n, n);
+  Matrix Qdiag = slap_NewDiagonalMatrix(n);
+  Matrix work = slap_NewMatrix(n * (2 * n + 1), 1);
+  SetRandom(x);
+  SetRandom(F);
+  SetRandomSPD(P);
+  SetRandomSPD(Q);
+
+  // P = F P F' + Q
+  slap_MatMulAdd(x_ans, F, x, 1, 0);
+  slap_MatMulAdd(FP, F, P, 1, 0);
+  slap_Copy(P_ans, Q);
+  slap_MatMulAdd(P_ans, FP, slap_Transpose(F), 1, 1);
+  EXPECT_EQ(slap_KalmanPredict(x, P, F, Q, work), SLAP_NO_ERROR);
+  EXPECT_LT(slap_NormedDifference(x, x_ans), 1e-5);
+  EXPECT_LT(slap_NormedDifference(P, P_ans), 1e-4);
+  ExpectSymmetric(P);
+
+  // Covariance only, with a diagonal process noise and a transposed F
+  for (int i = 0; i < n; ++i) {
+    Qdiag.data[i] = 0.1 * (i + 1);
+  }
+  slap_Copy(x_ans, x);
+  slap_MatMulAdd(FP, slap_Transpose(F), P, 1, 0);
+  slap_MatMulAdd(P_ans, FP, F, 1, 0);
+  for (int i = 0; i < n; ++i) {
+    *slap_GetElement(P_ans, i, i) += Qdiag.data[i];
+  }
+  EXPECT_EQ(slap_KalmanPredict(slap_NullMatrix(), P, slap_Transpose(F), Qdiag, work),
+            SLAP_NO_ERROR);
+  EXPECT_LT(slap_NormedDifference(P, P_ans), 1e-4);
+  EXPECT_EQ(slap_NormedDifference(x, x_ans), 0);
+  ExpectSymmetric(P);
+
+  slap_FreeMatrix(&x);
+  slap_FreeMatrix(&P);
+  slap_FreeMatrix(&F);
+  slap_FreeMatrix(&Q);
+  slap_FreeMatrix(&x_ans);
+  slap_FreeMatrix(&P_ans);
+  slap_FreeMatrix(&FP);
+  slap_FreeMatrix(&Qdiag);
+  slap_FreeMatrix(&work);
+}
+
+TEST(Kalman, Update) {
+  srand(5);
+  const int n = 9;
+  for (int p : {1, 4}) {
+    Matrix x = slap_NewMatrix(n, 1);
+    Matrix P = slap_NewMatrix(n, n);
+    Matrix z = slap_NewMatrix(p, 1);
+    Matrix H = slap_NewMatrix(p, n);
+    Matrix R = slap_NewMatrix(p, p);
+    Matrix x_ans = slap_NewMatrix(n, 1);
+    Matrix P_ans = slap_NewMatrix(n, n);
+    Matrix work = slap_NewMatrix(p * (2 * n + p + 1) + 2 * n * n, 1);
+    Matrix x_joseph = slap_NewMatrix(n, 1);
+    Matrix P_joseph = slap_NewMatrix(n, n);
+    SetRandom(x);
+    SetRandom(z);
+    SetRandom(H);
+    SetRandomSPD(P);
+    SetRandomSPD(R);
+    slap_Copy(x_ans, x);
+    slap_Copy(P_ans, P);
+    slap_Copy(x_joseph, x);
+    slap_Copy(P_joseph, P);
+
+    KalmanReference(x_ans, P_ans, z, H, R);
+    EXPECT_EQ(slap_KalmanUpdate(x, P, z, H, R, work), SLAP_NO_ERROR);
+    EXPECT_LT(slap_NormedDifference(x, x_ans), 1e-4);
+    EXPECT_LT(slap_NormedDifference(P, P_ans), 1e-4);
+    ExpectSymmetric(P);
+
+    // The Joseph form gives the same covariance for the optimal gain
+    EXPECT_EQ(slap_KalmanUpdateJoseph(x_joseph, P_joseph, z, H, R, work), SLAP_NO_ERROR);
+    EXPECT_LT(slap_NormedDifference(x_joseph, x_ans), 1e-4);
+    EXPECT_LT(slap_NormedDifference(P_joseph, P_ans), 1e-4);
+    ExpectSymmetric(P_joseph);
+
+    slap_FreeMatrix(&x);
+    slap_FreeMatrix(&P);
+    slap_FreeMatrix(&z);
+    slap_FreeMatrix(&H);
+    slap_FreeMatrix(&R);
+    slap_FreeMatrix(&x_ans);
+    slap_FreeMatrix(&P_ans);
+    slap_FreeMatrix(&x_joseph);
+    slap_FreeMatrix(&P_joseph);
+    slap_FreeMatrix(&work);
+  }
+
+  // Indefinite innovation covariance
+  const int p = 2;
+  Matrix x = slap_NewMatrix(n, 1);
+  Matrix P = slap_NewMatrix(n, n);
+  Matrix z = slap_NewMatrix(p, 1);
+  Matrix H = slap_NewMatrix(p, n);
+  Matrix R = slap_NewMatrix(p, p);
+  Matrix work = slap_NewMatrix(p * (2 * n + p + 1) + 2 * n * n, 1);
+  slap_SetConst(P, 0);
+  slap_SetConst(H, 1);
+  slap_SetIdentity(R, -1);
+  EXPECT_EQ(slap_KalmanUpdate(x, P, z, H, R, work), SLAP_CHOLESKY_FAIL);
+  EXPECT_EQ(slap_KalmanUpdateJoseph(x, P, z, H, R, work), SLAP_CHOLESKY_FAIL);
+  EXPECT_EQ(slap_KalmanUpdateSequential(x, P, z, H, R, work), SLAP_CHOLESKY_FAIL);
+  slap_FreeMatrix(&x);
+  slap_FreeMatrix(&P);
+  slap_FreeMatrix(&z);
+  slap_FreeMatrix(&H);
+  slap_FreeMatrix(&R);
+  slap_FreeMatrix(&work);
+}
+
+TEST(Kalman, Sequential) {
+  srand(11);
+  const int n = 8;
+  const int p = 5;
+  Matrix x = slap_NewMatrix(n, 1);
+  Matrix P = slap_NewMatrix(n, n);
+  Matrix z = slap_NewMatrix(p, 1);
+  Matrix H = slap_NewMatrix(p, n);
+  Matrix R = slap_NewDiagonalMatrix(p);
+  Matrix x_ans = slap_NewMatrix(n, 1);
+  Matrix P_ans = slap_NewMatrix(n, n);
+  Matrix work = slap_NewMatrix(p * (2 * n + p + 1), 1);
+  SetRandom(x);
+  SetRandom(z);
+  SetRandom(H);
+  SetRandomSPD(P);
+  for (int i = 0; i < p; ++i) {
+    R.data[i] = 0.5 + 0.1 * i;
+  }
+  slap_Copy(x_ans, x);
+  slap_Copy(P_ans, P);
+
+  // Uncorrelated measurements give the same result one at a time
+  EXPECT_EQ(slap_KalmanUpdate(x_ans, P_ans, z, H, R, work), SLAP_NO_ERROR);
+  EXPECT_EQ(slap_KalmanUpdateSequential(x, P, z, H, R, work), SLAP_NO_ERROR);
+  EXPECT_LT(slap_NormedDifference(x, x_ans), 1e-4);
+  EXPECT_LT(slap_NormedDifference(P, P_ans), 1e-4);
+  ExpectSymmetric(P);
+
+  slap_FreeMatrix(&x);
+  slap_FreeMatrix(&P);
+  slap_FreeMatrix(&z);
+  slap_FreeMatrix(&H);
+  slap_FreeMatrix(&R);
+  slap_FreeMatrix(&x_ans);
+  slap_FreeMatrix(&P_ans);
+  slap_FreeMatrix(&work);
+}
@@ -1,6 +1,9 @@
 
 #include <math.h>
 
+#include <cmath>
+#include <cstdint>
+
 #include "gtest/gtest.h"
 #include "slap/slap.h"
 
@@ -33,6 +36,58 @@ TEST(MatrixBasics, NewMatrix_Zeros) {
   slap_FreeMatrix(&mat);
 }
 
+TEST(MatrixBasics, NewMatrixAligned) {
+  for (int rows : {1, 5, 8, 17}) {
+    Matrix mat = slap_NewMatrixAlignedZeros(rows, 3);
+    EXPECT_EQ(slap_NumRows(mat), rows);
+    EXPECT_EQ(slap_NumCols(mat), 3);
+    EXPECT_EQ(mat.sy, slap_AlignedStride(rows));
+    EXPECT_GE(mat.sy, rows);
+    EXPECT_EQ(mat.sy * sizeof(sfloat) % SLAP_MATRIX_ALIGNMENT, 0u);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(mat.data) % SLAP_MATRIX_ALIGNMENT, 0u);
+    EXPECT_DOUBLE_EQ(slap_NormOne(mat), 0);
+    slap_FreeMatrix(&mat);
+  }
+}
+
+TEST(MatrixBasics, PaddedStrideOps) {
+  // Operations on padded matrices only touch the elements, never the padding
+  const int rows = 5;
+  const int cols = 3;
+  Matrix A = slap_NewMatrixAligned(rows, cols);
+  Matrix B = slap_NewMatrixAligned(rows, cols);
+  Matrix A_dense = slap_NewMatrix(rows, cols);
+  for (int j = 0; j < cols; ++j) {
+    for (int i = rows; i < A.sy; ++i) {
+      A.data[i + j * A.sy] = NAN;
+      B.data[i + j * B.sy] = NAN;
+    }
+  }
+  slap_SetRange(A_dense, -2, 4);
+  slap_Copy(A, A_dense);
+  EXPECT_DOUBLE_EQ(slap_NormedDifference(A, A_dense), 0);
+  EXPECT_DOUBLE_EQ(slap_NormOne(A), slap_NormOne(A_dense));
+  EXPECT_DOUBLE_EQ(slap_NormTwo(A), slap_NormTwo(A_dense));
+  EXPECT_DOUBLE_EQ(slap_NormInf(A), 4);
+
+  slap_SetConst(B, 1);
+  slap_ScaleByConst(B, 2);
+  slap_MatrixAddition(B, A, B, -1);  // B = A - 2
+  for (int i = 0; i < rows * cols; ++i) {
+    A_dense.data[i] -= 2;
+  }
+  EXPECT_DOUBLE_EQ(slap_NormedDifference(B, A_dense), 0);
+  EXPECT_TRUE(std::isnan(B.data[rows]));
+
+  // Padded vectors are still dense
+  Matrix x = slap_NewMatrixAligned(rows, 1);
+  EXPECT_TRUE(slap_IsDense(x));
+  slap_FreeMatrix(&A);
+  slap_FreeMatrix(&B);
+  slap_FreeMatrix(&A_dense);
+  slap_FreeMatrix(&x);
+}
+
 TEST(MatrixBasics, NewMatrix_DoubleFree) {
   Matrix mat = slap_NewMatrixZeros(5, 4);
   enum slap_ErrorCode code = slap_FreeMatrix(&mat);
@@ -42,6 +97,17 @@ TEST(MatrixBasics, NewMatrix_DoubleFree) {
 
 }
 
+TEST(MatrixBasics, SetNull_Band) {
+  Matrix A = slap_NewBandMatrix(5, 5, 2, 1);
+  Matrix B = A;
+  slap_SetNull(&B);
+  EXPECT_TRUE(slap_IsNull(B));
+  EXPECT_EQ(B.mattype, slap_DENSE);
+  EXPECT_EQ(B.kl, 0);
+  EXPECT_EQ(B.ku, 0);
+  slap_FreeMatrix(&A);
+}
+
 TEST(MatrixBasics, GetLinearIndex_2x3) {
   sfloat data[6] = {1, 2, 3, 4, 5, 6};
   Matrix A = slap_MatrixFromArray(2, 3, data);
@@ -561,6 +627,52 @@ TEST(MatrixTransformations, Reshape) {
   EXPECT_EQ(*slap_GetElement(B, 0, 1), 3);
 }
 
+TEST(MatrixIterator, MoreThan65535Elements) {
+  // The linear and memory indices used to wrap around at 16 bits
+  const int m = 300;
+  const int n = 301;
+  Matrix A = slap_NewMatrixZeros(m + 1, n);
+  Matrix B = slap_CreateSubMatrix(A, 1, 0, m, n);
+  int count = 0;
+  size_t last_index = 0;
+  for (MatrixIterator it = slap_Iterator(B); !slap_IsFinished(&it); slap_Step(&it)) {
+    last_index = it.index;
+    ++count;
+  }
+  EXPECT_EQ(count, m * n);
+  EXPECT_EQ(last_index, (size_t)slap_Cart2Index(B, m - 1, n - 1));
+
+  slap_SetConst(B, 2);
+  EXPECT_DOUBLE_EQ(slap_Sum(A), 2.0 * m * n);
+  EXPECT_DOUBLE_EQ(*slap_GetElement(A, 0, n - 1), 0);
+  Matrix C = slap_NewMatrix(m, n);
+  slap_Copy(C, B);
+  EXPECT_DOUBLE_EQ(slap_Sum(C), 2.0 * m * n);
+  slap_FreeMatrix(&A);
+  slap_FreeMatrix(&C);
+}
+
+#ifdef SLAP_WIDE_INDEX
+TEST(MatrixIterator, WideDimensions) {
+  const int m = 70000;
+  Matrix A = slap_NewMatrix(m, 2);
+  EXPECT_EQ(slap_NumRows(A), m);
+  EXPECT_EQ(slap_NumElements(A), 2 * m);
+  EXPECT_EQ(slap_Cart2Index(A, m - 1, 1), 2 * m - 1);
+  EXPECT_EQ(slap_NumCols(slap_Transpose(A)), m);
+
+  slap_SetConst(A, 1);
+  slap_SetElement(A, m - 1, 1, 3);
+  EXPECT_DOUBLE_EQ(slap_Sum(A), 2.0 * m + 2);
+  EXPECT_DOUBLE_EQ(*slap_GetElement(slap_Transpose(A), 1, m - 1), 3);
+  int row, col;
+  slap_Linear2Cart(A, 2 * m - 2, &row, &col);
+  EXPECT_EQ(row, m - 2);
+  EXPECT_EQ(col, 1);
+  slap_FreeMatrix(&A);
+}
+#endif
+
 TEST(MatrixPrinting, PrintRow) {
   sfloat data_x[4] = {1,2,3,4};
   Matrix x = slap_MatrixFromArray(4, 1, data_x);
@@ -0,0 +1,393 @@
+//
+// Created by Brian Jackson on 10/18/26.
+// Copyright (c) 2026 Robotic Exploration Lab. All rights reserved.
+//
+
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "slap/slap.h"
+
+// Fill a dense matrix with random values, keeping each element with the given probability
+static void SetRandomSparse(Matrix A, double density) {
+  for (int j = 0; j < slap_NumCols(A); ++j) {
+    for (int i = 0; i < slap_NumRows(A); ++i) {
+      bool keep = (double)rand() / RAND_MAX < density;
+      *slap_GetElement(A, i, j) = keep ? (sfloat)rand() / RAND_MAX - 0.5 : 0;
+    }
+  }
+}
+
+TEST(Sparse, FromArrays) {
+  // [1 0 4]
+  // [0 3 0]
+  // [2 0 5]
+  int colptr[4] = {0, 2, 3, 5};
+  int rowind[5] = {0, 2, 1, 0, 2};
+  sfloat values[5] = {1, 2, 3, 4, 5};
+  SparseMatrix A = slap_SparseFromArrays(3, 3, 5, colptr, rowind, values);
+  EXPECT_EQ(slap_SparseNumNonzeros(A), 5);
+
+  sfloat data[9];
+  Matrix dense = slap_MatrixFromArray(3, 3, data);
+  slap_SparseToDense(dense, A);
+  EXPECT_DOUBLE_EQ(*slap_GetElement(dense, 2, 0), 2);
+  EXPECT_DOUBLE_EQ(*slap_GetElement(dense, 0, 2), 4);
+  EXPECT_DOUBLE_EQ(*slap_GetElement(dense, 1, 0), 0);
+
+  slap_SparseToDense(dense, slap_SparseTranspose(A));
+  EXPECT_DOUBLE_EQ(*slap_GetElement(dense, 0, 2), 2);
+  EXPECT_DOUBLE_EQ(*slap_GetElement(dense, 2, 0), 4);
+  EXPECT_DOUBLE_EQ(*slap_GetElement(dense, 1, 1), 3);
+}
+
+TEST(Sparse, FromDense) {
+  const int m = 8;
+  const int n = 5;
+  Matrix A_dense = slap_NewMatrix(m, n);
+  Matrix A_copy = slap_NewMatrix(m, n);
+  srand(1);
+  SetRandomSparse(A_dense, 0.3);
+  int nnz = 0;
+  for (int k = 0; k < m * n; ++k) {
+    nnz += A_dense.data[k] != 0;
+  }
+
+  SparseMatrix A = slap_NewSparseMatrix(m, n, nnz);
+  EXPECT_EQ(slap_SparseNumNonzeros(A), 0);
+  EXPECT_EQ(slap_SparseFromDense(A, A_dense, 0), SLAP_NO_ERROR);
+  EXPECT_EQ(slap_SparseNumNonzeros(A), nnz);
+  slap_SparseToDense(A_copy, A);
+  EXPECT_DOUBLE_EQ(slap_NormedDifference(A_copy, A_dense), 0);
+
+  // Not enough space
+  SparseMatrix small = slap_NewSparseMatrix(m, n, nnz - 1);
+  EXPECT_EQ(slap_SparseFromDense(small, A_dense, 0), SLAP_INDEX_OUT_OF_BOUNDS);
+
+  // Dropping small elements
+  EXPECT_EQ(slap_SparseFromDense(A, A_dense, 0.25), SLAP_NO_ERROR);
+  EXPECT_LT(slap_SparseNumNonzeros(A), nnz);
+  for (int k = 0; k < slap_SparseNumNonzeros(A); ++k) {
+    EXPECT_GT(fabs(A.values[k]), 0.25);
+  }
+
+  slap_FreeSparseMatrix(&A);
+  slap_FreeSparseMatrix(&small);
+  EXPECT_EQ(A.colptr, nullptr);
+  slap_FreeMatrix(&A_dense);
+  slap_FreeMatrix(&A_copy);
+}
+
+TEST(Sparse, SparseMatMulAdd) {
+  const int m = 12;
+  const int n = 9;
+  const int p = 3;
+  Matrix A_dense = slap_NewMatrix(m, n);
+  srand(2);
+  SetRandomSparse(A_dense, 0.25);
+  SparseMatrix A = slap_NewSparseMatrix(m, n, m * n);
+  slap_SparseFromDense(A, A_dense, 0);
+
+  for (bool tA : {false, true}) {
+    SparseMatrix Ai = tA ? slap_SparseTranspose(A) : A;
+    Matrix Ai_dense = tA ? slap_Transpose(A_dense) : A_dense;
+    int rows = slap_SparseNumRows(Ai);
+    int cols = slap_SparseNumCols(Ai);
+    Matrix B = slap_NewMatrix(cols, p);
+    Matrix C = slap_NewMatrix(rows, p);
+    Matrix C_ans = slap_NewMatrix(rows, p);
+    slap_SetRange(B, -1, 1);
+    slap_SetRange(C, 0, 2);
+    slap_Copy(C_ans, C);
+    EXPECT_EQ(slap_SparseMatMulAdd(C, Ai, B, 0.5, 2), SLAP_NO_ERROR);
+    slap_MatMulAdd(C_ans, Ai_dense, B, 0.5, 2);
+    EXPECT_LT(slap_NormedDifference(C, C_ans), 1e-4);
+
+    // Strided and transposed B, and a strided C
+    Matrix parent = slap_NewMatrix(p + 2, cols);
+    Matrix Bt = slap_Transpose(slap_CreateSubMatrix(parent, 1, 0, p, cols));
+    slap_Copy(Bt, B);
+    Matrix C_parent = slap_NewMatrix(rows + 3, p);
+    Matrix Cs = slap_CreateSubMatrix(C_parent, 2, 0, rows, p);
+    EXPECT_EQ(slap_SparseMatMulAdd(Cs, Ai, Bt, 1, 0), SLAP_NO_ERROR);
+    slap_MatMulAdd(C_ans, Ai_dense, B, 1, 0);
+    EXPECT_LT(slap_NormedDifference(Cs, C_ans), 1e-4);
+
+    // Matrix-vector product
+    Matrix x = slap_CreateSubMatrix(B, 0, 1, cols, 1);
+    Matrix y = slap_CreateSubMatrix(C, 0, 1, rows, 1);
+    Matrix y_ans = slap_CreateSubMatrix(C_ans, 0, 1, rows, 1);
+    EXPECT_EQ(slap_SparseMatMulAdd(y, Ai, x, -1, 0), SLAP_NO_ERROR);
+    slap_MatMulAdd(y_ans, Ai_dense, x, -1, 0);
+    EXPECT_LT(slap_NormedDifference(y, y_ans), 1e-4);
+
+    slap_FreeMatrix(&B);
+    slap_FreeMatrix(&C);
+    slap_FreeMatrix(&C_ans);
+    slap_FreeMatrix(&parent);
+    slap_FreeMatrix(&C_parent);
+  }
+  slap_FreeSparseMatrix(&A);
+  slap_FreeMatrix(&A_dense);
+}
+
+TEST(Sparse, MatMulSparseAdd) {
+  const int m = 6;
+  const int n = 10;
+  const int p = 7;
+  Matrix B_dense = slap_NewMatrix(n, p);
+  srand(3);
+  SetRandomSparse(B_dense, 0.3);
+  SparseMatrix B = slap_NewSparseMatrix(n, p, n * p);
+  slap_SparseFromDense(B, B_dense, 0);
+
+  for (bool tB : {false, true}) {
+    SparseMatrix Bi = tB ? slap_SparseTranspose(B) : B;
+    Matrix Bi_dense = tB ? slap_Transpose(B_dense) : B_dense;
+    int rows = slap_SparseNumRows(Bi);
+    int cols = slap_SparseNumCols(Bi);
+    Matrix A = slap_NewMatrix(m, rows);
+    Matrix C = slap_NewMatrix(m, cols);
+    Matrix C_ans = slap_NewMatrix(m, cols);
+    slap_SetRange(A, -1, 1);
+    slap_SetRange(C, 0, 2);
+    slap_Copy(C_ans, C);
+    EXPECT_EQ(slap_MatMulSparseAdd(C, A, Bi, 0.5, 2), SLAP_NO_ERROR);
+    slap_MatMulAdd(C_ans, A, Bi_dense, 0.5, 2);
+    EXPECT_LT(slap_NormedDifference(C, C_ans), 1e-4);
+
+    // Transposed A, which takes the strided path
+    Matrix At = slap_NewMatrix(rows, m);
+    slap_Copy(slap_Transpose(At), A);
+    EXPECT_EQ(slap_MatMulSparseAdd(C, slap_Transpose(At), Bi, 1, 0), SLAP_NO_ERROR);
+    slap_MatMulAdd(C_ans, A, Bi_dense, 1, 0);
+    EXPECT_LT(slap_NormedDifference(C, C_ans), 1e-4);
+
+    slap_FreeMatrix(&A);
+    slap_FreeMatrix(&At);
+    slap_FreeMatrix(&C);
+    slap_FreeMatrix(&C_ans);
+  }
+  slap_FreeSparseMatrix(&B);
+  slap_FreeMatrix(&B_dense);
+}
+
+TEST(Sparse, Addition) {
+  const int m = 9;
+  const int n = 8;
+  Matrix A_dense = slap_NewMatrix(m, n);
+  Matrix B_dense = slap_NewMatrix(m, n);
+  Matrix C_dense = slap_NewMatrix(m, n);
+  Matrix C_ans = slap_NewMatrix(m, n);
+  srand(4);
+  SetRandomSparse(A_dense, 0.3);
+  SetRandomSparse(B_dense, 0.3);
+  SparseMatrix A = slap_NewSparseMatrix(m, n, m * n);
+  SparseMatrix B = slap_NewSparseMatrix(m, n, m * n);
+  slap_SparseFromDense(A, A_dense, 0);
+  slap_SparseFromDense(B, B_dense, 0);
+
+  // Output pattern is the union of A and B, plus a few explicit zeros
+  slap_MatrixAddition(C_dense, A_dense, B_dense, 1);
+  for (int k = 0; k < m * n; k += 7) {
+    C_dense.data[k] += 1;
+  }
+  SparseMatrix C = slap_NewSparseMatrix(m, n, m * n);
+  slap_SparseFromDense(C, C_dense, 0);
+  EXPECT_EQ(slap_SparseAddition(C, A, B, -2), SLAP_NO_ERROR);
+  slap_MatrixAddition(C_ans, A_dense, B_dense, -2);
+  slap_SparseToDense(C_dense, C);
+  EXPECT_LT(slap_NormedDifference(C_dense, C_ans), 1e-6);
+
+  // Shared pattern, aliased with the output
+  SparseMatrix A2 = A;
+  Matrix A2_values = slap_MatrixFromArray(slap_SparseNumNonzeros(A), 1, A.values);
+  Matrix A2_copy = slap_NewMatrix(slap_SparseNumNonzeros(A), 1);
+  slap_Copy(A2_copy, A2_values);
+  EXPECT_EQ(slap_SparseAddition(A2, A2, A, 1), SLAP_NO_ERROR);
+  slap_ScaleByConst(A2_copy, 2);
+  EXPECT_LT(slap_NormedDifference(A2_values, A2_copy), 1e-6);
+
+  // A has entries outside of the pattern of B
+  EXPECT_EQ(slap_SparseAddition(B, B, A, 1), SLAP_INDEX_OUT_OF_BOUNDS);
+
+  slap_FreeSparseMatrix(&A);
+  slap_FreeSparseMatrix(&B);
+  slap_FreeSparseMatrix(&C);
+  slap_FreeMatrix(&A_dense);
+  slap_FreeMatrix(&B_dense);
+  slap_FreeMatrix(&C_dense);
+  slap_FreeMatrix(&C_ans);
+  slap_FreeMatrix(&A2_copy);
+}
+
+// Shifted Laplacian of an nx x ny grid, which is positive definite
+static void SetGridLaplacian(Matrix A, int nx, int ny, sfloat shift) {
+  slap_SetConst(A, 0);
+  for (int x = 0; x < nx; ++x) {
+    for (int y = 0; y < ny; ++y) {
+      int k = x * ny + y;
+      *slap_GetElement(A, k, k) = 4 + shift;
+      if (x + 1 < nx) {
+        *slap_GetElement(A, k, k + ny) = -1;
+        *slap_GetElement(A, k + ny, k) = -1;
+      }
+      if (y + 1 < ny) {
+        *slap_GetElement(A, k, k + 1) = -1;
+        *slap_GetElement(A, k + 1, k) = -1;
+      }
+    }
+  }
+}
+
+// Solve A x = b with a dense Cholesky factorization, for comparison
+static void DenseCholeskySolve(Matrix A, Matrix b) {
+  Matrix L = slap_NewMatrix(slap_NumRows(A), slap_NumCols(A));
+  slap_Copy(L, A);
+  slap_Cholesky(L);
+  slap_CholeskySolve(L, b);
+  slap_FreeMatrix(&L);
+}
+
+TEST(SparseCholesky, GridLaplacian) {
+  const int nx = 9;
+  const int ny = 8;
+  const int n = nx * ny;
+  const int p = 2;
+  Matrix A_dense = slap_NewMatrix(n, n);
+  Matrix A_lower = slap_NewMatrix(n, n);
+  SetGridLaplacian(A_dense, nx, ny, 0.1);
+  slap_Copy(A_lower, A_dense);
+  slap_MakeLowerTri(A_lower);
+  SparseMatrix A = slap_NewSparseMatrix(n, n, n * n);
+  slap_SparseFromDense(A, A_lower, 0);
+
+  slap_SparseCholesky* chol = slap_SparseCholeskyAnalyze(A, NULL);
+  ASSERT_NE(chol, nullptr);
+  EXPECT_LT(slap_SparseCholeskyNumNonzeros(chol), n * (n + 1) / 2);
+  EXPECT_LT(slap_SparseCholeskyNumSupernodes(chol), n);
+
+  // The ordering is a permutation
+  const int* perm = slap_SparseCholeskyPermutation(chol);
+  std::vector<bool> seen(n, false);
+  for (int k = 0; k < n; ++k) {
+    ASSERT_TRUE(perm[k] >= 0 && perm[k] < n && !seen[perm[k]]);
+    seen[perm[k]] = true;
+  }
+
+  Matrix b = slap_NewMatrix(n, p);
+  Matrix x = slap_NewMatrix(n, p);
+  slap_SetRange(b, -1, 1);
+  slap_Copy(x, b);
+  int fail_col = 0;
+  EXPECT_EQ(slap_SparseCholeskyFactor(chol, A, &fail_col), SLAP_NO_ERROR);
+  EXPECT_EQ(fail_col, -1);
+  EXPECT_EQ(slap_SparseCholeskySolve(chol, x), SLAP_NO_ERROR);
+  DenseCholeskySolve(A_dense, b);
+  EXPECT_LT(slap_NormedDifference(x, b), 1e-4);
+
+  // Refactor with new values, reusing the analysis
+  for (int k = 0; k < n; ++k) {
+    *slap_GetElement(A_dense, k, k) += 0.1 * (k % 5);
+  }
+  slap_Copy(A_lower, A_dense);
+  slap_MakeLowerTri(A_lower);
+  slap_SparseFromDense(A, A_lower, 0);
+  slap_SetRange(b, -1, 1);
+  slap_Copy(x, b);
+  EXPECT_EQ(slap_SparseCholeskyFactor(chol, A, NULL), SLAP_NO_ERROR);
+  slap_SparseCholeskySolve(chol, x);
+  DenseCholeskySolve(A_dense, b);
+  EXPECT_LT(slap_NormedDifference(x, b), 1e-4);
+
+  // The full symmetric matrix gives the same answer, since the upper triangle is ignored
+  SparseMatrix A_full = slap_NewSparseMatrix(n, n, n * n);
+  slap_SparseFromDense(A_full, A_dense, 0);
+  slap_SparseCholesky* chol_full = slap_SparseCholeskyAnalyze(A_full, NULL);
+  ASSERT_NE(chol_full, nullptr);
+  EXPECT_EQ(slap_SparseCholeskyNumNonzeros(chol_full),
+            slap_SparseCholeskyNumNonzeros(chol));
+  slap_SetRange(x, -1, 1);
+  slap_SparseCholeskyFactor(chol_full, A_full, NULL);
+  slap_SparseCholeskySolve(chol_full, x);
+  EXPECT_LT(slap_NormedDifference(x, b), 1e-4);
+
+  // Natural ordering, which has more fill-in than minimum degree
+  std::vector<int> natural(n);
+  for (int k = 0; k < n; ++k) {
+    natural[k] = k;
+  }
+  slap_SparseCholesky* chol_natural = slap_SparseCholeskyAnalyze(A, natural.data());
+  ASSERT_NE(chol_natural, nullptr);
+  EXPECT_GT(slap_SparseCholeskyNumNonzeros(chol_natural),
+            slap_SparseCholeskyNumNonzeros(chol));
+  slap_SetRange(x, -1, 1);
+  slap_SparseCholeskyFactor(chol_natural, A, NULL);
+  slap_SparseCholeskySolve(chol_natural, x);
+  EXPECT_LT(slap_NormedDifference(x, b), 1e-4);
+
+  slap_SparseCholeskyDestroy(chol);
+  slap_SparseCholeskyDestroy(chol_full);
+  slap_SparseCholeskyDestroy(chol_natural);
+  slap_FreeSparseMatrix(&A);
+  slap_FreeSparseMatrix(&A_full);
+  slap_FreeMatrix(&A_dense);
+  slap_FreeMatrix(&A_lower);
+  slap_FreeMatrix(&b);
+  slap_FreeMatrix(&x);
+}
+
+TEST(SparseCholesky, BlockTridiagonal) {
+  // Dense diagonal blocks coupled to their neighbors, like the KKT system of a trajectory
+  const int nb = 6;
+  const int N = 10;
+  const int n = nb * N;
+  Matrix A_dense = slap_NewMatrix(n, n);
+  srand(5);
+  slap_SetConst(A_dense, 0);
+  for (int k = 0; k < N; ++k) {
+    for (int j = 0; j < nb; ++j) {
+      for (int i = 0; i < nb; ++i) {
+        sfloat Dij = (sfloat)rand() / RAND_MAX - 0.5;
+        *slap_GetElement(A_dense, k * nb + i, k * nb + j) += Dij;
+        *slap_GetElement(A_dense, k * nb + j, k * nb + i) += Dij;
+        if (k + 1 < N) {
+          sfloat Cij = (sfloat)rand() / RAND_MAX - 0.5;
+          *slap_GetElement(A_dense, (k + 1) * nb + i, k * nb + j) = Cij;
+          *slap_GetElement(A_dense, k * nb + j, (k + 1) * nb + i) = Cij;
+        }
+      }
+      *slap_GetElement(A_dense, k * nb + j, k * nb + j) += 2 * nb;
+    }
+  }
+  SparseMatrix A = slap_NewSparseMatrix(n, n, n * n);
+  slap_SparseFromDense(A, A_dense, 0);
+  slap_SparseCholesky* chol = slap_SparseCholeskyAnalyze(A, NULL);
+  ASSERT_NE(chol, nullptr);
+  EXPECT_LE(slap_SparseCholeskyNumSupernodes(chol), 2 * N);
+
+  Matrix b = slap_NewMatrix(n, 1);
+  Matrix x = slap_NewMatrix(n, 1);
+  slap_SetRange(b, -1, 1);
+  slap_Copy(x, b);
+  EXPECT_EQ(slap_SparseCholeskyFactor(chol, A, NULL), SLAP_NO_ERROR);
+  slap_SparseCholeskySolve(chol, x);
+  DenseCholeskySolve(A_dense, b);
+  EXPECT_LT(slap_NormedDifference(x, b), 1e-4);
+
+  // Not positive definite
+  const int bad = 2 * nb + 3;
+  *slap_GetElement(A_dense, bad, bad) = -100;
+  slap_SparseFromDense(A, A_dense, 0);
+  int fail_col = -1;
+  EXPECT_EQ(slap_SparseCholeskyFactor(chol, A, &fail_col), SLAP_CHOLESKY_FAIL);
+  EXPECT_GE(fail_col, 0);
+
+  slap_SparseCholeskyDestroy(chol);
+  slap_FreeSparseMatrix(&A);
+  slap_FreeMatrix(&A_dense);
+  slap_FreeMatrix(&b);
+  slap_FreeMatrix(&x);
+}
@@ -0,0 +1,200 @@
+//
+// Created by Brian Jackson on 10/18/26.
+// Copyright (c) 2026 Robotic Exploration Lab. All rights reserved.
+//
+
+#include <atomic>
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "slap/slap.h"
+
+// Runs each test with pools of several sizes, and without a pool
+class ThreadPoolTest : public ::testing::TestWithParam<int> {
+ protected:
+  void SetUp() override {
+    if (GetParam() > 0) {
+      pool = slap_ThreadPoolCreate(GetParam());
+      ASSERT_NE(pool, nullptr);
+    }
+  }
+  void TearDown() override { slap_ThreadPoolDestroy(pool); }
+  slap_ThreadPool* pool = nullptr;
+};
+
+bool BitwiseEqual(Matrix A, Matrix B) {
+  for (int i = 0; i < slap_NumRows(A); ++i) {
+    for (int j = 0; j < slap_NumCols(A); ++j) {
+      if (*slap_GetElement(A, i, j) != *slap_GetElement(B, i, j)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+TEST(ThreadPool, NumThreads) {
+  EXPECT_EQ(slap_ThreadPoolNumThreads(nullptr), 1);
+  slap_ThreadPool* pool = slap_ThreadPoolCreate(0);
+  ASSERT_NE(pool, nullptr);
+  EXPECT_GE(slap_ThreadPoolNumThreads(pool), 1);
+  slap_ThreadPoolDestroy(pool);
+  slap_ThreadPoolDestroy(nullptr);
+}
+
+TEST_P(ThreadPoolTest, RunsEveryTaskOnce) {
+  std::vector<std::atomic<int>> counts(103);
+  auto task = [](void* context, int t) {
+    (*static_cast<std::vector<std::atomic<int>>*>(context))[t]++;
+  };
+  // Reuse the same pool for several jobs
+  for (int rep = 0; rep < 20; ++rep) {
+    EXPECT_EQ(slap_ThreadPoolRun(pool, counts.size(), task, &counts), SLAP_NO_ERROR);
+  }
+  for (auto& count : counts) {
+    EXPECT_EQ(count, 20);
+  }
+}
+
+TEST_P(ThreadPoolTest, MatMulAdd) {
+  const int m = 150;
+  const int k = 90;
+  const int n = 131;
+  Matrix A = slap_NewMatrix(k, m);
+  Matrix B = slap_NewMatrix(k, n);
+  Matrix C = slap_NewMatrix(m, n);
+  Matrix C_ans = slap_NewMatrix(m, n);
+  slap_SetRange(A, -1, 1);
+  slap_SetRange(B, 2, -1);
+  slap_SetRange(C, 0, 1);
+  slap_SetRange(C_ans, 0, 1);
+  slap_MatMulBlocked(C_ans, slap_Transpose(A), B, 0.5, -1);
+  EXPECT_EQ(slap_MatMulAddParallel(pool, C, slap_Transpose(A), B, 0.5, -1),
+            SLAP_NO_ERROR);
+  EXPECT_LT(slap_NormedDifference(C, C_ans), 1e-6);
+
+  // Transposed output
+  Matrix Ct = slap_NewMatrix(n, m);
+  slap_SetConst(Ct, NAN);
+  slap_SetConst(C_ans, NAN);
+  slap_MatMulAddParallel(pool, slap_Transpose(Ct), slap_Transpose(A), B, 1, 0);
+  slap_MatMulBlocked(C_ans, slap_Transpose(A), B, 1, 0);
+  EXPECT_TRUE(BitwiseEqual(slap_Transpose(Ct), C_ans));
+
+  slap_FreeMatrix(&A);
+  slap_FreeMatrix(&B);
+  slap_FreeMatrix(&C);
+  slap_FreeMatrix(&Ct);
+  slap_FreeMatrix(&C_ans);
+}
+
+TEST_P(ThreadPoolTest, MatMulAddStructured) {
+  // Diagonal and band matrices only store some of their elements, so they can't be tiled
+  const int n = 200;
+  Matrix A = slap_NewMatrix(n, n);
+  Matrix D = slap_NewDiagonalMatrix(n);
+  Matrix B = slap_NewBandMatrix(n, n, 1, 1);
+  Matrix B_dense = slap_NewMatrix(n, n);
+  Matrix C = slap_NewMatrix(n, n);
+  Matrix C_ans = slap_NewMatrix(n, n);
+  slap_SetConst(A, 1);
+  slap_SetConst(D, 2);
+  EXPECT_EQ(slap_MatMulAddParallel(pool, C, A, D, 1, 0), SLAP_NO_ERROR);
+  EXPECT_DOUBLE_EQ(*slap_GetElement(C, 0, 0), 2);
+  EXPECT_DOUBLE_EQ(slap_Sum(C), 2.0 * n * n);
+
+  slap_SetConst(B, 1);
+  slap_SetConst(B_dense, 0);
+  for (int j = 0; j < n; ++j) {
+    for (int i = j > 0 ? j - 1 : 0; i < n && i <= j + 1; ++i) {
+      slap_SetElement(B_dense, i, j, 1);
+    }
+  }
+  slap_MatMulAdd(C_ans, B_dense, A, 1, 0);
+  EXPECT_EQ(slap_MatMulAddParallel(pool, C, B, A, 1, 0), SLAP_NO_ERROR);
+  EXPECT_LT(slap_NormedDifference(C, C_ans), 1e-6);
+  if (slap_AssertionsEnabled()) {
+    EXPECT_EQ(slap_MatMulBlocked(C, A, D, 1, 0), SLAP_INVALID_MATRIX);
+  }
+
+  slap_FreeMatrix(&A);
+  slap_FreeMatrix(&D);
+  slap_FreeMatrix(&B);
+  slap_FreeMatrix(&B_dense);
+  slap_FreeMatrix(&C);
+  slap_FreeMatrix(&C_ans);
+}
+
+TEST_P(ThreadPoolTest, Cholesky) {
+  const int n = 2 * SLAP_CHOLESKY_THRESHOLD + 17;
+  Matrix G = slap_NewMatrix(n, n);
+  Matrix A = slap_NewMatrix(n, n);
+  Matrix L = slap_NewMatrix(n, n);
+  Matrix L_ans = slap_NewMatrix(n, n);
+  slap_SetRange(G, -1, 1);
+  slap_MatMulAdd(A, slap_Transpose(G), G, 1.0 / n, 0);
+  slap_AddIdentity(A, 1);
+  slap_Copy(L_ans, A);
+  slap_Cholesky(L_ans);
+
+  // Repeated runs give identical results
+  for (int rep = 0; rep < 2; ++rep) {
+    slap_Copy(L, A);
+    int fail_col = 0;
+    EXPECT_EQ(slap_CholeskyParallel(pool, L, &fail_col), SLAP_NO_ERROR);
+    EXPECT_EQ(fail_col, -1);
+    EXPECT_LT(slap_NormedDifference(L, L_ans), 1e-6);
+    if (rep == 0) {
+      slap_Copy(L_ans, L);
+    } else {
+      EXPECT_TRUE(BitwiseEqual(L, L_ans));
+    }
+  }
+
+  slap_Copy(L, A);
+  slap_SetElement(L, n - 3, n - 3, -1);
+  int fail_col = 0;
+  EXPECT_EQ(slap_CholeskyParallel(pool, L, &fail_col), SLAP_CHOLESKY_FAIL);
+  EXPECT_EQ(fail_col, n - 3);
+
+  slap_FreeMatrix(&G);
+  slap_FreeMatrix(&A);
+  slap_FreeMatrix(&L);
+  slap_FreeMatrix(&L_ans);
+}
+
+TEST_P(ThreadPoolTest, QR) {
+  const int m = 300;
+  const int n = 200;
+  Matrix A = slap_NewMatrix(m, n);
+  Matrix QR = slap_NewMatrix(m, n);
+  Matrix QR_ans = slap_NewMatrix(m, n);
+  Matrix betas = slap_NewMatrix(m, 1);
+  Matrix betas_ans = slap_NewMatrix(m, 1);
+  Matrix temp = slap_NewMatrix(m, 1);
+  slap_SetRange(A, -1, 1);
+  for (int i = 0; i < slap_MinDim(A); ++i) {
+    *slap_GetElement(A, i, i) += 10;
+  }
+  slap_Copy(QR_ans, A);
+  slap_QR(QR_ans, betas_ans, temp);
+  slap_Copy(QR, A);
+  EXPECT_EQ(slap_QRParallel(pool, QR, betas, temp), SLAP_NO_ERROR);
+  EXPECT_LT(slap_NormedDifference(QR, QR_ans), 1e-8);
+  EXPECT_LT(slap_NormedDifference(betas, betas_ans), 1e-8);
+
+  slap_FreeMatrix(&A);
+  slap_FreeMatrix(&QR);
+  slap_FreeMatrix(&QR_ans);
+  slap_FreeMatrix(&betas);
+  slap_FreeMatrix(&betas_ans);
+  slap_FreeMatrix(&temp);
+}
+
+INSTANTIATE_TEST_SUITE_P(PoolSizes, ThreadPoolTest, ::testing::Values(0, 1, 2, 3, 8),
+                         [](const ::testing::TestParamInfo<int>& info) {
+                           return info.param == 0 ? std::string("NoPool")
+                                                  : std::to_string(info.param) + "Threads";
+                         });